@@ -0,0 +1,266 @@
+/**
+ *  @file   benchmark/LArPackedFieldCodecBenchmark.cc
+ *
+ *  @brief  Read and write throughput benchmark for the binary payloads of the lar object factories.
+ *
+ *          Writes the lar calo hit and lar mc particle payloads of a set of generated objects to a binary file, for each factory version,
+ *          then reads them back, reporting the payload size per object, the write and read throughput and the number of read values that
+ *          differ from those written. Usage: LArPackedFieldCodecBenchmark [nObjects] [fileName]
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/Pandora.h"
+
+#include "larpandoracontent/LArObjects/LArCaloHit.h"
+#include "larpandoracontent/LArObjects/LArMCParticle.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace pandora;
+using namespace lar_content;
+
+namespace
+{
+
+typedef std::vector<std::unique_ptr<LArCaloHit>> LArCaloHitVector;
+typedef std::vector<std::unique_ptr<LArMCParticle>> LArMCParticleVector;
+
+/**
+ *  @brief  Generate lar calo hits with a realistic spread of volume ids, and track and shower probabilities for most hits
+ *
+ *  @param  nObjects the number of hits
+ *  @param  generator the random number generator
+ *  @param  caloHitVector to receive the hits
+ */
+void GenerateCaloHits(const unsigned int nObjects, std::mt19937 &generator, LArCaloHitVector &caloHitVector)
+{
+    std::uniform_int_distribution<unsigned int> tpcDistribution(0, 11), daughterDistribution(0, 300);
+    std::uniform_real_distribution<float> unitDistribution(0.f, 1.f), positionDistribution(0.f, 1000.f);
+
+    for (unsigned int iObject = 0; iObject < nObjects; ++iObject)
+    {
+        LArCaloHitParameters parameters;
+        parameters.m_positionVector = CartesianVector(positionDistribution(generator), 0.f, positionDistribution(generator));
+        parameters.m_expectedDirection = CartesianVector(0.f, 0.f, 1.f);
+        parameters.m_cellNormalVector = CartesianVector(0.f, 0.f, 1.f);
+        parameters.m_cellGeometry = RECTANGULAR;
+        parameters.m_cellSize0 = 0.5f;
+        parameters.m_cellSize1 = 0.3f;
+        parameters.m_cellThickness = 0.3f;
+        parameters.m_nCellRadiationLengths = 1.f;
+        parameters.m_nCellInteractionLengths = 1.f;
+        parameters.m_time = 0.f;
+        parameters.m_inputEnergy = unitDistribution(generator);
+        parameters.m_mipEquivalentEnergy = unitDistribution(generator);
+        parameters.m_electromagneticEnergy = unitDistribution(generator);
+        parameters.m_hadronicEnergy = unitDistribution(generator);
+        parameters.m_isDigital = false;
+        parameters.m_hitType = TPC_VIEW_W;
+        parameters.m_hitRegion = SINGLE_REGION;
+        parameters.m_layer = 0;
+        parameters.m_isInOuterSamplingLayer = false;
+        parameters.m_pParentAddress = reinterpret_cast<const void *>(static_cast<std::uintptr_t>(iObject + 1));
+        parameters.m_larTPCVolumeId = tpcDistribution(generator);
+        parameters.m_daughterVolumeId = daughterDistribution(generator);
+
+        if (unitDistribution(generator) < 0.9f)
+        {
+            const float pTrack(unitDistribution(generator));
+            parameters.m_pTrack = pTrack;
+            parameters.m_pShower = 1.f - pTrack;
+        }
+
+        caloHitVector.emplace_back(new LArCaloHit(parameters));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Generate lar mc particles with a realistic spread of nuance codes and processes
+ *
+ *  @param  nObjects the number of mc particles
+ *  @param  generator the random number generator
+ *  @param  mcParticleVector to receive the mc particles
+ */
+void GenerateMCParticles(const unsigned int nObjects, std::mt19937 &generator, LArMCParticleVector &mcParticleVector)
+{
+    std::uniform_int_distribution<int> nuanceDistribution(1000, 1100), processDistribution(MC_PROC_INCIDENT_NU, MC_PROC_HE3_INELASTIC);
+    std::uniform_real_distribution<float> unitDistribution(0.f, 1.f);
+
+    for (unsigned int iObject = 0; iObject < nObjects; ++iObject)
+    {
+        LArMCParticleParameters parameters;
+        parameters.m_energy = unitDistribution(generator);
+        parameters.m_momentum = CartesianVector(unitDistribution(generator), unitDistribution(generator), unitDistribution(generator));
+        parameters.m_vertex = CartesianVector(0.f, 0.f, 0.f);
+        parameters.m_endpoint = CartesianVector(unitDistribution(generator), unitDistribution(generator), unitDistribution(generator));
+        parameters.m_particleId = 13;
+        parameters.m_mcParticleType = MC_3D;
+        parameters.m_pParentAddress = reinterpret_cast<const void *>(static_cast<std::uintptr_t>(iObject + 1));
+        parameters.m_nuanceCode = (unitDistribution(generator) < 0.9f) ? 0 : nuanceDistribution(generator);
+        parameters.m_process = processDistribution(generator);
+
+        mcParticleVector.emplace_back(new LArMCParticle(parameters));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Write the payloads of a set of objects with a given factory, read them back and print the payload size, throughput and the
+ *          number of objects whose read parameters differ from those written
+ *
+ *  @param  label the label for the printout
+ *  @param  pandora the pandora instance
+ *  @param  factory the factory
+ *  @param  objectVector the objects
+ *  @param  fileName the name of the (temporary) binary file
+ *  @param  isMatch whether the parameters read for an object match the object
+ */
+template <typename FACTORY, typename OBJECT, typename PARAMETERS>
+void RunBenchmark(const std::string &label, const Pandora &pandora, const FACTORY &factory,
+    const std::vector<std::unique_ptr<OBJECT>> &objectVector, const std::string &fileName,
+    const std::function<bool(const OBJECT &, const PARAMETERS &)> &isMatch)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    const Clock::time_point writeStart(Clock::now());
+    {
+        BinaryFileWriter binaryFileWriter(pandora, fileName, OVERWRITE);
+
+        for (const std::unique_ptr<OBJECT> &pObject : objectVector)
+        {
+            if (STATUS_CODE_SUCCESS != factory.Write(pObject.get(), binaryFileWriter))
+                throw StatusCodeException(STATUS_CODE_FAILURE);
+        }
+    }
+    const double writeSeconds(std::chrono::duration<double>(Clock::now() - writeStart).count());
+
+    std::ifstream fileStream(fileName, std::ios::binary | std::ios::ate);
+    const double nBytes(static_cast<double>(fileStream.tellg()));
+
+    unsigned int nMismatches(0);
+
+    const Clock::time_point readStart(Clock::now());
+    {
+        BinaryFileReader binaryFileReader(pandora, fileName);
+
+        for (const std::unique_ptr<OBJECT> &pObject : objectVector)
+        {
+            // ATTN Fresh parameters for each object, as when reading an event, so that unset optional parameters remain unset
+            const std::unique_ptr<typename FACTORY::Parameters> pParameters(factory.NewParameters());
+
+            if (STATUS_CODE_SUCCESS != factory.Read(*pParameters, binaryFileReader))
+                throw StatusCodeException(STATUS_CODE_FAILURE);
+
+            if (!isMatch(*pObject, dynamic_cast<const PARAMETERS &>(*pParameters)))
+                ++nMismatches;
+        }
+    }
+    const double readSeconds(std::chrono::duration<double>(Clock::now() - readStart).count());
+
+    const double nObjects(static_cast<double>(objectVector.size()));
+    std::printf("%-34s %8.3f bytes/object %10.1f MB/s write %10.1f MB/s read %12.0f objects/s read %10u mismatches\n", label.c_str(),
+        nBytes / nObjects, nBytes / (1.e6 * writeSeconds), nBytes / (1.e6 * readSeconds), nObjects / readSeconds, nMismatches);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Whether the parameters read for a lar calo hit match the hit, requiring exact probabilities or probabilities within the half
+ *          precision rounding error
+ *
+ *  @param  caloHit the lar calo hit
+ *  @param  parameters the parameters read
+ *  @param  hasProbabilities whether the payload persists the track and shower probabilities
+ *  @param  isHalfPrecision whether the probabilities were written at half precision
+ *
+ *  @return boolean
+ */
+bool IsMatch(const LArCaloHit &caloHit, const LArCaloHitParameters &parameters, const bool hasProbabilities, const bool isHalfPrecision)
+{
+    if ((parameters.m_larTPCVolumeId.Get() != caloHit.GetLArTPCVolumeId()) ||
+        (parameters.m_daughterVolumeId.Get() != caloHit.GetDaughterVolumeId()))
+        return false;
+
+    if (!hasProbabilities)
+        return true;
+
+    if ((parameters.m_pTrack.IsInitialized() != caloHit.HasTrackProbability()) ||
+        (parameters.m_pShower.IsInitialized() != caloHit.HasShowerProbability()))
+        return false;
+
+    // ATTN Half precision values are within one part in two thousand over the unit interval
+    const float tolerance(isHalfPrecision ? 1.f / 2048.f : 0.f);
+
+    if (caloHit.HasTrackProbability() && (std::fabs(parameters.m_pTrack.Get() - caloHit.GetTrackProbability()) > tolerance))
+        return false;
+
+    if (caloHit.HasShowerProbability() && (std::fabs(parameters.m_pShower.Get() - caloHit.GetShowerProbability()) > tolerance))
+        return false;
+
+    return true;
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    try
+    {
+        const unsigned int nObjects((argc > 1) ? std::stoul(argv[1]) : 1000000);
+        const std::string fileName((argc > 2) ? argv[2] : "LArPackedFieldCodecBenchmark.pndr");
+
+        std::mt19937 generator(12345);
+        LArCaloHitVector caloHitVector;
+        LArMCParticleVector mcParticleVector;
+        GenerateCaloHits(nObjects, generator, caloHitVector);
+        GenerateMCParticles(nObjects, generator, mcParticleVector);
+
+        typedef std::function<bool(const LArCaloHit &, const LArCaloHitParameters &)> CaloHitMatchFunction;
+        typedef std::function<bool(const LArMCParticle &, const LArMCParticleParameters &)> MCParticleMatchFunction;
+
+        const Pandora pandora;
+        const CaloHitMatchFunction isIdMatch(
+            [](const LArCaloHit &caloHit, const LArCaloHitParameters &parameters) { return IsMatch(caloHit, parameters, false, false); });
+        const CaloHitMatchFunction isCaloHitMatch(
+            [](const LArCaloHit &caloHit, const LArCaloHitParameters &parameters) { return IsMatch(caloHit, parameters, true, false); });
+        const CaloHitMatchFunction isHalfPrecisionCaloHitMatch(
+            [](const LArCaloHit &caloHit, const LArCaloHitParameters &parameters) { return IsMatch(caloHit, parameters, true, true); });
+        const MCParticleMatchFunction isMCParticleMatch([](const LArMCParticle &mcParticle, const LArMCParticleParameters &parameters) {
+            return ((parameters.m_nuanceCode.Get() == mcParticle.GetNuanceCode()) &&
+                (parameters.m_process.Get() == static_cast<int>(mcParticle.GetProcess())));
+        });
+
+        std::cout << "LArPackedFieldCodecBenchmark: " << nObjects << " objects per payload type" << std::endl;
+        RunBenchmark("LArCaloHit v2 (ids only)", pandora, LArCaloHitFactory(2), caloHitVector, fileName, isIdMatch);
+        RunBenchmark("LArCaloHit v3", pandora, LArCaloHitFactory(3), caloHitVector, fileName, isCaloHitMatch);
+        RunBenchmark(
+            "LArCaloHit v3, half precision", pandora, LArCaloHitFactory(3, true), caloHitVector, fileName, isHalfPrecisionCaloHitMatch);
+        RunBenchmark("LArMCParticle v2", pandora, LArMCParticleFactory(2), mcParticleVector, fileName, isMCParticleMatch);
+        RunBenchmark("LArMCParticle v3", pandora, LArMCParticleFactory(3), mcParticleVector, fileName, isMCParticleMatch);
+
+        std::remove(fileName.c_str());
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cerr << "LArPackedFieldCodecBenchmark: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -23,6 +23,7 @@ namespace lar_content
 BdtBeamParticleIdTool::BdtBeamParticleIdTool() :
     m_useTrainingMode(false),
     m_trainingOutputFile(""),
+    m_trainingOutputFormat("csv"),
     m_minPurity(0.8f),
     m_minCompleteness(0.8f),
     m_adaBoostDecisionTree(AdaBoostDecisionTree()),
@@ -116,7 +117,7 @@ void BdtBeamParticleIdTool::SelectOutputPfos(const pandora::Algorithm *const pAl
             if (std::find(bestSliceIndices.begin(), bestSliceIndices.end(), sliceIndex) != bestSliceIndices.end())
                 isGoodTrainingSlice = true;
 
-            LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, isGoodTrainingSlice, featureVector);
+            LArMvaHelper::ProduceTrainingExample(m_trainingSink, m_trainingOutputFile, isGoodTrainingSlice, featureVector);
         }
 
         return;
@@ -697,6 +698,9 @@ StatusCode BdtBeamParticleIdTool::ReadSettings(const TiXmlHandle xmlHandle)
     if (m_useTrainingMode)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFileName", m_trainingOutputFile));
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFormat", m_trainingOutputFormat));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_trainingSink.SetFormat(m_trainingOutputFormat));
 
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "CaloHitListName", m_caloHitListName));
 
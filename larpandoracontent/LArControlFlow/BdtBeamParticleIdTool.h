@@ -13,6 +13,7 @@
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
 
 #include "larpandoracontent/LArObjects/LArAdaBoostDecisionTree.h"
+#include "larpandoracontent/LArObjects/LArMvaTrainingSink.h"
 
 namespace lar_content
 {
@@ -386,11 +387,13 @@ private:
 
     // Training
     bool m_useTrainingMode;           ///< Should use training mode. If true, training examples will be written to the output file
-    std::string m_trainingOutputFile; ///< Output file name for training examples
-    std::string m_caloHitListName;    ///< Name of input calo hit list
-    std::string m_mcParticleListName; ///< Name of input MC particle list
-    float m_minPurity;                ///< Minimum purity of the best slice to use event for training
-    float m_minCompleteness;          ///< Minimum completeness of the best slice to use event for training
+    std::string m_trainingOutputFile;   ///< Output file name for training examples
+    std::string m_trainingOutputFormat; ///< Output format for training examples, csv or binary
+    MvaTrainingSink m_trainingSink;     ///< The sink buffering the training examples
+    std::string m_caloHitListName;      ///< Name of input calo hit list
+    std::string m_mcParticleListName;   ///< Name of input MC particle list
+    float m_minPurity;                  ///< Minimum purity of the best slice to use event for training
+    float m_minCompleteness;            ///< Minimum completeness of the best slice to use event for training
 
     // Classification
     AdaBoostDecisionTree m_adaBoostDecisionTree;     ///< The adaptive boost decision tree
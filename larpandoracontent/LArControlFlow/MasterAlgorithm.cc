@@ -15,8 +15,11 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArFileHelper.h"
+#include "larpandoracontent/LArHelpers/LArInstrumentationHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArProcessingBudgetHelper.h"
 #include "larpandoracontent/LArHelpers/LArStitchingHelper.h"
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
@@ -27,6 +30,9 @@
 
 #include "larpandoracontent/LArUtility/PfoMopUpBaseAlgorithm.h"
 
+#include <algorithm>
+#include <chrono>
+
 using namespace pandora;
 
 namespace lar_content
@@ -48,11 +54,44 @@ MasterAlgorithm::MasterAlgorithm() :
     m_pSlicingWorkerInstance(nullptr),
     m_pSliceNuWorkerInstance(nullptr),
     m_pSliceCRWorkerInstance(nullptr),
+    m_nSliceThreads(1),
+    m_checkSerialEquivalence(false),
+    m_pSliceNuReferenceInstance(nullptr),
+    m_pSliceCRReferenceInstance(nullptr),
+    m_sliceTimeBudget(0.f),
+    m_sliceWorkBudget(0),
+    m_workerTimeBudget(0.f),
+    m_budgetFallbackToCosmic(true),
     m_fullWidthCRWorkerWireGaps(true),
     m_passMCParticlesToWorkerInstances(false),
+    m_filterMCParticlesByHits(false),
     m_filePathEnvironmentVariable("FW_SEARCH_PATH"),
-    m_inTimeMaxX0(1.f)
+    m_inTimeMaxX0(1.f),
+    m_enableInstrumentation(false),
+    m_instrumentationPerEvent(true),
+    m_instrumentationFileName("LArInstrumentation.json"),
+    m_instrumentationFormat("json"),
+    m_nInstrumentedEvents(0),
+    m_hasInstrumentationResults(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+MasterAlgorithm::~MasterAlgorithm()
 {
+    try
+    {
+        if (m_hasInstrumentationResults)
+            this->WriteInstrumentationResults(m_instrumentationPerEvent ? "event " + std::to_string(m_nInstrumentedEvents - 1) : "job");
+
+        // ATTN The worker instances may already have been deleted, but are only used to identify their results
+        for (const Pandora *const pPandora : m_instrumentedInstances)
+            LArInstrumentationHelper::DisableRecording(pPandora);
+    }
+    catch (...)
+    {
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -154,11 +193,20 @@ StatusCode MasterAlgorithm::Run()
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Reset());
 
+    if (m_enableInstrumentation)
+    {
+        m_hasInstrumentationResults = true;
+        ++m_nInstrumentedEvents;
+    }
+
+    const LArInstrumentationHelper::ScopedTimer timer(*this, "Run");
+
     if (!m_workerInstancesInitialized)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->InitializeWorkerInstances());
 
-    if (m_passMCParticlesToWorkerInstances)
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CopyMCParticles());
+    // ATTN When filtering by hits, mc particles are instead copied to each worker just before it runs
+    if (m_passMCParticlesToWorkerInstances && !m_filterMCParticlesByHits)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CopyMCParticles(this->GetWorkerInstances()));
 
     PfoToFloatMap stitchedPfosToX0Map;
     VolumeIdToHitListMap volumeIdToHitListMap;
@@ -188,8 +236,11 @@ StatusCode MasterAlgorithm::Run()
     if (m_shouldRunNeutrinoRecoOption || m_shouldRunCosmicRecoOption)
     {
         SliceHypotheses nuSliceHypotheses, crSliceHypotheses;
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunSliceReconstruction(sliceVector, nuSliceHypotheses, crSliceHypotheses));
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SelectBestSliceHypotheses(nuSliceHypotheses, crSliceHypotheses));
+        BudgetFallbackVector nuBudgetFallbacks, crBudgetFallbacks;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            this->RunSliceReconstruction(sliceVector, nuSliceHypotheses, crSliceHypotheses, nuBudgetFallbacks, crBudgetFallbacks));
+        PANDORA_RETURN_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, this->SelectBestSliceHypotheses(nuSliceHypotheses, crSliceHypotheses, crBudgetFallbacks));
     }
 
     return STATUS_CODE_SUCCESS;
@@ -223,6 +274,30 @@ StatusCode MasterAlgorithm::InitializeWorkerInstances()
 
         if (m_shouldRunCosmicRecoOption)
             m_pSliceCRWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_crSettingsFile, "SliceCRWorker");
+
+        for (unsigned int iSet = 1; iSet < m_nSliceThreads; ++iSet)
+        {
+            if (m_shouldRunNeutrinoRecoOption)
+            {
+                m_extraSliceNuWorkerInstances.push_back(
+                    this->CreateWorkerInstance(larTPCMap, gapList, m_nuSettingsFile, "SliceNuWorker" + std::to_string(iSet)));
+            }
+
+            if (m_shouldRunCosmicRecoOption)
+            {
+                m_extraSliceCRWorkerInstances.push_back(
+                    this->CreateWorkerInstance(larTPCMap, gapList, m_crSettingsFile, "SliceCRWorker" + std::to_string(iSet)));
+            }
+        }
+
+        if (m_checkSerialEquivalence && (m_nSliceThreads > 1))
+        {
+            if (m_shouldRunNeutrinoRecoOption)
+                m_pSliceNuReferenceInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_nuSettingsFile, "SliceNuReferenceWorker");
+
+            if (m_shouldRunCosmicRecoOption)
+                m_pSliceCRReferenceInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_crSettingsFile, "SliceCRReferenceWorker");
+        }
     }
     catch (const StatusCodeException &statusCodeException)
     {
@@ -230,17 +305,23 @@ StatusCode MasterAlgorithm::InitializeWorkerInstances()
         return statusCodeException.GetStatusCode();
     }
 
+    if (m_enableInstrumentation)
+    {
+        for (const Pandora *const pPandoraWorker : this->GetWorkerInstances())
+        {
+            LArInstrumentationHelper::EnableRecording(pPandoraWorker);
+            m_instrumentedInstances.push_back(pPandoraWorker);
+        }
+    }
+
     m_workerInstancesInitialized = true;
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode MasterAlgorithm::CopyMCParticles() const
+PandoraInstanceList MasterAlgorithm::GetWorkerInstances() const
 {
-    const MCParticleList *pMCParticleList(nullptr);
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, m_inputMCParticleListName, pMCParticleList));
-
     PandoraInstanceList pandoraWorkerInstances(m_crWorkerInstances);
     if (m_pSlicingWorkerInstance)
         pandoraWorkerInstances.push_back(m_pSlicingWorkerInstance);
@@ -249,6 +330,26 @@ StatusCode MasterAlgorithm::CopyMCParticles() const
     if (m_pSliceCRWorkerInstance)
         pandoraWorkerInstances.push_back(m_pSliceCRWorkerInstance);
 
+    pandoraWorkerInstances.insert(pandoraWorkerInstances.end(), m_extraSliceNuWorkerInstances.begin(), m_extraSliceNuWorkerInstances.end());
+    pandoraWorkerInstances.insert(pandoraWorkerInstances.end(), m_extraSliceCRWorkerInstances.begin(), m_extraSliceCRWorkerInstances.end());
+
+    if (m_pSliceNuReferenceInstance)
+        pandoraWorkerInstances.push_back(m_pSliceNuReferenceInstance);
+    if (m_pSliceCRReferenceInstance)
+        pandoraWorkerInstances.push_back(m_pSliceCRReferenceInstance);
+
+    return pandoraWorkerInstances;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::CopyMCParticles(const PandoraInstanceList &pandoraWorkerInstances) const
+{
+    const LArInstrumentationHelper::ScopedTimer timer(*this, "CopyMCParticles");
+
+    const MCParticleList *pMCParticleList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, m_inputMCParticleListName, pMCParticleList));
+
     LArMCParticleFactory mcParticleFactory;
 
     for (const Pandora *const pPandoraWorker : pandoraWorkerInstances)
@@ -257,6 +358,76 @@ StatusCode MasterAlgorithm::CopyMCParticles() const
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pPandoraWorker, pMCParticle, &mcParticleFactory));
     }
 
+    const unsigned int nCopies(pMCParticleList->size() * pandoraWorkerInstances.size());
+    LArInstrumentationHelper::AddToCounter(*this, "nMCParticlesCopied", static_cast<double>(nCopies));
+
+    if (m_printOverallRecoStatus)
+        std::cout << "Copied " << nCopies << " mc particle(s) to " << pandoraWorkerInstances.size() << " worker instance(s)" << std::endl;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::CopyContributingMCParticles(
+    const Pandora *const pPandora, const CaloHitList &caloHitList, MCParticleSet &copiedMCParticles) const
+{
+    const LArInstrumentationHelper::ScopedTimer timer(*this, "CopyContributingMCParticles");
+
+    MCParticleVector mcParticlesToCopy, mcParticleStack;
+
+    for (const CaloHit *const pCaloHit : caloHitList)
+    {
+        for (const MCParticleWeightMap::value_type &weightMapEntry : pCaloHit->GetMCParticleWeightMap())
+            mcParticleStack.push_back(weightMapEntry.first);
+
+        while (!mcParticleStack.empty())
+        {
+            const MCParticle *const pMCParticle(mcParticleStack.back());
+            mcParticleStack.pop_back();
+
+            if (!copiedMCParticles.insert(pMCParticle).second)
+                continue;
+
+            mcParticlesToCopy.push_back(pMCParticle);
+            mcParticleStack.insert(mcParticleStack.end(), pMCParticle->GetParentList().begin(), pMCParticle->GetParentList().end());
+        }
+    }
+
+    std::sort(mcParticlesToCopy.begin(), mcParticlesToCopy.end(), LArMCParticleHelper::SortByMomentum);
+    LArMCParticleFactory mcParticleFactory;
+
+    for (const MCParticle *const pMCParticle : mcParticlesToCopy)
+    {
+        const LArMCParticle *const pLArMCParticle = dynamic_cast<const LArMCParticle *>(pMCParticle);
+
+        if (!pLArMCParticle)
+        {
+            std::cout << "MasterAlgorithm::CopyContributingMCParticles - Expect to pass only LArMCParticles to Pandora worker instances."
+                      << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
+
+        LArMCParticleParameters parameters;
+        pLArMCParticle->FillParameters(parameters);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::MCParticle::Create(*pPandora, parameters, mcParticleFactory));
+    }
+
+    // ATTN All ancestors are copied, so recreating each link from the daughter side recreates every link between copied mc particles
+    for (const MCParticle *const pMCParticle : mcParticlesToCopy)
+    {
+        for (const MCParticle *const pParentMCParticle : pMCParticle->GetParentList())
+        {
+            PANDORA_RETURN_RESULT_IF(
+                STATUS_CODE_SUCCESS, !=, PandoraApi::SetMCParentDaughterRelationship(*pPandora, pParentMCParticle, pMCParticle));
+        }
+    }
+
+    LArInstrumentationHelper::AddToCounter(*this, "nMCParticlesCopied", static_cast<double>(mcParticlesToCopy.size()));
+
+    if (m_printOverallRecoStatus)
+        std::cout << "Copied " << mcParticlesToCopy.size() << " mc particle(s) to worker instance " << pPandora->GetName() << std::endl;
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -270,6 +441,8 @@ StatusCode MasterAlgorithm::GetVolumeIdToHitListMap(VolumeIdToHitListMap &volume
     const CaloHitList *pCaloHitList(nullptr);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, m_inputHitListName, pCaloHitList));
 
+    LArInstrumentationHelper::AddToCounter(*this, "nInputHits", static_cast<double>(pCaloHitList->size()));
+
     for (const CaloHit *const pCaloHit : *pCaloHitList)
     {
         const LArCaloHit *const pLArCaloHit(dynamic_cast<const LArCaloHit *>(pCaloHit));
@@ -297,6 +470,8 @@ StatusCode MasterAlgorithm::GetVolumeIdToHitListMap(VolumeIdToHitListMap &volume
 
 StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMap &volumeIdToHitListMap) const
 {
+    const LArInstrumentationHelper::ScopedTimer timer(*this, "RunCosmicRayReconstruction");
+
     unsigned int workerCounter(0);
 
     for (const Pandora *const pCRWorker : m_crWorkerInstances)
@@ -307,8 +482,16 @@ StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMa
         if (volumeIdToHitListMap.end() == iter)
             continue;
 
-        for (const CaloHit *const pCaloHit : iter->second.m_allHitList)
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pCRWorker, pCaloHit));
+        HitTransferBlockVector hitTransferBlockVector;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PrepareHitTransfer(iter->second.m_allHitList, hitTransferBlockVector));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pCRWorker, hitTransferBlockVector));
+
+        if (m_passMCParticlesToWorkerInstances && m_filterMCParticlesByHits)
+        {
+            MCParticleSet copiedMCParticles;
+            PANDORA_RETURN_RESULT_IF(
+                STATUS_CODE_SUCCESS, !=, this->CopyContributingMCParticles(pCRWorker, iter->second.m_allHitList, copiedMCParticles));
+        }
 
         if (m_printOverallRecoStatus)
             std::cout << "Running cosmic-ray reconstruction worker instance " << ++workerCounter << " of " << m_crWorkerInstances.size() << std::endl;
@@ -344,6 +527,8 @@ StatusCode MasterAlgorithm::RecreateCosmicRayPfos(PfoToLArTPCMap &pfoToLArTPCMap
 
 StatusCode MasterAlgorithm::StitchCosmicRayPfos(PfoToLArTPCMap &pfoToLArTPCMap, PfoToFloatMap &stitchedPfosToX0Map) const
 {
+    const LArInstrumentationHelper::ScopedTimer timer(*this, "StitchCosmicRayPfos");
+
     const PfoList *pRecreatedCRPfos(nullptr);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(this->GetPandora(), pRecreatedCRPfos));
 
@@ -456,6 +641,10 @@ StatusCode MasterAlgorithm::RunCosmicRayHitRemoval(const PfoList &ambiguousPfos)
 
 StatusCode MasterAlgorithm::RunSlicing(const VolumeIdToHitListMap &volumeIdToHitListMap, SliceVector &sliceVector) const
 {
+    const LArInstrumentationHelper::ScopedTimer timer(*this, "RunSlicing");
+
+    CaloHitList slicingHitList;
+
     for (const VolumeIdToHitListMap::value_type &mapEntry : volumeIdToHitListMap)
     {
         for (const CaloHit *const pCaloHit : (m_shouldRemoveOutOfTimeHits ? mapEntry.second.m_truncatedHitList : mapEntry.second.m_allHitList))
@@ -469,7 +658,7 @@ StatusCode MasterAlgorithm::RunSlicing(const VolumeIdToHitListMap &volumeIdToHit
 
             if (m_shouldRunSlicing)
             {
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSlicingWorkerInstance, pCaloHit));
+                slicingHitList.push_back(pCaloHit);
             }
             else
             {
@@ -482,9 +671,20 @@ StatusCode MasterAlgorithm::RunSlicing(const VolumeIdToHitListMap &volumeIdToHit
 
     if (m_shouldRunSlicing)
     {
+        HitTransferBlockVector hitTransferBlockVector;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PrepareHitTransfer(slicingHitList, hitTransferBlockVector));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSlicingWorkerInstance, hitTransferBlockVector));
+
         if (m_printOverallRecoStatus)
             std::cout << "Running slicing worker instance" << std::endl;
 
+        if (m_passMCParticlesToWorkerInstances && m_filterMCParticlesByHits)
+        {
+            MCParticleSet copiedMCParticles;
+            PANDORA_RETURN_RESULT_IF(
+                STATUS_CODE_SUCCESS, !=, this->CopyContributingMCParticles(m_pSlicingWorkerInstance, slicingHitList, copiedMCParticles));
+        }
+
         const PfoList *pSlicePfos(nullptr);
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSlicingWorkerInstance));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSlicingWorkerInstance, pSlicePfos));
@@ -512,8 +712,12 @@ StatusCode MasterAlgorithm::RunSlicing(const VolumeIdToHitListMap &volumeIdToHit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, SliceHypotheses &nuSliceHypotheses, SliceHypotheses &crSliceHypotheses) const
+StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, SliceHypotheses &nuSliceHypotheses,
+    SliceHypotheses &crSliceHypotheses, BudgetFallbackVector &nuBudgetFallbacks, BudgetFallbackVector &crBudgetFallbacks) const
 {
+    const LArInstrumentationHelper::ScopedTimer timer(*this, "RunSliceReconstruction");
+    LArInstrumentationHelper::AddToCounter(*this, "nSlices", static_cast<double>(sliceVector.size()));
+
     SliceVector selectedSliceVector;
     if (m_shouldRunSlicing && !m_sliceSelectionToolVector.empty())
     {
@@ -529,82 +733,460 @@ StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, Sli
         selectedSliceVector = std::move(sliceVector);
     }
 
-    unsigned int sliceCounter(0);
-
-    for (const CaloHitList &sliceHits : selectedSliceVector)
+    if (m_nSliceThreads > 1)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            this->RunConcurrentSliceReconstruction(
+                selectedSliceVector, nuSliceHypotheses, crSliceHypotheses, nuBudgetFallbacks, crBudgetFallbacks));
+    }
+    else
     {
-        for (const CaloHit *const pSliceCaloHit : sliceHits)
+        unsigned int sliceCounter(0);
+        MCParticleSet nuCopiedMCParticles, crCopiedMCParticles;
+        double nuWorkerTime(0.), crWorkerTime(0.);
+
+        for (const CaloHitList &sliceHits : selectedSliceVector)
         {
-            // ATTN Must ensure we copy the hit actually owned by master instance; access differs with/without slicing enabled
-            const CaloHit *const pCaloHitInMaster(m_shouldRunSlicing ? static_cast<const CaloHit *>(pSliceCaloHit->GetParentAddress()) : pSliceCaloHit);
+            CaloHitList sliceHitsInMaster;
+
+            for (const CaloHit *const pSliceCaloHit : sliceHits)
+            {
+                // ATTN Must ensure we copy the hit actually owned by master instance; access differs with/without slicing enabled
+                const CaloHit *const pCaloHitInMaster(
+                    m_shouldRunSlicing ? static_cast<const CaloHit *>(pSliceCaloHit->GetParentAddress()) : pSliceCaloHit);
+                sliceHitsInMaster.push_back(pCaloHitInMaster);
+            }
+
+            // ATTN The hit parameters are prepared once per slice and shared by the nu and cr workers
+            HitTransferBlockVector hitTransferBlockVector;
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PrepareHitTransfer(sliceHitsInMaster, hitTransferBlockVector));
 
             if (m_shouldRunNeutrinoRecoOption)
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSliceNuWorkerInstance, pCaloHitInMaster));
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSliceNuWorkerInstance, hitTransferBlockVector));
 
             if (m_shouldRunCosmicRecoOption)
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSliceCRWorkerInstance, pCaloHitInMaster));
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSliceCRWorkerInstance, hitTransferBlockVector));
+
+            // ATTN Slice workers are only reset between events, so mc particles copied for earlier slices are not copied again
+            if (m_passMCParticlesToWorkerInstances && m_filterMCParticlesByHits)
+            {
+                if (m_shouldRunNeutrinoRecoOption)
+                {
+                    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                        this->CopyContributingMCParticles(m_pSliceNuWorkerInstance, sliceHitsInMaster, nuCopiedMCParticles));
+                }
+
+                if (m_shouldRunCosmicRecoOption)
+                {
+                    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                        this->CopyContributingMCParticles(m_pSliceCRWorkerInstance, sliceHitsInMaster, crCopiedMCParticles));
+                }
+            }
+
+            if (m_shouldRunNeutrinoRecoOption)
+            {
+                if (m_printOverallRecoStatus)
+                {
+                    std::cout << "Running nu worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size()
+                              << std::endl;
+                }
+
+                PfoList sliceNuPfos;
+                BudgetFallback budgetFallback(BUDGET_FALLBACK_NONE);
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                    this->ProcessSliceWorker(m_pSliceNuWorkerInstance, nuWorkerTime, sliceNuPfos, budgetFallback));
+                nuSliceHypotheses.push_back(sliceNuPfos);
+                nuBudgetFallbacks.push_back(budgetFallback);
+
+                for (const ParticleFlowObject *const pPfo : sliceNuPfos)
+                {
+                    PandoraContentApi::ParticleFlowObject::Metadata metadata;
+                    metadata.m_propertiesToAdd["SliceIndex"] = sliceCounter;
+                    PANDORA_RETURN_RESULT_IF(
+                        STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
+                }
+            }
+
+            if (m_shouldRunCosmicRecoOption)
+            {
+                if (m_printOverallRecoStatus)
+                {
+                    std::cout << "Running cr worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size()
+                              << std::endl;
+                }
+
+                PfoList sliceCRPfos;
+                BudgetFallback budgetFallback(BUDGET_FALLBACK_NONE);
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                    this->ProcessSliceWorker(m_pSliceCRWorkerInstance, crWorkerTime, sliceCRPfos, budgetFallback));
+                crSliceHypotheses.push_back(sliceCRPfos);
+                crBudgetFallbacks.push_back(budgetFallback);
+
+                for (const ParticleFlowObject *const pPfo : sliceCRPfos)
+                {
+                    PandoraContentApi::ParticleFlowObject::Metadata metadata;
+                    metadata.m_propertiesToAdd["SliceIndex"] = sliceCounter;
+                    PANDORA_RETURN_RESULT_IF(
+                        STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
+                }
+            }
+
+            ++sliceCounter;
         }
+    }
 
-        if (m_shouldRunNeutrinoRecoOption)
+    // ATTN: If we swapped these objects at the start, be sure to swap them back in case we ever want to use sliceVector
+    // after this function
+    if (!(m_shouldRunSlicing && !m_sliceSelectionToolVector.empty()))
+        sliceVector = std::move(selectedSliceVector);
+
+    if (m_shouldRunNeutrinoRecoOption && m_shouldRunCosmicRecoOption && (nuSliceHypotheses.size() != crSliceHypotheses.size()))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    PANDORA_RETURN_RESULT_IF(
+        STATUS_CODE_SUCCESS, !=, this->RecordBudgetFallbacks(nuSliceHypotheses, crSliceHypotheses, nuBudgetFallbacks, crBudgetFallbacks));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::RunConcurrentSliceReconstruction(const SliceVector &sliceVector, SliceHypotheses &nuSliceHypotheses,
+    SliceHypotheses &crSliceHypotheses, BudgetFallbackVector &nuBudgetFallbacks, BudgetFallbackVector &crBudgetFallbacks) const
+{
+    const unsigned int nSlices(sliceVector.size());
+    std::vector<CaloHitList> sliceHitLists(nSlices);
+    std::vector<HitTransferBlockVector> sliceHitTransferBlocks(nSlices);
+
+    for (unsigned int sliceIndex = 0; sliceIndex < nSlices; ++sliceIndex)
+    {
+        // ATTN Must ensure we copy the hit actually owned by master instance; access differs with/without slicing enabled
+        for (const CaloHit *const pSliceCaloHit : sliceVector.at(sliceIndex))
         {
-            if (m_printOverallRecoStatus)
-                std::cout << "Running nu worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size() << std::endl;
+            const CaloHit *const pCaloHitInMaster(
+                m_shouldRunSlicing ? static_cast<const CaloHit *>(pSliceCaloHit->GetParentAddress()) : pSliceCaloHit);
+            sliceHitLists[sliceIndex].push_back(pCaloHitInMaster);
+        }
+
+        PANDORA_RETURN_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, this->PrepareHitTransfer(sliceHitLists.at(sliceIndex), sliceHitTransferBlocks.at(sliceIndex)));
+    }
+
+    PandoraInstanceList sliceNuWorkers, sliceCRWorkers;
+
+    if (m_shouldRunNeutrinoRecoOption)
+    {
+        sliceNuWorkers.push_back(m_pSliceNuWorkerInstance);
+        sliceNuWorkers.insert(sliceNuWorkers.end(), m_extraSliceNuWorkerInstances.begin(), m_extraSliceNuWorkerInstances.end());
+        nuSliceHypotheses.assign(nSlices, PfoList());
+        nuBudgetFallbacks.assign(nSlices, BUDGET_FALLBACK_NONE);
+    }
+
+    if (m_shouldRunCosmicRecoOption)
+    {
+        sliceCRWorkers.push_back(m_pSliceCRWorkerInstance);
+        sliceCRWorkers.insert(sliceCRWorkers.end(), m_extraSliceCRWorkerInstances.begin(), m_extraSliceCRWorkerInstances.end());
+        crSliceHypotheses.assign(nSlices, PfoList());
+        crBudgetFallbacks.assign(nSlices, BUDGET_FALLBACK_NONE);
+    }
+
+    // ATTN Each block is contiguous, so the first block is reconstructed exactly as in the serial path
+    const unsigned int nBlocks(std::min(m_nSliceThreads, nSlices));
+
+    if (m_printOverallRecoStatus)
+        std::cout << "Running " << nSlices << " slice(s) in " << nBlocks << " block(s) on concurrent slice worker instances" << std::endl;
+
+    const unsigned int nNuTasks(m_shouldRunNeutrinoRecoOption ? nBlocks : 0), nCRTasks(m_shouldRunCosmicRecoOption ? nBlocks : 0);
+    const unsigned int nTasks(nNuTasks + nCRTasks);
+    std::vector<StatusCode> taskStatusCodes(nTasks, STATUS_CODE_SUCCESS);
+
+    LArParallelHelper::ParallelFor(nTasks, m_nSliceThreads, [&](const unsigned int taskIndex) {
+        const bool isNuTask(taskIndex < nNuTasks);
+        const unsigned int blockIndex(isNuTask ? taskIndex : taskIndex - nNuTasks);
+        const Pandora *const pSliceWorker((isNuTask ? sliceNuWorkers : sliceCRWorkers).at(blockIndex));
+        SliceHypotheses &sliceHypotheses(isNuTask ? nuSliceHypotheses : crSliceHypotheses);
+        BudgetFallbackVector &budgetFallbacks(isNuTask ? nuBudgetFallbacks : crBudgetFallbacks);
+        MCParticleSet copiedMCParticles;
+
+        for (unsigned int sliceIndex = (blockIndex * nSlices) / nBlocks; sliceIndex < ((blockIndex + 1) * nSlices) / nBlocks; ++sliceIndex)
+        {
+            taskStatusCodes[taskIndex] = this->RunSliceWorker(pSliceWorker, sliceHitLists.at(sliceIndex),
+                sliceHitTransferBlocks.at(sliceIndex), copiedMCParticles, sliceHypotheses.at(sliceIndex), budgetFallbacks.at(sliceIndex));
+
+            if (STATUS_CODE_SUCCESS != taskStatusCodes[taskIndex])
+                return;
+        }
+    });
+
+    for (const StatusCode statusCode : taskStatusCodes)
+    {
+        if (STATUS_CODE_SUCCESS != statusCode)
+            return statusCode;
+    }
+
+    if (m_checkSerialEquivalence)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            this->CheckSerialEquivalence(sliceHitLists, sliceHitTransferBlocks, nuSliceHypotheses, crSliceHypotheses));
+    }
 
-            const PfoList *pSliceNuPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceNuWorkerInstance));
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceNuWorkerInstance, pSliceNuPfos));
-            nuSliceHypotheses.push_back(*pSliceNuPfos);
+    for (unsigned int sliceIndex = 0; sliceIndex < nSlices; ++sliceIndex)
+    {
+        for (const SliceHypotheses *const pSliceHypotheses : {&nuSliceHypotheses, &crSliceHypotheses})
+        {
+            if (pSliceHypotheses->empty())
+                continue;
 
-            for (const ParticleFlowObject *const pPfo : *pSliceNuPfos)
+            for (const ParticleFlowObject *const pPfo : pSliceHypotheses->at(sliceIndex))
             {
                 PandoraContentApi::ParticleFlowObject::Metadata metadata;
-                metadata.m_propertiesToAdd["SliceIndex"] = sliceCounter;
+                metadata.m_propertiesToAdd["SliceIndex"] = sliceIndex;
                 PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
             }
         }
+    }
 
-        if (m_shouldRunCosmicRecoOption)
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::RunSliceWorker(const Pandora *const pSliceWorker, const CaloHitList &sliceHitList,
+    const HitTransferBlockVector &hitTransferBlockVector, MCParticleSet &copiedMCParticles, PfoList &slicePfos,
+    BudgetFallback &budgetFallback) const
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pSliceWorker, hitTransferBlockVector));
+
+    // ATTN Slice workers are only reset between events, so mc particles copied for earlier slices are not copied again
+    if (m_passMCParticlesToWorkerInstances && m_filterMCParticlesByHits)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CopyContributingMCParticles(pSliceWorker, sliceHitList, copiedMCParticles));
+
+    double workerTime(0.);
+    return this->ProcessSliceWorker(pSliceWorker, workerTime, slicePfos, budgetFallback);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::CheckSerialEquivalence(const std::vector<CaloHitList> &sliceHitLists,
+    const std::vector<HitTransferBlockVector> &sliceHitTransferBlocks, const SliceHypotheses &nuSliceHypotheses,
+    const SliceHypotheses &crSliceHypotheses) const
+{
+    unsigned int nMismatches(0);
+
+    for (const bool isNuHypothesis : {true, false})
+    {
+        const SliceHypotheses &sliceHypotheses(isNuHypothesis ? nuSliceHypotheses : crSliceHypotheses);
+        const Pandora *const pReferenceWorker(isNuHypothesis ? m_pSliceNuReferenceInstance : m_pSliceCRReferenceInstance);
+        MCParticleSet copiedMCParticles;
+
+        for (unsigned int sliceIndex = 0; sliceIndex < sliceHypotheses.size(); ++sliceIndex)
         {
-            if (m_printOverallRecoStatus)
-                std::cout << "Running cr worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size() << std::endl;
+            PfoList referencePfos;
+            BudgetFallback budgetFallback(BUDGET_FALLBACK_NONE);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                this->RunSliceWorker(pReferenceWorker, sliceHitLists.at(sliceIndex), sliceHitTransferBlocks.at(sliceIndex),
+                    copiedMCParticles, referencePfos, budgetFallback));
 
-            const PfoList *pSliceCRPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceCRWorkerInstance));
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceCRWorkerInstance, pSliceCRPfos));
-            crSliceHypotheses.push_back(*pSliceCRPfos);
+            HypothesisSignature hypothesisSignature, referenceSignature;
+            this->GetHypothesisSignature(sliceHypotheses.at(sliceIndex), hypothesisSignature);
+            this->GetHypothesisSignature(referencePfos, referenceSignature);
 
-            for (const ParticleFlowObject *const pPfo : *pSliceCRPfos)
+            if (hypothesisSignature != referenceSignature)
             {
-                PandoraContentApi::ParticleFlowObject::Metadata metadata;
-                metadata.m_propertiesToAdd["SliceIndex"] = sliceCounter;
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
+                std::cout << "MasterAlgorithm::CheckSerialEquivalence - " << (isNuHypothesis ? "nu" : "cr") << " hypothesis for slice "
+                          << sliceIndex << " differs from the serial reconstruction" << std::endl;
+                ++nMismatches;
             }
         }
+    }
+
+    LArInstrumentationHelper::AddToCounter(*this, "nSerialEquivalenceMismatches", static_cast<double>(nMismatches));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MasterAlgorithm::GetHypothesisSignature(const PfoList &slicePfos, HypothesisSignature &hypothesisSignature) const
+{
+    for (const ParticleFlowObject *const pPfo : slicePfos)
+    {
+        ClusterList clusterList2D, clusterList3D;
+        LArPfoHelper::GetTwoDClusterList(pPfo, clusterList2D);
+        LArPfoHelper::GetThreeDClusterList(pPfo, clusterList3D);
+
+        std::vector<const CaloHit *> parentCaloHits;
+
+        for (const Cluster *const pCluster : clusterList2D)
+        {
+            CaloHitList caloHitList;
+            pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+            caloHitList.insert(caloHitList.end(), pCluster->GetIsolatedCaloHitList().begin(), pCluster->GetIsolatedCaloHitList().end());
 
-        ++sliceCounter;
+            for (const CaloHit *const pCaloHit : caloHitList)
+                parentCaloHits.push_back(static_cast<const CaloHit *>(pCaloHit->GetParentAddress()));
+        }
+
+        std::sort(parentCaloHits.begin(), parentCaloHits.end());
+
+        unsigned int nCaloHits3D(0);
+
+        for (const Cluster *const pCluster : clusterList3D)
+            nCaloHits3D += pCluster->GetNCaloHits() + pCluster->GetNIsolatedCaloHits();
+
+        FloatVector vertexPositions;
+
+        for (const Vertex *const pVertex : pPfo->GetVertexList())
+        {
+            vertexPositions.push_back(pVertex->GetPosition().GetX());
+            vertexPositions.push_back(pVertex->GetPosition().GetY());
+            vertexPositions.push_back(pVertex->GetPosition().GetZ());
+        }
+
+        hypothesisSignature.emplace_back(pPfo->GetParticleId(), static_cast<unsigned int>(pPfo->GetDaughterPfoList().size()), nCaloHits3D,
+            parentCaloHits, vertexPositions);
     }
 
-    // ATTN: If we swapped these objects at the start, be sure to swap them back in case we ever want to use sliceVector
-    // after this function
-    if (!(m_shouldRunSlicing && !m_sliceSelectionToolVector.empty()))
-        sliceVector = std::move(selectedSliceVector);
+    std::sort(hypothesisSignature.begin(), hypothesisSignature.end());
+}
 
-    if (m_shouldRunNeutrinoRecoOption && m_shouldRunCosmicRecoOption && (nuSliceHypotheses.size() != crSliceHypotheses.size()))
-        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::ProcessSliceWorker(
+    const Pandora *const pSliceWorker, double &workerTime, PfoList &slicePfos, BudgetFallback &budgetFallback) const
+{
+    slicePfos.clear();
+    budgetFallback = BUDGET_FALLBACK_NONE;
+
+    float maxTime(m_sliceTimeBudget);
+
+    if (m_workerTimeBudget > 0.f)
+    {
+        const float remainingTime(m_workerTimeBudget - static_cast<float>(workerTime));
+
+        if (remainingTime <= 0.f)
+        {
+            if (m_printOverallRecoStatus)
+            {
+                std::cout << "Skipping slice in worker instance " << pSliceWorker->GetName() << ", which has spent its time budget"
+                          << std::endl;
+            }
+
+            budgetFallback = BUDGET_FALLBACK_SKIPPED;
+            return STATUS_CODE_SUCCESS;
+        }
+
+        maxTime = (maxTime > 0.f) ? std::min(maxTime, remainingTime) : remainingTime;
+    }
+
+    const bool hasBudget((maxTime > 0.f) || (m_sliceWorkBudget > 0));
+
+    if (hasBudget)
+        LArProcessingBudgetHelper::StartBudget(*pSliceWorker, maxTime, m_sliceWorkBudget);
+
+    const std::chrono::steady_clock::time_point startTime(std::chrono::steady_clock::now());
+    const StatusCode statusCode(PandoraApi::ProcessEvent(*pSliceWorker));
+    const std::chrono::duration<double> elapsedTime(std::chrono::steady_clock::now() - startTime);
+    workerTime += elapsedTime.count();
+
+    // ATTN The budget is stopped before any error is returned, so that a failed slice cannot leave a budget on the worker instance
+    const bool isBudgetExhausted(hasBudget && LArProcessingBudgetHelper::StopBudget(*pSliceWorker));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, statusCode);
+
+    const PfoList *pSlicePfos(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*pSliceWorker, pSlicePfos));
+    slicePfos = *pSlicePfos;
+
+    if (isBudgetExhausted)
+    {
+        if (m_printOverallRecoStatus)
+            std::cout << "Slice in worker instance " << pSliceWorker->GetName() << " exhausted its processing budget" << std::endl;
+
+        budgetFallback = BUDGET_FALLBACK_REDUCED_CHAIN;
+    }
 
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode MasterAlgorithm::SelectBestSliceHypotheses(const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses) const
+StatusCode MasterAlgorithm::RecordBudgetFallbacks(const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses,
+    const BudgetFallbackVector &nuBudgetFallbacks, BudgetFallbackVector &crBudgetFallbacks) const
+{
+    // ATTN An over-budget neutrino hypothesis is replaced by the cosmic-ray hypothesis for the slice, provided that it was reconstructed
+    if (m_budgetFallbackToCosmic && m_shouldRunNeutrinoRecoOption && m_shouldRunCosmicRecoOption)
+    {
+        for (unsigned int sliceIndex = 0; sliceIndex < nuBudgetFallbacks.size(); ++sliceIndex)
+        {
+            if ((BUDGET_FALLBACK_NONE != nuBudgetFallbacks.at(sliceIndex)) && (BUDGET_FALLBACK_SKIPPED != crBudgetFallbacks.at(sliceIndex)))
+                crBudgetFallbacks.at(sliceIndex) = BUDGET_FALLBACK_COSMIC_ONLY;
+        }
+    }
+
+    for (const SliceHypotheses *const pSliceHypotheses : {&nuSliceHypotheses, &crSliceHypotheses})
+    {
+        const BudgetFallbackVector &budgetFallbacks((pSliceHypotheses == &nuSliceHypotheses) ? nuBudgetFallbacks : crBudgetFallbacks);
+
+        for (unsigned int sliceIndex = 0; sliceIndex < budgetFallbacks.size(); ++sliceIndex)
+        {
+            const BudgetFallback budgetFallback(budgetFallbacks.at(sliceIndex));
+
+            if (BUDGET_FALLBACK_NONE == budgetFallback)
+                continue;
+
+            LArInstrumentationHelper::AddToCounter(*this, "nBudgetFallbacks");
+
+            for (const ParticleFlowObject *const pPfo : pSliceHypotheses->at(sliceIndex))
+            {
+                PandoraContentApi::ParticleFlowObject::Metadata metadata;
+                metadata.m_propertiesToAdd["BudgetFallback"] = static_cast<float>(budgetFallback);
+                PANDORA_RETURN_RESULT_IF(
+                    STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
+            }
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::SelectBestSliceHypotheses(
+    const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses, const BudgetFallbackVector &crBudgetFallbacks) const
 {
     if (m_printOverallRecoStatus)
         std::cout << "Select best slice hypotheses" << std::endl;
 
     PfoList selectedSlicePfos;
 
-    if (m_shouldPerformSliceId)
+    if (m_shouldPerformSliceId &&
+        (crBudgetFallbacks.end() != std::find(crBudgetFallbacks.begin(), crBudgetFallbacks.end(), BUDGET_FALLBACK_COSMIC_ONLY)))
+    {
+        // ATTN Slices falling back to their cosmic-ray hypothesis bypass slice id, which examines the remaining slices as usual
+        SliceHypotheses sliceIdNuHypotheses, sliceIdCRHypotheses;
+        PfoList fallbackPfos;
+
+        for (unsigned int sliceIndex = 0; sliceIndex < crSliceHypotheses.size(); ++sliceIndex)
+        {
+            if (BUDGET_FALLBACK_COSMIC_ONLY == crBudgetFallbacks.at(sliceIndex))
+            {
+                fallbackPfos.insert(fallbackPfos.end(), crSliceHypotheses.at(sliceIndex).begin(), crSliceHypotheses.at(sliceIndex).end());
+                continue;
+            }
+
+            sliceIdNuHypotheses.push_back(nuSliceHypotheses.at(sliceIndex));
+            sliceIdCRHypotheses.push_back(crSliceHypotheses.at(sliceIndex));
+        }
+
+        if (!sliceIdNuHypotheses.empty())
+        {
+            for (SliceIdBaseTool *const pSliceIdTool : m_sliceIdToolVector)
+                pSliceIdTool->SelectOutputPfos(this, sliceIdNuHypotheses, sliceIdCRHypotheses, selectedSlicePfos);
+        }
+
+        selectedSlicePfos.insert(selectedSlicePfos.end(), fallbackPfos.begin(), fallbackPfos.end());
+    }
+    else if (m_shouldPerformSliceId)
     {
         for (SliceIdBaseTool *const pSliceIdTool : m_sliceIdToolVector)
             pSliceIdTool->SelectOutputPfos(this, nuSliceHypotheses, crSliceHypotheses, selectedSlicePfos);
@@ -639,37 +1221,104 @@ StatusCode MasterAlgorithm::Reset()
     if (m_pSliceCRWorkerInstance)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSliceCRWorkerInstance));
 
+    for (const Pandora *const pSliceWorker : m_extraSliceNuWorkerInstances)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pSliceWorker));
+
+    for (const Pandora *const pSliceWorker : m_extraSliceCRWorkerInstances)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pSliceWorker));
+
+    if (m_pSliceNuReferenceInstance)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSliceNuReferenceInstance));
+
+    if (m_pSliceCRReferenceInstance)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSliceCRReferenceInstance));
+
+    if (m_hasInstrumentationResults && m_instrumentationPerEvent)
+    {
+        m_hasInstrumentationResults = false;
+        PANDORA_RETURN_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, this->WriteInstrumentationResults("event " + std::to_string(m_nInstrumentedEvents - 1)));
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode MasterAlgorithm::WriteInstrumentationResults(const std::string &label) const
+{
+    const StatusCode statusCode(
+        LArInstrumentationHelper::WriteResults(m_instrumentedInstances, m_instrumentationFileName, m_instrumentationFormat, label));
+    LArInstrumentationHelper::ClearResults(m_instrumentedInstances);
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MasterAlgorithm::Copy(const Pandora *const pPandora, const CaloHit *const pCaloHit) const
 {
-    const LArCaloHit *const pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
-    if (pLArCaloHit == nullptr)
+    HitTransferBlockVector hitTransferBlockVector;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PrepareHitTransfer(CaloHitList(1, pCaloHit), hitTransferBlockVector));
+
+    return this->Copy(pPandora, hitTransferBlockVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::PrepareHitTransfer(const CaloHitList &caloHitList, HitTransferBlockVector &hitTransferBlockVector) const
+{
+    hitTransferBlockVector.reserve(hitTransferBlockVector.size() + caloHitList.size());
+
+    for (const CaloHit *const pCaloHit : caloHitList)
     {
-        std::cout << "MasterAlgorithm: Could not cast CaloHit to LArCaloHit" << std::endl;
-        return STATUS_CODE_INVALID_PARAMETER;
+        const LArCaloHit *const pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
+        if (pLArCaloHit == nullptr)
+        {
+            std::cout << "MasterAlgorithm: Could not cast CaloHit to LArCaloHit" << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
+
+        hitTransferBlockVector.emplace_back();
+        HitTransferBlock &hitTransferBlock(hitTransferBlockVector.back());
+        hitTransferBlock.m_pCaloHit = pCaloHit;
+        pLArCaloHit->FillParameters(hitTransferBlock.m_parameters);
+
+        if (!m_passMCParticlesToWorkerInstances)
+            continue;
+
+        MCParticleWeightVector &mcParticleWeightVector(hitTransferBlock.m_mcParticleWeightVector);
+        mcParticleWeightVector.assign(pLArCaloHit->GetMCParticleWeightMap().begin(), pLArCaloHit->GetMCParticleWeightMap().end());
+        std::sort(mcParticleWeightVector.begin(), mcParticleWeightVector.end(),
+            [](const MCParticleWeightVector::value_type &lhs, const MCParticleWeightVector::value_type &rhs)
+            { return LArMCParticleHelper::SortByMomentum(lhs.first, rhs.first); });
     }
-    LArCaloHitParameters parameters;
-    pLArCaloHit->FillParameters(parameters);
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(*pPandora, parameters, m_larCaloHitFactory));
 
-    if (m_passMCParticlesToWorkerInstances)
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::Copy(const Pandora *const pPandora, const HitTransferBlockVector &hitTransferBlockVector) const
+{
+    for (const HitTransferBlock &hitTransferBlock : hitTransferBlockVector)
     {
-        MCParticleVector mcParticleVector;
-        for (const auto &weightMapEntry : pLArCaloHit->GetMCParticleWeightMap())
-            mcParticleVector.push_back(weightMapEntry.first);
-        std::sort(mcParticleVector.begin(), mcParticleVector.end(), LArMCParticleHelper::SortByMomentum);
+        PANDORA_RETURN_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(*pPandora, hitTransferBlock.m_parameters, m_larCaloHitFactory));
+    }
 
-        for (const MCParticle *const pMCParticle : mcParticleVector)
+    for (const HitTransferBlock &hitTransferBlock : hitTransferBlockVector)
+    {
+        for (const MCParticleWeightVector::value_type &mcParticleWeight : hitTransferBlock.m_mcParticleWeightVector)
         {
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
-                PandoraApi::SetCaloHitToMCParticleRelationship(*pPandora, pLArCaloHit, pMCParticle, pLArCaloHit->GetMCParticleWeightMap().at(pMCParticle)));
+                PandoraApi::SetCaloHitToMCParticleRelationship(
+                    *pPandora, hitTransferBlock.m_pCaloHit, mcParticleWeight.first, mcParticleWeight.second));
         }
     }
 
+    LArInstrumentationHelper::AddToCounter(*this, "nHitsCopied", static_cast<double>(hitTransferBlockVector.size()));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -1191,6 +1840,39 @@ StatusCode MasterAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "FullWidthCRWorkerWireGaps", m_fullWidthCRWorkerWireGaps));
 
+    // ATTN Zero threads requests one per hardware thread; slice reconstruction is only concurrent for more than one thread
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NSliceThreads", m_nSliceThreads));
+    m_nSliceThreads = LArParallelHelper::GetNThreads(m_nSliceThreads);
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "CheckSerialEquivalence", m_checkSerialEquivalence));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SliceTimeBudget", m_sliceTimeBudget));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SliceWorkBudget", m_sliceWorkBudget));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "WorkerTimeBudget", m_workerTimeBudget));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "BudgetFallbackToCosmic", m_budgetFallbackToCosmic));
+
+    if ((m_sliceTimeBudget < 0.f) || (m_workerTimeBudget < 0.f))
+    {
+        std::cout << "MasterAlgorithm::ReadSettings - SliceTimeBudget and WorkerTimeBudget must not be negative" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    if ((m_nSliceThreads > 1) && (m_workerTimeBudget > 0.f))
+    {
+        std::cout << "MasterAlgorithm::ReadSettings - WorkerTimeBudget limits the time the slice worker spends on all slices in an event, "
+                  << "so cannot be used with NSliceThreads greater than one" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "PassMCParticlesToWorkerInstances", m_passMCParticlesToWorkerInstances));
 
@@ -1204,9 +1886,28 @@ StatusCode MasterAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     m_nuSettingsFile = LArFileHelper::FindFileInPath(m_nuSettingsFile, m_filePathEnvironmentVariable);
     m_slicingSettingsFile = LArFileHelper::FindFileInPath(m_slicingSettingsFile, m_filePathEnvironmentVariable);
 
+    if (m_nSliceThreads > 1)
+    {
+        for (const std::string &settingsFile : {m_nuSettingsFile, m_crSettingsFile})
+        {
+            bool hasMonitoringContent(false);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArFileHelper::FindMonitoringContent(settingsFile, hasMonitoringContent));
+
+            if (hasMonitoringContent)
+            {
+                std::cout << "MasterAlgorithm::ReadSettings - NSliceThreads greater than one cannot be used with monitoring content in "
+                          << settingsFile << std::endl;
+                return STATUS_CODE_INVALID_PARAMETER;
+            }
+        }
+    }
+
     if (m_passMCParticlesToWorkerInstances)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputMCParticleListName", m_inputMCParticleListName));
+
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+            XmlHelper::ReadValue(xmlHandle, "FilterMCParticlesByHits", m_filterMCParticlesByHits));
     }
 
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputHitListName", m_inputHitListName));
@@ -1215,6 +1916,34 @@ StatusCode MasterAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "RecreatedVertexListName", m_recreatedVertexListName));
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "InTimeMaxX0", m_inTimeMaxX0));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "EnableInstrumentation", m_enableInstrumentation));
+
+    if (m_enableInstrumentation)
+    {
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+            XmlHelper::ReadValue(xmlHandle, "InstrumentationPerEvent", m_instrumentationPerEvent));
+
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+            XmlHelper::ReadValue(xmlHandle, "InstrumentationFileName", m_instrumentationFileName));
+
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+            XmlHelper::ReadValue(xmlHandle, "InstrumentationFormat", m_instrumentationFormat));
+
+        if (("json" != m_instrumentationFormat) && ("csv" != m_instrumentationFormat))
+        {
+            std::cout << "MasterAlgorithm: unknown InstrumentationFormat " << m_instrumentationFormat << ", expected json or csv"
+                      << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
+
+        if (m_instrumentedInstances.empty())
+        {
+            LArInstrumentationHelper::EnableRecording(&this->GetPandora());
+            m_instrumentedInstances.push_back(&this->GetPandora());
+        }
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
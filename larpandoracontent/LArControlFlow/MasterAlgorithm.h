@@ -14,6 +14,7 @@
 #include "larpandoracontent/LArControlFlow/MultiPandoraApi.h"
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 
+#include <tuple>
 #include <unordered_map>
 
 namespace lar_content
@@ -43,6 +44,11 @@ public:
      */
     MasterAlgorithm();
 
+    /**
+     *  @brief  Destructor, writing any per-job instrumentation results
+     */
+    ~MasterAlgorithm();
+
     /**
      *  @brief  External steering parameters class
      */
@@ -93,6 +99,38 @@ protected:
 
     typedef std::map<unsigned int, LArTPCHitList> VolumeIdToHitListMap;
 
+    typedef std::vector<std::pair<const pandora::MCParticle *, float>> MCParticleWeightVector;
+
+    /**
+     *  @brief  HitTransferBlock class, holding everything required to recreate a hit, owned by this instance, in worker instances
+     */
+    class HitTransferBlock
+    {
+    public:
+        const pandora::CaloHit *m_pCaloHit;              ///< The address of the hit owned by this instance
+        LArCaloHitParameters m_parameters;               ///< The parameters with which to create the hit in worker instances
+        MCParticleWeightVector m_mcParticleWeightVector; ///< The mc particle contributions, in the order in which links are recreated
+    };
+
+    typedef std::vector<HitTransferBlock> HitTransferBlockVector;
+
+    /**
+     *  @brief  BudgetFallback enum, describing the reduced processing of a slice hypothesis whose reconstruction exhausted its processing
+     *          budget. Any value other than none is recorded as "BudgetFallback" metadata on the pfos of the hypothesis.
+     */
+    enum BudgetFallback
+    {
+        BUDGET_FALLBACK_NONE = 0,          ///< The hypothesis was reconstructed in full
+        BUDGET_FALLBACK_REDUCED_CHAIN = 1, ///< The hypothesis was reconstructed, but algorithms cut their work short at budget checkpoints
+        BUDGET_FALLBACK_SKIPPED = 2,       ///< The hypothesis was not reconstructed, as its worker had spent its time budget for the event
+        BUDGET_FALLBACK_COSMIC_ONLY = 3    ///< The cosmic-ray hypothesis, output in place of an over-budget neutrino hypothesis
+    };
+
+    typedef std::vector<BudgetFallback> BudgetFallbackVector;
+
+    typedef std::tuple<int, unsigned int, unsigned int, std::vector<const pandora::CaloHit *>, pandora::FloatVector> PfoSignature;
+    typedef std::vector<PfoSignature> HypothesisSignature;
+
     pandora::StatusCode Run();
 
     /**
@@ -101,9 +139,30 @@ protected:
     pandora::StatusCode InitializeWorkerInstances();
 
     /**
-     *  @brief  Copy mc particles in the named input list to all pandora worker instances
+     *  @brief  Get all pandora worker instances created by this master
+     *
+     *  @return the list of worker instances
+     */
+    PandoraInstanceList GetWorkerInstances() const;
+
+    /**
+     *  @brief  Copy mc particles in the named input list to a list of pandora worker instances
+     *
+     *  @param  pandoraWorkerInstances the list of worker instances
+     */
+    pandora::StatusCode CopyMCParticles(const PandoraInstanceList &pandoraWorkerInstances) const;
+
+    /**
+     *  @brief  Copy to a worker instance the mc particles contributing to a list of hits, together with all of their ancestors, skipping
+     *          any mc particles already copied to the worker during this event. Only the parent-daughter links between copied mc
+     *          particles are recreated.
+     *
+     *  @param  pPandora the address of the target pandora instance
+     *  @param  caloHitList the list of hits, owned by this instance, sent to the worker
+     *  @param  copiedMCParticles the mc particles already copied to the worker during this event, to be updated
      */
-    pandora::StatusCode CopyMCParticles() const;
+    pandora::StatusCode CopyContributingMCParticles(
+        const pandora::Pandora *const pPandora, const pandora::CaloHitList &caloHitList, pandora::MCParticleSet &copiedMCParticles) const;
 
     /**
      *  @brief  Get the mapping from lar tpc volume id to lists of all hits, and truncated hits
@@ -165,22 +224,123 @@ protected:
      *  @param  sliceVector the slice vector
      *  @param  nuSliceHypotheses to receive the vector of slice neutrino hypotheses
      *  @param  crSliceHypotheses to receive the vector of slice cosmic-ray hypotheses
+     *  @param  nuBudgetFallbacks to receive the budget fallback applied to each slice neutrino hypothesis
+     *  @param  crBudgetFallbacks to receive the budget fallback applied to each slice cosmic-ray hypothesis
      */
-    pandora::StatusCode RunSliceReconstruction(SliceVector &sliceVector, SliceHypotheses &nuSliceHypotheses, SliceHypotheses &crSliceHypotheses) const;
+    pandora::StatusCode RunSliceReconstruction(SliceVector &sliceVector, SliceHypotheses &nuSliceHypotheses,
+        SliceHypotheses &crSliceHypotheses, BudgetFallbackVector &nuBudgetFallbacks, BudgetFallbackVector &crBudgetFallbacks) const;
+
+    /**
+     *  @brief  Process each slice under different reconstruction hypotheses, using a fixed pool of one neutrino and one cosmic-ray slice
+     *          worker instance per slice thread. The slices are divided into contiguous blocks, one per pair of workers, and each worker
+     *          reconstructs its block in slice order, reset only between events, as the single pair of workers does for all slices when
+     *          running serially. The hypotheses are returned in the original slice order, so the slice id tools see them as usual.
+     *
+     *          The first slice of each block is reconstructed without the earlier slices of the event, so a hypothesis can differ from the
+     *          serial one if the worker content reads objects left by earlier slices. Workers cannot instead be reset before each slice,
+     *          because the hypotheses are owned by the workers until the selected pfos are recreated in this instance, after all slices
+     *          have been reconstructed. The serial equivalence check reports any such differences.
+     *
+     *          Concurrent workers share the process, so the worker content must only modify state owned by its own pandora instance. The
+     *          LArContent reconstruction algorithms and tools meet this: the process-wide caches and registries in LArGeometryHelper,
+     *          LArInstrumentationHelper, LArProcessingBudgetHelper and ClusterMopUpBaseAlgorithm are keyed by pandora instance and
+     *          locked. Monitoring content, which drives the event display or writes root trees, is process-wide and is rejected when
+     *          reading the settings. Printed output from concurrent workers may interleave.
+     *
+     *  @param  sliceVector the slice vector
+     *  @param  nuSliceHypotheses to receive the vector of slice neutrino hypotheses
+     *  @param  crSliceHypotheses to receive the vector of slice cosmic-ray hypotheses
+     *  @param  nuBudgetFallbacks to receive the budget fallback applied to each slice neutrino hypothesis
+     *  @param  crBudgetFallbacks to receive the budget fallback applied to each slice cosmic-ray hypothesis
+     */
+    pandora::StatusCode RunConcurrentSliceReconstruction(const SliceVector &sliceVector, SliceHypotheses &nuSliceHypotheses,
+        SliceHypotheses &crSliceHypotheses, BudgetFallbackVector &nuBudgetFallbacks, BudgetFallbackVector &crBudgetFallbacks) const;
+
+    /**
+     *  @brief  Copy a slice to a slice worker instance and reconstruct it
+     *
+     *  @param  pSliceWorker the address of the slice worker instance
+     *  @param  sliceHitList the list of hits, owned by this instance, in the slice
+     *  @param  hitTransferBlockVector the prepared hit transfer blocks for the slice
+     *  @param  copiedMCParticles the mc particles already copied to the worker during this event, to be updated
+     *  @param  slicePfos to receive the reconstructed pfos
+     *  @param  budgetFallback to receive the budget fallback applied to the slice
+     */
+    pandora::StatusCode RunSliceWorker(const pandora::Pandora *const pSliceWorker, const pandora::CaloHitList &sliceHitList,
+        const HitTransferBlockVector &hitTransferBlockVector, pandora::MCParticleSet &copiedMCParticles, pandora::PfoList &slicePfos,
+        BudgetFallback &budgetFallback) const;
+
+    /**
+     *  @brief  Reconstruct all slices serially on the reference slice worker instances and report each slice hypothesis that differs from
+     *          the concurrent reconstruction. The slice id tools see only the hypotheses, so matching hypotheses give matching selections.
+     *          Differences are only meaningful without time budgets, which depend on the processing speed.
+     *
+     *  @param  sliceHitLists the list of hits, owned by this instance, in each slice
+     *  @param  sliceHitTransferBlocks the prepared hit transfer blocks for each slice
+     *  @param  nuSliceHypotheses the vector of concurrent slice neutrino hypotheses
+     *  @param  crSliceHypotheses the vector of concurrent slice cosmic-ray hypotheses
+     */
+    pandora::StatusCode CheckSerialEquivalence(const std::vector<pandora::CaloHitList> &sliceHitLists,
+        const std::vector<HitTransferBlockVector> &sliceHitTransferBlocks, const SliceHypotheses &nuSliceHypotheses,
+        const SliceHypotheses &crSliceHypotheses) const;
+
+    /**
+     *  @brief  Describe a slice hypothesis, independently of the worker instance that reconstructed it. Each pfo is described by its
+     *          particle id, number of daughters, number of 3D hits, the hits (owned by this instance) behind its 2D hits and its vertex
+     *          positions.
+     *
+     *  @param  slicePfos the pfos in the slice hypothesis
+     *  @param  hypothesisSignature to receive the description of the slice hypothesis
+     */
+    void GetHypothesisSignature(const pandora::PfoList &slicePfos, HypothesisSignature &hypothesisSignature) const;
+
+    /**
+     *  @brief  Reconstruct the slice whose hits have been copied to a slice worker instance, within the configured processing budgets.
+     *          Algorithms in the worker cut their work short once the slice budget is exhausted, and the slice is not reconstructed at all
+     *          if the worker has already spent its time budget for the event.
+     *
+     *  @param  pSliceWorker the address of the slice worker instance
+     *  @param  workerTime the time spent by the worker on earlier slices in this event, to be updated, units s
+     *  @param  slicePfos to receive the reconstructed pfos
+     *  @param  budgetFallback to receive the budget fallback applied to the slice
+     */
+    pandora::StatusCode ProcessSliceWorker(
+        const pandora::Pandora *const pSliceWorker, double &workerTime, pandora::PfoList &slicePfos, BudgetFallback &budgetFallback) const;
+
+    /**
+     *  @brief  Select the cosmic-ray hypothesis for slices whose neutrino hypothesis exhausted its processing budget, if configured, and
+     *          record the budget fallbacks in the metadata of the pfos in each slice hypothesis
+     *
+     *  @param  nuSliceHypotheses the vector of slice neutrino hypotheses
+     *  @param  crSliceHypotheses the vector of slice cosmic-ray hypotheses
+     *  @param  nuBudgetFallbacks the budget fallback applied to each slice neutrino hypothesis
+     *  @param  crBudgetFallbacks the budget fallback applied to each slice cosmic-ray hypothesis, to be updated
+     */
+    pandora::StatusCode RecordBudgetFallbacks(const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses,
+        const BudgetFallbackVector &nuBudgetFallbacks, BudgetFallbackVector &crBudgetFallbacks) const;
 
     /**
      *  @brief  Examine slice hypotheses to identify the most appropriate to provide in final event output
      *
      *  @param  nuSliceHypotheses the vector of slice neutrino hypotheses
      *  @param  crSliceHypotheses the vector of slice cosmic-ray hypotheses
+     *  @param  crBudgetFallbacks the budget fallback applied to each slice cosmic-ray hypothesis, identifying slices that bypass slice id
      */
-    pandora::StatusCode SelectBestSliceHypotheses(const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses) const;
+    pandora::StatusCode SelectBestSliceHypotheses(const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses,
+        const BudgetFallbackVector &crBudgetFallbacks) const;
 
     /**
-     *  @brief  Reset all worker instances
+     *  @brief  Reset all worker instances and write any per-event instrumentation results
      */
     pandora::StatusCode Reset();
 
+    /**
+     *  @brief  Write and clear the instrumentation results recorded for this master and its workers
+     *
+     *  @param  label the label identifying the block of results
+     */
+    pandora::StatusCode WriteInstrumentationResults(const std::string &label) const;
+
     /**
      *  @brief  Copy a specified calo hit to the provided pandora instance
      *
@@ -189,6 +349,22 @@ protected:
      */
     pandora::StatusCode Copy(const pandora::Pandora *const pPandora, const pandora::CaloHit *const pCaloHit) const;
 
+    /**
+     *  @brief  Prepare the transfer blocks for a list of hits, so that the hits can be copied to any number of worker instances
+     *
+     *  @param  caloHitList the list of hits owned by this instance
+     *  @param  hitTransferBlockVector to receive the hit transfer blocks
+     */
+    pandora::StatusCode PrepareHitTransfer(const pandora::CaloHitList &caloHitList, HitTransferBlockVector &hitTransferBlockVector) const;
+
+    /**
+     *  @brief  Copy a prepared block of hits to the provided pandora instance, creating all hits before recreating their mc links
+     *
+     *  @param  pPandora the address of the target pandora instance
+     *  @param  hitTransferBlockVector the hit transfer blocks
+     */
+    pandora::StatusCode Copy(const pandora::Pandora *const pPandora, const HitTransferBlockVector &hitTransferBlockVector) const;
+
     /**
      *  @brief  Copy a specified mc particle to the provided pandora instance
      *
@@ -327,8 +503,21 @@ protected:
     const pandora::Pandora *m_pSliceNuWorkerInstance; ///< The per-slice neutrino reconstruction worker instance
     const pandora::Pandora *m_pSliceCRWorkerInstance; ///< The per-slice cosmic-ray reconstruction worker instance
 
+    unsigned int m_nSliceThreads;                        ///< The number of threads, and pairs of slice workers, for slice reconstruction
+    PandoraInstanceList m_extraSliceNuWorkerInstances;   ///< The neutrino workers for the second and later slice threads
+    PandoraInstanceList m_extraSliceCRWorkerInstances;   ///< The cosmic-ray workers for the second and later slice threads
+    bool m_checkSerialEquivalence;                       ///< Whether to compare concurrent slice hypotheses with a serial reconstruction
+    const pandora::Pandora *m_pSliceNuReferenceInstance; ///< The neutrino worker for the serial equivalence check
+    const pandora::Pandora *m_pSliceCRReferenceInstance; ///< The cosmic-ray worker for the serial equivalence check
+
+    float m_sliceTimeBudget;        ///< The max time to reconstruct each slice hypothesis, units s, or zero for no limit
+    unsigned int m_sliceWorkBudget; ///< The max work units, counted at algorithm checkpoints, per slice hypothesis, or zero for no limit
+    float m_workerTimeBudget;       ///< The max time each slice worker may spend per event, units s, or zero for no limit
+    bool m_budgetFallbackToCosmic;  ///< Whether slices with an over-budget neutrino hypothesis should output their cosmic-ray hypothesis
+
     bool m_fullWidthCRWorkerWireGaps;        ///< Whether wire-type line gaps in cosmic-ray worker instances should cover all drift time
     bool m_passMCParticlesToWorkerInstances; ///< Whether to pass mc particle details (and links to calo hits) to worker instances
+    bool m_filterMCParticlesByHits;          ///< Whether to pass each worker, before it runs, only the mc particles behind its hits
 
     typedef std::vector<StitchingBaseTool *> StitchingToolVector;
     typedef std::vector<CosmicRayTaggingBaseTool *> CosmicRayTaggingToolVector;
@@ -353,6 +542,14 @@ protected:
 
     float m_inTimeMaxX0;                   ///< Cut on X0 to determine whether particle is clear cosmic ray
     LArCaloHitFactory m_larCaloHitFactory; ///< Factory for creating LArCaloHits during hit copying
+
+    bool m_enableInstrumentation;                ///< Whether to record the timers and counters emitted by algorithms and algorithm tools
+    bool m_instrumentationPerEvent;              ///< Whether to write instrumentation results after each event, rather than once per job
+    std::string m_instrumentationFileName;       ///< The instrumentation output file name
+    std::string m_instrumentationFormat;         ///< The instrumentation output format, json or csv
+    unsigned int m_nInstrumentedEvents;          ///< The number of events processed with instrumentation enabled
+    bool m_hasInstrumentationResults;            ///< Whether instrumentation results have been recorded since they were last written
+    PandoraInstanceList m_instrumentedInstances; ///< This master and the workers for which it enabled instrumentation recording
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -11,6 +11,10 @@
 
 #include "larpandoracontent/LArControlFlow/MultiPandoraApiImpl.h"
 
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+
+#include "larpandoracontent/LArTwoDReco/LArClusterMopUp/ClusterMopUpBaseAlgorithm.h"
+
 const PandoraInstanceMap &MultiPandoraApiImpl::GetPandoraInstanceMap() const
 {
     return m_primaryToDaughtersMap;
@@ -148,6 +152,8 @@ void MultiPandoraApiImpl::DeletePandoraInstances(const pandora::Pandora *const p
     {
         m_pandoraToVolumeIdMap.erase(pPandora);
         m_daughterToPrimaryMap.erase(pPandora);
+        lar_content::LArGeometryHelper::ReleaseGeometrySummary(*pPandora);
+        lar_content::ClusterMopUpBaseAlgorithm::ReleaseShowerFitCache(*pPandora);
         delete pPandora;
     }
 }
@@ -28,6 +28,7 @@ namespace lar_content
 template <typename T>
 NeutrinoIdTool<T>::NeutrinoIdTool() :
     m_useTrainingMode(false),
+    m_trainingOutputFormat("csv"),
     m_selectNuanceCode(false),
     m_nuance(-std::numeric_limits<int>::max()),
     m_minPurity(0.9f),
@@ -73,7 +74,7 @@ void NeutrinoIdTool<T>::SelectOutputPfos(const Algorithm *const pAlgorithm, cons
 
             LArMvaHelper::MvaFeatureVector featureVector;
             features.GetFeatureVector(featureVector);
-            LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, sliceIndex == bestSliceIndex, featureVector);
+            LArMvaHelper::ProduceTrainingExample(m_trainingSink, m_trainingOutputFile, sliceIndex == bestSliceIndex, featureVector);
         }
 
         return;
@@ -598,6 +599,9 @@ StatusCode NeutrinoIdTool<T>::ReadSettings(const TiXmlHandle xmlHandle)
     if (m_useTrainingMode)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFileName", m_trainingOutputFile));
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFormat", m_trainingOutputFormat));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_trainingSink.SetFormat(m_trainingOutputFormat));
     }
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MinimumPurity", m_minPurity));
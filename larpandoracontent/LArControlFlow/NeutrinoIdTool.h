@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArControlFlow/MasterAlgorithm.h"
 
 #include "larpandoracontent/LArObjects/LArAdaBoostDecisionTree.h"
+#include "larpandoracontent/LArObjects/LArMvaTrainingSink.h"
 #include "larpandoracontent/LArObjects/LArSupportVectorMachine.h"
 
 #include <functional>
@@ -257,11 +258,13 @@ private:
 
     // Training
     bool m_useTrainingMode;           ///< Should use training mode. If true, training examples will be written to the output file
-    std::string m_trainingOutputFile; ///< Output file name for training examples
-    bool m_selectNuanceCode;          ///< Should select training events by nuance code
-    int m_nuance;                     ///< Nuance code to select for training
-    float m_minPurity;                ///< Minimum purity of the best slice to use event for training
-    float m_minCompleteness;          ///< Minimum completeness of the best slice to use event for training
+    std::string m_trainingOutputFile;   ///< Output file name for training examples
+    std::string m_trainingOutputFormat; ///< Output format for training examples, csv or binary
+    MvaTrainingSink m_trainingSink;     ///< The sink buffering the training examples
+    bool m_selectNuanceCode;            ///< Should select training events by nuance code
+    int m_nuance;                       ///< Nuance code to select for training
+    float m_minPurity;                  ///< Minimum purity of the best slice to use event for training
+    float m_minCompleteness;            ///< Minimum completeness of the best slice to use event for training
 
     // Classification
     float m_minProbability;      ///< Minimum probability required to classify a slice as the neutrino
@@ -0,0 +1,311 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/ShardedEventProcessingAlgorithm.cc
+ *
+ *  @brief  Implementation of the sharded event processing algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+
+#include "Pandora/AlgorithmHeaders.h"
+#include "Pandora/ExternallyConfiguredAlgorithm.h"
+
+#include "larpandoracontent/LArContent.h"
+#include "larpandoracontent/LArControlFlow/ShardedEventProcessingAlgorithm.h"
+
+#include "larpandoracontent/LArHelpers/LArFileHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
+
+#include "larpandoracontent/LArPersistency/EventReadingAlgorithm.h"
+#include "larpandoracontent/LArPersistency/EventWritingAlgorithm.h"
+
+#include "larpandoracontent/LArPlugins/LArPseudoLayerPlugin.h"
+#include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
+
+#include <cstdio>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+ShardedEventProcessingAlgorithm::ShardedEventProcessingAlgorithm() :
+    m_isFirstRoundProcessed(false),
+    m_nShards(0),
+    m_filePathEnvironmentVariable("FW_SEARCH_PATH"),
+    m_skipToEvent(0),
+    m_removeShardFiles(true)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ShardedEventProcessingAlgorithm::~ShardedEventProcessingAlgorithm()
+{
+    // ATTN The shard instances may already have been deleted with all other instances registered with the multi pandora api
+    for (const Pandora *const pShardPandora : m_shardInstances)
+    {
+        if (MultiPandoraApi::GetPandoraInstanceMap().count(pShardPandora))
+            MultiPandoraApi::DeletePandoraInstances(pShardPandora);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ShardedEventProcessingAlgorithm::Initialize()
+{
+    for (unsigned int shardIndex = 0; shardIndex < m_nShards; ++shardIndex)
+    {
+        EventReadingAlgorithm::ExternalEventReadingParameters *const pReadingParameters(
+            new EventReadingAlgorithm::ExternalEventReadingParameters);
+        pReadingParameters->m_geometryFileName = m_geometryFileName;
+        pReadingParameters->m_eventFileNameList = m_eventFileNameList;
+        pReadingParameters->m_skipToEvent = m_skipToEvent + shardIndex;
+        pReadingParameters->m_eventStride = m_nShards;
+        pReadingParameters->m_interleaveEventFiles = false;
+
+        EventWritingAlgorithm::ExternalEventWritingParameters *pWritingParameters(nullptr);
+
+        if (!m_outputFileName.empty())
+        {
+            pWritingParameters = new EventWritingAlgorithm::ExternalEventWritingParameters;
+            pWritingParameters->m_eventFileName = m_shardFileNames.at(shardIndex);
+            pWritingParameters->m_shouldOverwriteEventFile = true;
+        }
+
+        const Pandora *const pShardPandora(this->CreatePandoraInstance(
+            "Shard" + std::to_string(shardIndex), m_shardSettingsFile, pReadingParameters, pWritingParameters));
+        m_shardInstances.push_back(pShardPandora);
+    }
+
+    m_activeShardInstances = m_shardInstances;
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ShardedEventProcessingAlgorithm::Run()
+{
+    const unsigned int nActiveShards(m_activeShardInstances.size());
+    std::vector<StatusCode> shardStatusCodes(nActiveShards, STATUS_CODE_SUCCESS);
+
+    // ATTN Not a bool vector, whose elements share storage and so cannot be written by concurrent tasks
+    std::vector<unsigned char> isShardExhausted(nActiveShards, 0);
+
+    // ATTN The first round is run on the calling thread: content such as the master algorithm creates and registers its worker instances
+    // with the multi pandora api, which is not thread safe, when processing its first event. Later rounds only read these registrations.
+    LArParallelHelper::ParallelFor(nActiveShards, m_isFirstRoundProcessed ? nActiveShards : 1, [&](const unsigned int shardIndex) {
+        const Pandora *const pShardPandora(m_activeShardInstances.at(shardIndex));
+
+        try
+        {
+            shardStatusCodes[shardIndex] = PandoraApi::ProcessEvent(*pShardPandora);
+
+            if (STATUS_CODE_SUCCESS == shardStatusCodes[shardIndex])
+                shardStatusCodes[shardIndex] = PandoraApi::Reset(*pShardPandora);
+        }
+        catch (const StopProcessingException &)
+        {
+            isShardExhausted[shardIndex] = 1;
+        }
+    });
+
+    m_isFirstRoundProcessed = true;
+
+    for (const StatusCode statusCode : shardStatusCodes)
+    {
+        if (STATUS_CODE_SUCCESS != statusCode)
+            return statusCode;
+    }
+
+    PandoraInstanceList activeShardInstances;
+
+    for (unsigned int shardIndex = 0; shardIndex < nActiveShards; ++shardIndex)
+    {
+        if (!isShardExhausted.at(shardIndex))
+            activeShardInstances.push_back(m_activeShardInstances.at(shardIndex));
+    }
+
+    m_activeShardInstances = activeShardInstances;
+
+    if (!m_activeShardInstances.empty())
+        return STATUS_CODE_SUCCESS;
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->FinishShardInstances());
+    throw StopProcessingException("All event shards processed");
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const Pandora *ShardedEventProcessingAlgorithm::CreatePandoraInstance(const std::string &name, const std::string &settingsFile,
+    ExternalParameters *const pReadingParameters, ExternalParameters *const pWritingParameters) const
+{
+    const Pandora *const pPandora(new Pandora(name));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterAlgorithms(*pPandora));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterBasicPlugins(*pPandora));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(*pPandora, new lar_content::LArPseudoLayerPlugin));
+    PANDORA_THROW_RESULT_IF(
+        STATUS_CODE_SUCCESS, !=, PandoraApi::SetLArTransformationPlugin(*pPandora, new lar_content::LArRotationalTransformationPlugin));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RegisterCustomContent(pPandora));
+    MultiPandoraApi::AddPrimaryPandoraInstance(pPandora);
+
+    PANDORA_THROW_RESULT_IF(
+        STATUS_CODE_SUCCESS, !=, ExternallyConfiguredAlgorithm::SetExternalParameters(*pPandora, "LArEventReading", pReadingParameters));
+
+    if (pWritingParameters)
+    {
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            ExternallyConfiguredAlgorithm::SetExternalParameters(*pPandora, "LArEventWriting", pWritingParameters));
+    }
+
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(*pPandora, settingsFile));
+    return pPandora;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ShardedEventProcessingAlgorithm::FinishShardInstances()
+{
+    // ATTN Deleting the shard instances closes their event writers, so that the shard output files are complete before they are merged
+    for (const Pandora *const pShardPandora : m_shardInstances)
+        MultiPandoraApi::DeletePandoraInstances(pShardPandora);
+
+    m_shardInstances.clear();
+
+    if (m_outputFileName.empty())
+        return STATUS_CODE_SUCCESS;
+
+    return this->MergeShardOutputFiles();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ShardedEventProcessingAlgorithm::MergeShardOutputFiles() const
+{
+    // ATTN Shard i holds events i, i + n, i + 2n, ..., so reading one event from each shard file in turn, until the first exhausted file,
+    // restores the input event order
+    std::string shardFileNameList;
+
+    for (const std::string &shardFileName : m_shardFileNames)
+        shardFileNameList += (shardFileNameList.empty() ? "" : ":") + shardFileName;
+
+    EventReadingAlgorithm::ExternalEventReadingParameters *const pReadingParameters(
+        new EventReadingAlgorithm::ExternalEventReadingParameters);
+    pReadingParameters->m_geometryFileName = m_geometryFileName;
+    pReadingParameters->m_eventFileNameList = shardFileNameList;
+    pReadingParameters->m_skipToEvent = 0;
+    pReadingParameters->m_eventStride = 1;
+    pReadingParameters->m_interleaveEventFiles = true;
+
+    EventWritingAlgorithm::ExternalEventWritingParameters *const pWritingParameters(
+        new EventWritingAlgorithm::ExternalEventWritingParameters);
+    pWritingParameters->m_eventFileName = m_outputFileName;
+
+    const Pandora *const pMergePandora(
+        this->CreatePandoraInstance("ShardMerge", m_mergeSettingsFile, pReadingParameters, pWritingParameters));
+    StatusCode statusCode(STATUS_CODE_SUCCESS);
+
+    try
+    {
+        while (STATUS_CODE_SUCCESS == statusCode)
+        {
+            statusCode = PandoraApi::ProcessEvent(*pMergePandora);
+
+            if (STATUS_CODE_SUCCESS == statusCode)
+                statusCode = PandoraApi::Reset(*pMergePandora);
+        }
+    }
+    catch (const StopProcessingException &)
+    {
+    }
+
+    MultiPandoraApi::DeletePandoraInstances(pMergePandora);
+
+    if (STATUS_CODE_SUCCESS != statusCode)
+    {
+        std::cout << "ShardedEventProcessingAlgorithm: failed to merge shard output files, which are kept" << std::endl;
+        return statusCode;
+    }
+
+    if (m_removeShardFiles)
+    {
+        for (const std::string &shardFileName : m_shardFileNames)
+            std::remove(shardFileName.c_str());
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ShardedEventProcessingAlgorithm::RegisterCustomContent(const Pandora *const /*pPandora*/) const
+{
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ShardedEventProcessingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NShards", m_nShards));
+    m_nShards = LArParallelHelper::GetNThreads(m_nShards);
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "FilePathEnvironmentVariable", m_filePathEnvironmentVariable));
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "ShardSettingsFile", m_shardSettingsFile));
+    m_shardSettingsFile = LArFileHelper::FindFileInPath(m_shardSettingsFile, m_filePathEnvironmentVariable);
+
+    if (m_nShards > 1)
+    {
+        bool hasMonitoringContent(false);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArFileHelper::FindMonitoringContent(m_shardSettingsFile, hasMonitoringContent));
+
+        if (hasMonitoringContent)
+        {
+            std::cout << "ShardedEventProcessingAlgorithm::ReadSettings - NShards greater than one cannot be used with monitoring "
+                      << "content in " << m_shardSettingsFile << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
+    }
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "GeometryFileName", m_geometryFileName));
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "EventFileNameList", m_eventFileNameList));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SkipToEvent", m_skipToEvent));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "OutputFileName", m_outputFileName));
+
+    if (!m_outputFileName.empty())
+    {
+        const size_t extensionPosition(m_outputFileName.find_last_of("."));
+
+        if (std::string::npos == extensionPosition)
+        {
+            std::cout << "ShardedEventProcessingAlgorithm::ReadSettings - output file name requires an .xml or .pndr extension"
+                      << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
+
+        for (unsigned int shardIndex = 0; shardIndex < m_nShards; ++shardIndex)
+        {
+            m_shardFileNames.push_back(m_outputFileName.substr(0, extensionPosition) + ".shard" + std::to_string(shardIndex) +
+                m_outputFileName.substr(extensionPosition));
+        }
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "MergeSettingsFile", m_mergeSettingsFile));
+        m_mergeSettingsFile = LArFileHelper::FindFileInPath(m_mergeSettingsFile, m_filePathEnvironmentVariable);
+
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "RemoveShardFiles", m_removeShardFiles));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_content
@@ -0,0 +1,109 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/ShardedEventProcessingAlgorithm.h
+ *
+ *  @brief  Header file for the sharded event processing algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_SHARDED_EVENT_PROCESSING_ALGORITHM_H
+#define LAR_SHARDED_EVENT_PROCESSING_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+#include "larpandoracontent/LArControlFlow/MultiPandoraApi.h"
+
+namespace pandora
+{
+class ExternalParameters;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ShardedEventProcessingAlgorithm class
+ *
+ *          Drives a number of shard pandora instances in the same process, each configured from the same settings file. Shard i reads
+ *          events i, i + n, i + 2n, ... of the input event files via its LArEventReading algorithm, so that the shards partition the input
+ *          events, and each call to Run processes the next event in every shard concurrently. Each shard parses its own settings, but bdt
+ *          models named in the settings are read once and shared between the shards. If an output file is named, each shard writes the
+ *          events it reads via its LArEventWriting algorithm to its own file and, once all shards are exhausted, a merge instance reads the
+ *          shard files one event from each in turn, restoring the input event order, and writes the merged output. This requires that the
+ *          shard event writing is not filtered, so that every shard writes every event it reads. When all events have been processed, Run
+ *          throws a StopProcessingException, as does the event reading algorithm.
+ */
+class ShardedEventProcessingAlgorithm : public pandora::Algorithm
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    ShardedEventProcessingAlgorithm();
+
+    /**
+     *  @brief  Destructor
+     */
+    ~ShardedEventProcessingAlgorithm();
+
+protected:
+    /**
+     *  @brief  Register custom content, such as algorithms or algorithm tools, with a specified pandora instance
+     *
+     *  @param  pPandora the address of the pandora instance
+     */
+    virtual pandora::StatusCode RegisterCustomContent(const pandora::Pandora *const pPandora) const;
+
+private:
+    pandora::StatusCode Initialize();
+    pandora::StatusCode Run();
+
+    /**
+     *  @brief  Create a primary pandora instance, configured from a settings file
+     *
+     *  @param  name the name of the pandora instance
+     *  @param  settingsFile the settings file
+     *  @param  pReadingParameters the external event reading parameters, to be owned by the pandora instance
+     *  @param  pWritingParameters the external event writing parameters, to be owned by the pandora instance (nullptr for none)
+     *
+     *  @return the address of the pandora instance
+     */
+    const pandora::Pandora *CreatePandoraInstance(const std::string &name, const std::string &settingsFile,
+        pandora::ExternalParameters *const pReadingParameters, pandora::ExternalParameters *const pWritingParameters) const;
+
+    /**
+     *  @brief  Delete the shard instances, closing their output files, and merge the shard output files in event order
+     *
+     *  @return success
+     */
+    pandora::StatusCode FinishShardInstances();
+
+    /**
+     *  @brief  Merge the shard output files, reading one event from each in turn, and remove them if required
+     *
+     *  @return success
+     */
+    pandora::StatusCode MergeShardOutputFiles() const;
+
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    PandoraInstanceList m_shardInstances;       ///< The shard instances, in shard index order
+    PandoraInstanceList m_activeShardInstances; ///< The shard instances not yet exhausted, in shard index order
+    pandora::StringVector m_shardFileNames;     ///< The output file name for each shard, if an output file is named
+    bool m_isFirstRoundProcessed;               ///< Whether the first event in each shard has been processed
+
+    unsigned int m_nShards;                    ///< The number of shard instances, zero requesting the hardware concurrency
+    std::string m_shardSettingsFile;           ///< The settings file for the shard instances
+    std::string m_mergeSettingsFile;           ///< The settings file for the instance merging the shard output files
+    std::string m_filePathEnvironmentVariable; ///< The environment variable providing a list of paths to the settings files
+    std::string m_geometryFileName;            ///< Name of the file containing geometry information, if not named in the settings
+    std::string m_eventFileNameList;           ///< Colon-separated list of event file names to be processed
+    unsigned int m_skipToEvent;                ///< Index of the first event to consider in the input files
+    std::string m_outputFileName;              ///< Name of the merged output event file (empty for no output)
+    bool m_removeShardFiles;                   ///< Whether to remove the shard output files once merged
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_SHARDED_EVENT_PROCESSING_ALGORITHM_H
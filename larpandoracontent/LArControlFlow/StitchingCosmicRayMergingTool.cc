@@ -57,8 +57,14 @@ void StitchingCosmicRayMergingTool::Run(const MasterAlgorithm *const pAlgorithm,
     ThreeDPointingClusterMap pointingClusterMap;
     this->BuildPointingClusterMaps(primaryPfos, pfoToLArTPCMap, pointingClusterMap);
 
+    PfoList candidatePfos;
+    this->SelectStitchingCandidates(primaryPfos, pointingClusterMap, candidatePfos);
+
+    if (m_stitchableTPCMap.empty())
+        this->BuildStitchableTPCMap();
+
     LArTPCToPfoMap larTPCToPfoMap;
-    this->BuildTPCMaps(primaryPfos, pfoToLArTPCMap, larTPCToPfoMap);
+    this->BuildTPCMaps(candidatePfos, pfoToLArTPCMap, larTPCToPfoMap);
 
     PfoAssociationMatrix pfoAssociationMatrix;
     this->CreatePfoMatches(larTPCToPfoMap, pointingClusterMap, pfoAssociationMatrix);
@@ -95,6 +101,30 @@ void StitchingCosmicRayMergingTool::SelectPrimaryPfos(const PfoList *pInputPfoLi
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void StitchingCosmicRayMergingTool::BuildStitchableTPCMap()
+{
+    const LArTPCMap &larTPCMap(this->GetPandora().GetGeometry()->GetLArTPCMap());
+
+    LArTPCVector larTPCVector;
+    for (const LArTPCMap::value_type &mapEntry : larTPCMap)
+        larTPCVector.push_back(mapEntry.second);
+    std::sort(larTPCVector.begin(), larTPCVector.end(), LArStitchingHelper::SortTPCs);
+
+    // ATTN Keyed by volume id, as the pfos refer to the (identically configured) tpcs owned by the cosmic-ray worker instances
+    for (LArTPCVector::const_iterator tpcIter1 = larTPCVector.begin(), tpcIterEnd = larTPCVector.end(); tpcIter1 != tpcIterEnd; ++tpcIter1)
+    {
+        std::vector<unsigned int> &stitchableVolumeIds(m_stitchableTPCMap[(*tpcIter1)->GetLArTPCVolumeId()]);
+
+        for (LArTPCVector::const_iterator tpcIter2 = std::next(tpcIter1); tpcIter2 != tpcIterEnd; ++tpcIter2)
+        {
+            if (LArStitchingHelper::CanTPCsBeStitched(**tpcIter1, **tpcIter2))
+                stitchableVolumeIds.push_back((*tpcIter2)->GetLArTPCVolumeId());
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void StitchingCosmicRayMergingTool::BuildPointingClusterMaps(
     const PfoList &inputPfoList, const PfoToLArTPCMap &pfoToLArTPCMap, ThreeDPointingClusterMap &pointingClusterMap) const
 {
@@ -126,6 +156,33 @@ void StitchingCosmicRayMergingTool::BuildPointingClusterMaps(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void StitchingCosmicRayMergingTool::SelectStitchingCandidates(
+    const PfoList &inputPfoList, const ThreeDPointingClusterMap &pointingClusterMap, PfoList &candidatePfoList) const
+{
+    for (const ParticleFlowObject *const pPfo : inputPfoList)
+    {
+        ThreeDPointingClusterMap::const_iterator iter(pointingClusterMap.find(pPfo));
+
+        if (pointingClusterMap.end() == iter)
+            continue;
+
+        // Check length of pointing cluster
+        if (iter->second.GetLengthSquared() < m_minLengthSquared)
+            continue;
+
+        // Check number of 3D hits in the pfo
+        CaloHitList caloHitList3D;
+        LArPfoHelper::GetCaloHits(pPfo, TPC_3D, caloHitList3D);
+
+        if (caloHitList3D.size() < m_minNCaloHits3D)
+            continue;
+
+        candidatePfoList.push_back(pPfo);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void StitchingCosmicRayMergingTool::BuildTPCMaps(const PfoList &inputPfoList, const PfoToLArTPCMap &pfoToLArTPCMap, LArTPCToPfoMap &larTPCToPfoMap) const
 {
     for (const ParticleFlowObject *const pPfo : inputPfoList)
@@ -143,26 +200,68 @@ void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPCToPfoMap &larTP
     const ThreeDPointingClusterMap &pointingClusterMap, PfoAssociationMatrix &pfoAssociationMatrix) const
 {
     LArTPCVector larTPCVector;
+    std::unordered_map<unsigned int, const LArTPC *> volumeIdToLArTPCMap;
+
     for (const auto &mapEntry : larTPCToPfoMap)
+    {
         larTPCVector.push_back(mapEntry.first);
+        volumeIdToLArTPCMap[mapEntry.first->GetLArTPCVolumeId()] = mapEntry.first;
+    }
     std::sort(larTPCVector.begin(), larTPCVector.end(), LArStitchingHelper::SortTPCs);
 
-    for (LArTPCVector::const_iterator tpcIter1 = larTPCVector.begin(), tpcIterEnd = larTPCVector.end(); tpcIter1 != tpcIterEnd; ++tpcIter1)
+    // ATTN Tolerance ensures that rounding cannot remove any pair that would pass the x intersection cut in the detailed matching
+    const float displacementTolerance(0.1f);
+
+    for (const LArTPC *const pLArTPC1 : larTPCVector)
     {
-        const LArTPC *const pLArTPC1(*tpcIter1);
+        StitchableTPCMap::const_iterator stitchableIter(m_stitchableTPCMap.find(pLArTPC1->GetLArTPCVolumeId()));
+
+        if (m_stitchableTPCMap.end() == stitchableIter)
+            continue;
+
         const PfoList &pfoList1(larTPCToPfoMap.at(pLArTPC1));
 
-        for (LArTPCVector::const_iterator tpcIter2 = tpcIter1; tpcIter2 != tpcIterEnd; ++tpcIter2)
+        for (const unsigned int volumeId2 : stitchableIter->second)
         {
-            const LArTPC *const pLArTPC2(*tpcIter2);
-            const PfoList &pfoList2(larTPCToPfoMap.at(pLArTPC2));
+            std::unordered_map<unsigned int, const LArTPC *>::const_iterator tpcIter2(volumeIdToLArTPCMap.find(volumeId2));
 
-            if (!LArStitchingHelper::CanTPCsBeStitched(*pLArTPC1, *pLArTPC2))
+            if (volumeIdToLArTPCMap.end() == tpcIter2)
                 continue;
 
-            for (const ParticleFlowObject *const pPfo1 : pfoList1)
+            const LArTPC *const pLArTPC2(tpcIter2->second);
+            const PfoList &pfoList2(larTPCToPfoMap.at(pLArTPC2));
+
+            // A pair can only be associated if the mean x of its stitching vertices lies within the maximum longitudinal displacement
+            // of the boundary, i.e. if the boundary displacements of one endpoint from each pointing cluster approximately cancel
+            const float boundaryCenterX(LArStitchingHelper::GetTPCBoundaryCenterX(*pLArTPC1, *pLArTPC2));
+            const float boundaryWidthX(LArStitchingHelper::GetTPCBoundaryWidthX(*pLArTPC1, *pLArTPC2));
+            const float maxDisplacementSum(2.f * (m_maxLongitudinalDisplacementX + boundaryWidthX) + displacementTolerance);
+
+            BoundaryEndpointVector boundaryEndpointVector1;
+            this->BuildBoundaryEndpointIndex(pfoList1, pointingClusterMap, boundaryCenterX, boundaryEndpointVector1);
+
+            for (const ParticleFlowObject *const pPfo2 : pfoList2)
             {
-                for (const ParticleFlowObject *const pPfo2 : pfoList2)
+                const LArPointingCluster &pointingCluster2(pointingClusterMap.at(pPfo2));
+
+                PfoVector matchedPfoVector1;
+                for (const LArPointingCluster::Vertex *const pVertex2 : {&pointingCluster2.GetInnerVertex(), &pointingCluster2.GetOuterVertex()})
+                {
+                    const float displacement2(pVertex2->GetPosition().GetX() - boundaryCenterX);
+                    const float minDisplacement1(-displacement2 - maxDisplacementSum), maxDisplacement1(-displacement2 + maxDisplacementSum);
+
+                    BoundaryEndpointVector::const_iterator endpointIter(std::lower_bound(boundaryEndpointVector1.begin(), boundaryEndpointVector1.end(),
+                        minDisplacement1, [](const BoundaryEndpoint &endpoint, const float value) { return endpoint.first < value; }));
+
+                    for (; (boundaryEndpointVector1.end() != endpointIter) && (endpointIter->first <= maxDisplacement1); ++endpointIter)
+                        matchedPfoVector1.push_back(endpointIter->second);
+                }
+
+                std::sort(matchedPfoVector1.begin(), matchedPfoVector1.end());
+                matchedPfoVector1.erase(std::unique(matchedPfoVector1.begin(), matchedPfoVector1.end()), matchedPfoVector1.end());
+                std::sort(matchedPfoVector1.begin(), matchedPfoVector1.end(), LArPfoHelper::SortByNHits);
+
+                for (const ParticleFlowObject *const pPfo1 : matchedPfoVector1)
                     this->CreatePfoMatches(*pLArTPC1, *pLArTPC2, pPfo1, pPfo2, pointingClusterMap, pfoAssociationMatrix);
             }
         }
@@ -171,6 +270,22 @@ void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPCToPfoMap &larTP
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void StitchingCosmicRayMergingTool::BuildBoundaryEndpointIndex(const PfoList &pfoList, const ThreeDPointingClusterMap &pointingClusterMap,
+    const float boundaryCenterX, BoundaryEndpointVector &boundaryEndpointVector) const
+{
+    for (const ParticleFlowObject *const pPfo : pfoList)
+    {
+        const LArPointingCluster &pointingCluster(pointingClusterMap.at(pPfo));
+        boundaryEndpointVector.emplace_back(pointingCluster.GetInnerVertex().GetPosition().GetX() - boundaryCenterX, pPfo);
+        boundaryEndpointVector.emplace_back(pointingCluster.GetOuterVertex().GetPosition().GetX() - boundaryCenterX, pPfo);
+    }
+
+    std::sort(boundaryEndpointVector.begin(), boundaryEndpointVector.end(),
+        [](const BoundaryEndpoint &lhs, const BoundaryEndpoint &rhs) { return lhs.first < rhs.first; });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPC &larTPC1, const LArTPC &larTPC2, const ParticleFlowObject *const pPfo1,
     const ParticleFlowObject *const pPfo2, const ThreeDPointingClusterMap &pointingClusterMap, PfoAssociationMatrix &pfoAssociationMatrix) const
 {
@@ -189,21 +304,6 @@ void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPC &larTPC1, cons
     const LArPointingCluster &pointingCluster1(iter1->second);
     const LArPointingCluster &pointingCluster2(iter2->second);
 
-    // Check length of pointing clusters
-    if (pointingCluster1.GetLengthSquared() < m_minLengthSquared || pointingCluster2.GetLengthSquared() < m_minLengthSquared)
-        return;
-
-    // Get number of 3D hits in each of the pfos
-    CaloHitList caloHitList3D1;
-    LArPfoHelper::GetCaloHits(pPfo1, TPC_3D, caloHitList3D1);
-
-    CaloHitList caloHitList3D2;
-    LArPfoHelper::GetCaloHits(pPfo2, TPC_3D, caloHitList3D2);
-
-    // Check number of 3D hits in each of the pfos
-    if (caloHitList3D1.size() < m_minNCaloHits3D || caloHitList3D2.size() < m_minNCaloHits3D)
-        return;
-
     // Get closest pair of vertices
     LArPointingCluster::Vertex pointingVertex1, pointingVertex2;
 
@@ -95,6 +95,12 @@ private:
      */
     void SelectPrimaryPfos(const pandora::PfoList *pInputPfoList, const PfoToLArTPCMap &pfoToLArTPCMap, pandora::PfoList &outputPfoList) const;
 
+    /**
+     *  @brief  Build the map from each tpc volume id to the volume ids of the later (by SortTPCs) tpcs with which it can be stitched.
+     *          The geometry is fixed, so this is done once, on first use.
+     */
+    void BuildStitchableTPCMap();
+
     typedef std::unordered_map<const pandora::ParticleFlowObject *, LArPointingCluster> ThreeDPointingClusterMap;
 
     /**
@@ -107,6 +113,16 @@ private:
     void BuildPointingClusterMaps(
         const pandora::PfoList &inputPfoList, const PfoToLArTPCMap &pfoToLArTPCMap, ThreeDPointingClusterMap &pointingClusterMap) const;
 
+    /**
+     *  @brief  Select the Pfos with a sufficiently long pointing cluster and sufficient 3D hits to be considered for stitching
+     *
+     *  @param  inputPfoList the input list of Pfos
+     *  @param  pointingClusterMap the mapping between Pfos and their corresponding 3D pointing clusters
+     *  @param  candidatePfoList the output list of candidate Pfos
+     */
+    void SelectStitchingCandidates(
+        const pandora::PfoList &inputPfoList, const ThreeDPointingClusterMap &pointingClusterMap, pandora::PfoList &candidatePfoList) const;
+
     typedef std::unordered_map<const pandora::LArTPC *, pandora::PfoList> LArTPCToPfoMap;
 
     /**
@@ -131,8 +147,22 @@ private:
     void CreatePfoMatches(const LArTPCToPfoMap &larTPCToPfoMap, const ThreeDPointingClusterMap &pointingClusterMap,
         PfoAssociationMatrix &pfoAssociationMatrix) const;
 
+    typedef std::pair<float, const pandora::ParticleFlowObject *> BoundaryEndpoint;
+    typedef std::vector<BoundaryEndpoint> BoundaryEndpointVector;
+
     /**
-     *  @brief  Create associations between Pfos using 3D pointing clusters
+     *  @brief  Index the pointing cluster endpoints of a list of Pfos by their x displacement from a tpc boundary
+     *
+     *  @param  pfoList the input list of Pfos
+     *  @param  pointingClusterMap the input mapping between Pfos and their corresponding 3D pointing clusters
+     *  @param  boundaryCenterX the x centre of the tpc boundary
+     *  @param  boundaryEndpointVector to receive the (displacement, Pfo) entries, sorted by displacement
+     */
+    void BuildBoundaryEndpointIndex(const pandora::PfoList &pfoList, const ThreeDPointingClusterMap &pointingClusterMap,
+        const float boundaryCenterX, BoundaryEndpointVector &boundaryEndpointVector) const;
+
+    /**
+     *  @brief  Create associations between Pfos using 3D pointing clusters, for Pfos that have passed the candidate selection
      *
      *  @param  larTPC1 the tpc description for the first Pfo
      *  @param  larTPC2 the tpc description for the second Pfo
@@ -241,6 +271,9 @@ private:
     unsigned int m_minNCaloHits3D;
     float m_maxX0FractionalDeviation; ///< The maximum allowed fractional difference of an X0 contribution for matches to be stitched
     float m_boundaryToleranceWidth;   ///< The distance from the APA/CPA boundary inside which the deviation consideration is ignored
+
+    typedef std::unordered_map<unsigned int, std::vector<unsigned int>> StitchableTPCMap;
+    StitchableTPCMap m_stitchableTPCMap; ///< The map from tpc volume id to the volume ids of the stitchable tpcs, cached per geometry
 };
 
 } // namespace lar_content
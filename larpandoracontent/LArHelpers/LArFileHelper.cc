@@ -12,6 +12,7 @@
 
 #include <cstdlib>
 #include <sys/stat.h>
+#include <vector>
 
 using namespace pandora;
 
@@ -43,4 +44,63 @@ std::string LArFileHelper::FindFileInPath(const std::string &unqualifiedFileName
     throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LArFileHelper::FindMonitoringContent(const std::string &settingsFile, bool &hasMonitoringContent)
+{
+    hasMonitoringContent = false;
+    TiXmlDocument xmlDocument(settingsFile);
+
+    if (!xmlDocument.LoadFile())
+    {
+        std::cout << "LArFileHelper::FindMonitoringContent - invalid xml file " << settingsFile << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    // ATTN The LArContent monitoring, validation and visualization algorithms and tools use the event display or write root trees, as do
+    // reconstruction algorithms and tools with an enabled Visualize or Display setting
+    std::vector<const TiXmlElement *> xmlElements(1, xmlDocument.RootElement());
+
+    while (!xmlElements.empty())
+    {
+        const TiXmlElement *const pXmlElement(xmlElements.back());
+        xmlElements.pop_back();
+
+        if (!pXmlElement)
+            continue;
+
+        const char *const pType(pXmlElement->Attribute("type"));
+
+        if (pType && (("algorithm" == pXmlElement->ValueStr()) || ("tool" == pXmlElement->ValueStr())))
+        {
+            const std::string type(pType);
+
+            if ((std::string::npos != type.find("Monitoring")) || (std::string::npos != type.find("Validation")) ||
+                (std::string::npos != type.find("Visualization")))
+            {
+                hasMonitoringContent = true;
+                return STATUS_CODE_SUCCESS;
+            }
+        }
+
+        for (const TiXmlElement *pChildElement = pXmlElement->FirstChildElement(); pChildElement;
+             pChildElement = pChildElement->NextSiblingElement())
+        {
+            const std::string settingName(pChildElement->ValueStr());
+            const char *const pSettingValue(pChildElement->GetText());
+
+            if (pType && ((0 == settingName.find("Visualize")) || (0 == settingName.find("Display"))) && pSettingValue &&
+                ("true" == std::string(pSettingValue)))
+            {
+                hasMonitoringContent = true;
+                return STATUS_CODE_SUCCESS;
+            }
+
+            xmlElements.push_back(pChildElement);
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
 } // namespace lar_content
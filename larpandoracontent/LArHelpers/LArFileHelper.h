@@ -8,6 +8,8 @@
 #ifndef LAR_FILE_HELPER_H
 #define LAR_FILE_HELPER_H 1
 
+#include "Pandora/StatusCodes.h"
+
 #include <string>
 
 namespace lar_content
@@ -30,6 +32,17 @@ public:
      *  @return the fully-qualified name if found, else a StatusCode exception will be raised
      */
     static std::string FindFileInPath(const std::string &unqualifiedFileName, const std::string &environmentVariable, const std::string &delimiter = ":");
+
+    /**
+     *  @brief  Whether a settings file configures algorithms or algorithm tools that use process-wide monitoring state (event display, root
+     *          trees) and so cannot be run in concurrent pandora instances
+     *
+     *  @param  settingsFile the settings file
+     *  @param  hasMonitoringContent to receive whether such content is configured
+     *
+     *  @return success
+     */
+    static pandora::StatusCode FindMonitoringContent(const std::string &settingsFile, bool &hasMonitoringContent);
 };
 
 } // namespace lar_content
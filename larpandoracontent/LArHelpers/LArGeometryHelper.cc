@@ -23,6 +23,8 @@
 
 #include "Plugins/LArTransformationPlugin.h"
 
+#include <algorithm>
+
 using namespace pandora;
 
 namespace lar_content
@@ -378,29 +380,25 @@ float LArGeometryHelper::GetWirePitch(const Pandora &pandora, const HitType view
     if (view != TPC_VIEW_U && view != TPC_VIEW_V && view != TPC_VIEW_W)
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-    const LArTPCMap &larTPCMap(pandora.GetGeometry()->GetLArTPCMap());
+    const GeometrySummaryPtr spGeometrySummary(LArGeometryHelper::GetGeometrySummary(pandora));
+    const GeometrySummary &geometrySummary(*spGeometrySummary);
 
-    if (larTPCMap.empty())
+    if (0 == geometrySummary.m_nLArTPCs)
     {
         std::cout << "LArGeometryHelper::GetWirePitch - LArTPC description not registered with Pandora as required " << std::endl;
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
     }
 
-    const LArTPC *const pFirstLArTPC(larTPCMap.begin()->second);
-    const float wirePitch(view == TPC_VIEW_U ? pFirstLArTPC->GetWirePitchU()
-                                             : (view == TPC_VIEW_V ? pFirstLArTPC->GetWirePitchV() : pFirstLArTPC->GetWirePitchW()));
+    const float wirePitch(view == TPC_VIEW_U ? geometrySummary.m_wirePitchU
+                                             : (view == TPC_VIEW_V ? geometrySummary.m_wirePitchV : geometrySummary.m_wirePitchW));
+    const float wirePitchDiscrepancy(view == TPC_VIEW_U ? geometrySummary.m_maxWirePitchDiscrepancyU
+                                                        : (view == TPC_VIEW_V ? geometrySummary.m_maxWirePitchDiscrepancyV
+                                                                              : geometrySummary.m_maxWirePitchDiscrepancyW));
 
-    for (const LArTPCMap::value_type &mapEntry : larTPCMap)
+    if (wirePitchDiscrepancy > maxWirePitchDiscrepancy)
     {
-        const LArTPC *const pLArTPC(mapEntry.second);
-        const float alternateWirePitch(
-            view == TPC_VIEW_U ? pLArTPC->GetWirePitchU() : (view == TPC_VIEW_V ? pLArTPC->GetWirePitchV() : pLArTPC->GetWirePitchW()));
-
-        if (std::fabs(wirePitch - alternateWirePitch) > maxWirePitchDiscrepancy)
-        {
-            std::cout << "LArGeometryHelper::GetWirePitch - LArTPC configuration not supported" << std::endl;
-            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
-        }
+        std::cout << "LArGeometryHelper::GetWirePitch - LArTPC configuration not supported" << std::endl;
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
     }
 
     return wirePitch;
@@ -410,25 +408,25 @@ float LArGeometryHelper::GetWirePitch(const Pandora &pandora, const HitType view
 
 CartesianVector LArGeometryHelper::GetWireAxis(const Pandora &pandora, const HitType view)
 {
-    if (view == TPC_VIEW_U)
-    {
-        return CartesianVector(0.f, pandora.GetPlugins()->GetLArTransformationPlugin()->YZtoU(1.f, 0.f),
-            pandora.GetPlugins()->GetLArTransformationPlugin()->YZtoU(0.f, 1.f));
-    }
+    if (view != TPC_VIEW_U && view != TPC_VIEW_V && view != TPC_VIEW_W)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-    else if (view == TPC_VIEW_V)
-    {
-        return CartesianVector(0.f, pandora.GetPlugins()->GetLArTransformationPlugin()->YZtoV(1.f, 0.f),
-            pandora.GetPlugins()->GetLArTransformationPlugin()->YZtoV(0.f, 1.f));
-    }
+    const GeometrySummaryPtr spGeometrySummary(LArGeometryHelper::GetGeometrySummary(pandora));
+    const GeometrySummary &geometrySummary(*spGeometrySummary);
 
-    else if (view == TPC_VIEW_W)
-    {
-        return CartesianVector(0.f, pandora.GetPlugins()->GetLArTransformationPlugin()->YZtoW(1.f, 0.f),
-            pandora.GetPlugins()->GetLArTransformationPlugin()->YZtoW(0.f, 1.f));
-    }
+    if (geometrySummary.m_hasWireAxes)
+        return (view == TPC_VIEW_U ? geometrySummary.m_wireAxisU : (view == TPC_VIEW_V ? geometrySummary.m_wireAxisV : geometrySummary.m_wireAxisW));
 
-    throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    // ATTN Without a transformation plugin, fail exactly as direct use of the plugin would
+    const LArTransformationPlugin *const pTransformationPlugin(pandora.GetPlugins()->GetLArTransformationPlugin());
+
+    if (view == TPC_VIEW_U)
+        return CartesianVector(0.f, pTransformationPlugin->YZtoU(1.f, 0.f), pTransformationPlugin->YZtoU(0.f, 1.f));
+
+    if (view == TPC_VIEW_V)
+        return CartesianVector(0.f, pTransformationPlugin->YZtoV(1.f, 0.f), pTransformationPlugin->YZtoV(0.f, 1.f));
+
+    return CartesianVector(0.f, pTransformationPlugin->YZtoW(1.f, 0.f), pTransformationPlugin->YZtoW(0.f, 1.f));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -449,12 +447,43 @@ void LArGeometryHelper::GetCommonDaughterVolumes(const Cluster *const pCluster1,
 bool LArGeometryHelper::IsInGap(const Pandora &pandora, const CartesianVector &testPoint2D, const HitType hitType, const float gapTolerance)
 {
     // ATTN: input test point MUST be a 2D position vector
-    for (const DetectorGap *const pDetectorGap : pandora.GetGeometry()->GetDetectorGapList())
+    if ((TPC_VIEW_U != hitType) && (TPC_VIEW_V != hitType) && (TPC_VIEW_W != hitType))
+    {
+        for (const DetectorGap *const pDetectorGap : pandora.GetGeometry()->GetDetectorGapList())
+        {
+            if (pDetectorGap->IsInGap(testPoint2D, hitType, gapTolerance))
+                return true;
+        }
+
+        return false;
+    }
+
+    const GeometrySummaryPtr spGeometrySummary(LArGeometryHelper::GetGeometrySummary(pandora));
+    const GeometrySummary &geometrySummary(*spGeometrySummary);
+
+    for (const DetectorGap *const pDetectorGap : geometrySummary.m_unindexedGaps)
     {
         if (pDetectorGap->IsInGap(testPoint2D, hitType, gapTolerance))
             return true;
     }
 
+    // Only wire gaps whose (slightly widened) z extent contains the test point are candidates, and these make the final decision
+    const ViewGapIndex &gapIndex(
+        TPC_VIEW_U == hitType ? geometrySummary.m_gapIndexU : (TPC_VIEW_V == hitType ? geometrySummary.m_gapIndexV : geometrySummary.m_gapIndexW));
+    const float testZ(testPoint2D.GetZ());
+    const float margin(std::fabs(gapTolerance) + 4.f * std::numeric_limits<float>::epsilon() * (1.f + std::fabs(testZ) + std::fabs(gapTolerance)));
+
+    for (unsigned int iEntry = gapIndex.GetNCandidateEntries(testZ + margin); iEntry > 0; --iEntry)
+    {
+        if (gapIndex.m_maxEndZ.at(iEntry - 1) < testZ - margin)
+            break;
+
+        const ViewGapIndex::Entry &entry(gapIndex.m_entries.at(iEntry - 1));
+
+        if ((entry.m_endZ >= testZ - margin) && entry.m_pDetectorGap->IsInGap(testPoint2D, hitType, gapTolerance))
+            return true;
+    }
+
     return false;
 }
 
@@ -511,28 +540,41 @@ float LArGeometryHelper::CalculateGapDeltaZ(const Pandora &pandora, const float
     if (maxZ - minZ < std::numeric_limits<float>::epsilon())
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-    float gapDeltaZ(0.f);
+    const GeometrySummaryPtr spGeometrySummary(LArGeometryHelper::GetGeometrySummary(pandora));
+    const GeometrySummary &geometrySummary(*spGeometrySummary);
+
+    if (!geometrySummary.m_allGapsAreLineGaps)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    if ((TPC_VIEW_U != hitType) && (TPC_VIEW_V != hitType) && (TPC_VIEW_W != hitType))
+        return 0.f;
+
+    const ViewGapIndex &gapIndex(
+        TPC_VIEW_U == hitType ? geometrySummary.m_gapIndexU : (TPC_VIEW_V == hitType ? geometrySummary.m_gapIndexV : geometrySummary.m_gapIndexW));
+
+    ViewGapIndex::EntryVector overlappingEntries;
 
-    for (const DetectorGap *const pDetectorGap : pandora.GetGeometry()->GetDetectorGapList())
+    for (unsigned int iEntry = gapIndex.GetNCandidateEntries(maxZ); iEntry > 0; --iEntry)
     {
-        const LineGap *const pLineGap = dynamic_cast<const LineGap *>(pDetectorGap);
+        if (gapIndex.m_maxEndZ.at(iEntry - 1) < minZ)
+            break;
 
-        if (!pLineGap)
-            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+        const ViewGapIndex::Entry &entry(gapIndex.m_entries.at(iEntry - 1));
 
-        const LineGapType lineGapType(pLineGap->GetLineGapType());
+        if (entry.m_endZ >= minZ)
+            overlappingEntries.push_back(entry);
+    }
 
-        if (!(((TPC_VIEW_U == hitType) && (TPC_WIRE_GAP_VIEW_U == lineGapType)) || ((TPC_VIEW_V == hitType) && (TPC_WIRE_GAP_VIEW_V == lineGapType)) ||
-                ((TPC_VIEW_W == hitType) && (TPC_WIRE_GAP_VIEW_W == lineGapType))))
-        {
-            continue;
-        }
+    // ATTN Sum in detector gap list order, so that the result is independent of the index
+    std::sort(overlappingEntries.begin(), overlappingEntries.end(),
+        [](const ViewGapIndex::Entry &lhs, const ViewGapIndex::Entry &rhs) { return (lhs.m_listIndex < rhs.m_listIndex); });
 
-        if ((pLineGap->GetLineStartZ() > maxZ) || (pLineGap->GetLineEndZ() < minZ))
-            continue;
+    float gapDeltaZ(0.f);
 
-        const float gapMinZ(std::max(minZ, pLineGap->GetLineStartZ()));
-        const float gapMaxZ(std::min(maxZ, pLineGap->GetLineEndZ()));
+    for (const ViewGapIndex::Entry &entry : overlappingEntries)
+    {
+        const float gapMinZ(std::max(minZ, entry.m_startZ));
+        const float gapMaxZ(std::min(maxZ, entry.m_endZ));
 
         if ((gapMaxZ - gapMinZ) > std::numeric_limits<float>::epsilon())
             gapDeltaZ += (gapMaxZ - gapMinZ);
@@ -545,29 +587,208 @@ float LArGeometryHelper::CalculateGapDeltaZ(const Pandora &pandora, const float
 
 float LArGeometryHelper::GetSigmaUVW(const Pandora &pandora, const float maxSigmaDiscrepancy)
 {
-    const LArTPCMap &larTPCMap(pandora.GetGeometry()->GetLArTPCMap());
+    const GeometrySummaryPtr spGeometrySummary(LArGeometryHelper::GetGeometrySummary(pandora));
+    const GeometrySummary &geometrySummary(*spGeometrySummary);
 
-    if (larTPCMap.empty())
+    if (0 == geometrySummary.m_nLArTPCs)
     {
         std::cout << "LArGeometryHelper::GetSigmaUVW - LArTPC description not registered with Pandora as required " << std::endl;
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
     }
 
-    const LArTPC *const pFirstLArTPC(larTPCMap.begin()->second);
-    const float sigmaUVW(pFirstLArTPC->GetSigmaUVW());
+    if (geometrySummary.m_maxSigmaDiscrepancy > maxSigmaDiscrepancy)
+    {
+        std::cout << "LArGeometryHelper::GetSigmaUVW - Plugin does not support provided LArTPC configurations " << std::endl;
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    }
+
+    return geometrySummary.m_sigmaUVW;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArGeometryHelper::GeometrySummaryPtr LArGeometryHelper::GetGeometrySummary(const Pandora &pandora)
+{
+    // ATTN Each thread remembers the last summary it used, so repeated queries take no lock. The remembered summary is discarded whenever
+    // any summary has been released since, as a new pandora instance may then have been created at the same address.
+    thread_local const Pandora *pLastPandora(nullptr);
+    thread_local unsigned int lastGeneration(0);
+    thread_local GeometrySummaryPtr spLastGeometrySummary;
 
-    for (const LArTPCMap::value_type &mapEntry : larTPCMap)
+    GeometrySummaryRegistry &registry(LArGeometryHelper::GetGeometrySummaryRegistry());
+
+    if ((&pandora == pLastPandora) && (registry.m_generation.load(std::memory_order_acquire) == lastGeneration) &&
+        spLastGeometrySummary->IsCurrent(pandora))
     {
-        const LArTPC *const pLArTPC(mapEntry.second);
+        return spLastGeometrySummary;
+    }
+
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+    GeometrySummaryPtr &spGeometrySummary(registry.m_geometrySummaryMap[&pandora]);
+
+    // ATTN The detector gaps may be registered after the first query, in which case a new summary replaces the stale one for later callers
+    if (!spGeometrySummary || !spGeometrySummary->IsCurrent(pandora))
+        spGeometrySummary = std::make_shared<const GeometrySummary>(pandora);
 
-        if (std::fabs(sigmaUVW - pLArTPC->GetSigmaUVW()) > maxSigmaDiscrepancy)
+    pLastPandora = &pandora;
+    lastGeneration = registry.m_generation.load(std::memory_order_relaxed);
+    spLastGeometrySummary = spGeometrySummary;
+
+    return spGeometrySummary;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArGeometryHelper::ReleaseGeometrySummary(const Pandora &pandora)
+{
+    GeometrySummaryRegistry &registry(LArGeometryHelper::GetGeometrySummaryRegistry());
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+    if (registry.m_geometrySummaryMap.erase(&pandora) > 0)
+        registry.m_generation.fetch_add(1, std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArGeometryHelper::GeometrySummaryRegistry &LArGeometryHelper::GetGeometrySummaryRegistry()
+{
+    static GeometrySummaryRegistry registry;
+    return registry;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArGeometryHelper::GeometrySummary::GeometrySummary(const Pandora &pandora) :
+    m_nLArTPCs(0),
+    m_pFirstLArTPC(nullptr),
+    m_wirePitchU(0.f),
+    m_wirePitchV(0.f),
+    m_wirePitchW(0.f),
+    m_sigmaUVW(0.f),
+    m_maxWirePitchDiscrepancyU(0.f),
+    m_maxWirePitchDiscrepancyV(0.f),
+    m_maxWirePitchDiscrepancyW(0.f),
+    m_maxSigmaDiscrepancy(0.f),
+    m_hasWireAxes(false),
+    m_wireAxisU(0.f, 0.f, 0.f),
+    m_wireAxisV(0.f, 0.f, 0.f),
+    m_wireAxisW(0.f, 0.f, 0.f),
+    m_nDetectorGaps(0),
+    m_pFirstDetectorGap(nullptr),
+    m_allGapsAreLineGaps(true)
+{
+    const LArTPCMap &larTPCMap(pandora.GetGeometry()->GetLArTPCMap());
+
+    if (!larTPCMap.empty())
+    {
+        m_nLArTPCs = larTPCMap.size();
+        m_pFirstLArTPC = larTPCMap.begin()->second;
+        m_wirePitchU = m_pFirstLArTPC->GetWirePitchU();
+        m_wirePitchV = m_pFirstLArTPC->GetWirePitchV();
+        m_wirePitchW = m_pFirstLArTPC->GetWirePitchW();
+        m_sigmaUVW = m_pFirstLArTPC->GetSigmaUVW();
+
+        for (const LArTPCMap::value_type &mapEntry : larTPCMap)
+        {
+            const LArTPC *const pLArTPC(mapEntry.second);
+            m_maxWirePitchDiscrepancyU = std::max(m_maxWirePitchDiscrepancyU, std::fabs(m_wirePitchU - pLArTPC->GetWirePitchU()));
+            m_maxWirePitchDiscrepancyV = std::max(m_maxWirePitchDiscrepancyV, std::fabs(m_wirePitchV - pLArTPC->GetWirePitchV()));
+            m_maxWirePitchDiscrepancyW = std::max(m_maxWirePitchDiscrepancyW, std::fabs(m_wirePitchW - pLArTPC->GetWirePitchW()));
+            m_maxSigmaDiscrepancy = std::max(m_maxSigmaDiscrepancy, std::fabs(m_sigmaUVW - pLArTPC->GetSigmaUVW()));
+        }
+    }
+
+    const DetectorGapList &detectorGapList(pandora.GetGeometry()->GetDetectorGapList());
+    m_nDetectorGaps = detectorGapList.size();
+    m_pFirstDetectorGap = detectorGapList.empty() ? nullptr : detectorGapList.front();
+
+    unsigned int listIndex(0);
+
+    for (const DetectorGap *const pDetectorGap : detectorGapList)
+    {
+        const LineGap *const pLineGap(dynamic_cast<const LineGap *>(pDetectorGap));
+        const LineGapType lineGapType(pLineGap ? pLineGap->GetLineGapType() : TPC_DRIFT_GAP);
+        ViewGapIndex *const pGapIndex((TPC_WIRE_GAP_VIEW_U == lineGapType)
+                ? &m_gapIndexU
+                : ((TPC_WIRE_GAP_VIEW_V == lineGapType) ? &m_gapIndexV : ((TPC_WIRE_GAP_VIEW_W == lineGapType) ? &m_gapIndexW : nullptr)));
+
+        if (!pLineGap)
+            m_allGapsAreLineGaps = false;
+
+        if (pLineGap && pGapIndex)
+        {
+            pGapIndex->m_entries.push_back({pLineGap->GetLineStartZ(), pLineGap->GetLineEndZ(), listIndex, pDetectorGap});
+        }
+        else
         {
-            std::cout << "LArGeometryHelper::GetSigmaUVW - Plugin does not support provided LArTPC configurations " << std::endl;
-            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+            m_unindexedGaps.push_back(pDetectorGap);
         }
+
+        ++listIndex;
     }
 
-    return sigmaUVW;
+    for (ViewGapIndex *const pGapIndex : {&m_gapIndexU, &m_gapIndexV, &m_gapIndexW})
+    {
+        std::stable_sort(pGapIndex->m_entries.begin(), pGapIndex->m_entries.end(),
+            [](const ViewGapIndex::Entry &lhs, const ViewGapIndex::Entry &rhs) { return (lhs.m_startZ < rhs.m_startZ); });
+
+        float maxEndZ(-std::numeric_limits<float>::max());
+
+        for (const ViewGapIndex::Entry &entry : pGapIndex->m_entries)
+        {
+            maxEndZ = std::max(maxEndZ, entry.m_endZ);
+            pGapIndex->m_maxEndZ.push_back(maxEndZ);
+        }
+    }
+
+    try
+    {
+        const LArTransformationPlugin *const pTransformationPlugin(pandora.GetPlugins()->GetLArTransformationPlugin());
+
+        if (!pTransformationPlugin)
+            return;
+
+        m_wireAxisU.SetValues(0.f, pTransformationPlugin->YZtoU(1.f, 0.f), pTransformationPlugin->YZtoU(0.f, 1.f));
+        m_wireAxisV.SetValues(0.f, pTransformationPlugin->YZtoV(1.f, 0.f), pTransformationPlugin->YZtoV(0.f, 1.f));
+        m_wireAxisW.SetValues(0.f, pTransformationPlugin->YZtoW(1.f, 0.f), pTransformationPlugin->YZtoW(0.f, 1.f));
+        m_hasWireAxes = true;
+    }
+    catch (const StatusCodeException &)
+    {
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArGeometryHelper::GeometrySummary::IsCurrent(const Pandora &pandora) const
+{
+    const LArTPCMap &larTPCMap(pandora.GetGeometry()->GetLArTPCMap());
+
+    if ((larTPCMap.size() != m_nLArTPCs) || (!larTPCMap.empty() && (larTPCMap.begin()->second != m_pFirstLArTPC)))
+        return false;
+
+    // ATTN The detector gaps may be registered after the lar tpcs, before the first event
+    const DetectorGapList &detectorGapList(pandora.GetGeometry()->GetDetectorGapList());
+
+    return ((detectorGapList.size() == m_nDetectorGaps) && (detectorGapList.empty() || (detectorGapList.front() == m_pFirstDetectorGap)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArGeometryHelper::GeometrySummaryRegistry::GeometrySummaryRegistry() :
+    m_generation(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int LArGeometryHelper::ViewGapIndex::GetNCandidateEntries(const float maxZ) const
+{
+    return std::distance(m_entries.begin(), std::upper_bound(m_entries.begin(), m_entries.end(), maxZ,
+                                                [](const float z, const Entry &entry) { return (z < entry.m_startZ); }));
 }
 
 } // namespace lar_content
@@ -8,15 +8,22 @@
 #ifndef LAR_GEOMETRY_HELPER_H
 #define LAR_GEOMETRY_HELPER_H 1
 
+#include "Objects/CartesianVector.h"
 #include "Objects/Cluster.h"
 #include "Pandora/PandoraEnumeratedTypes.h"
 #include "Pandora/StatusCodes.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace pandora
 {
 class CartesianVector;
+class DetectorGap;
+class LArTPC;
 class Pandora;
 } // namespace pandora
 
@@ -34,6 +41,104 @@ class LArGeometryHelper
 {
 public:
     typedef std::set<unsigned int> UIntSet;
+    typedef std::vector<const pandora::DetectorGap *> DetectorGapVector;
+
+    /**
+     *  @brief  ViewGapIndex class, indexing the wire gaps of a single view by their z extent
+     */
+    class ViewGapIndex
+    {
+    public:
+        /**
+         *  @brief  Entry class
+         */
+        class Entry
+        {
+        public:
+            float m_startZ;                             ///< The gap start z coordinate
+            float m_endZ;                               ///< The gap end z coordinate
+            unsigned int m_listIndex;                   ///< The position of the gap in the detector gap list
+            const pandora::DetectorGap *m_pDetectorGap; ///< The address of the gap
+        };
+
+        typedef std::vector<Entry> EntryVector;
+
+        /**
+         *  @brief  Get the number of entries, from the start of the index, that could overlap z coordinates up to a given value
+         *
+         *  @param  maxZ the max. z coordinate
+         *
+         *  @return the number of entries with start z no greater than maxZ
+         */
+        unsigned int GetNCandidateEntries(const float maxZ) const;
+
+        EntryVector m_entries;          ///< The gap entries, sorted by start z coordinate
+        pandora::FloatVector m_maxEndZ; ///< The running max. end z coordinate of the sorted entries
+    };
+
+    /**
+     *  @brief  GeometrySummary class, holding the detector quantities that are constant once the geometry has been registered
+     */
+    class GeometrySummary
+    {
+    public:
+        /**
+         *  @brief  Constructor, summarising the registered geometry of a pandora instance
+         *
+         *  @param  pandora the associated pandora instance
+         */
+        GeometrySummary(const pandora::Pandora &pandora);
+
+        /**
+         *  @brief  Whether the summary still describes the registered geometry of a pandora instance
+         *
+         *  @param  pandora the associated pandora instance
+         *
+         *  @return boolean
+         */
+        bool IsCurrent(const pandora::Pandora &pandora) const;
+
+        unsigned int m_nLArTPCs;                         ///< The number of registered lar tpcs
+        const pandora::LArTPC *m_pFirstLArTPC;           ///< The address of the first registered lar tpc
+        float m_wirePitchU;                              ///< The u wire pitch of the first lar tpc
+        float m_wirePitchV;                              ///< The v wire pitch of the first lar tpc
+        float m_wirePitchW;                              ///< The w wire pitch of the first lar tpc
+        float m_sigmaUVW;                                ///< The sigmaUVW value of the first lar tpc
+        float m_maxWirePitchDiscrepancyU;                ///< The max. discrepancy between the lar tpc u wire pitches
+        float m_maxWirePitchDiscrepancyV;                ///< The max. discrepancy between the lar tpc v wire pitches
+        float m_maxWirePitchDiscrepancyW;                ///< The max. discrepancy between the lar tpc w wire pitches
+        float m_maxSigmaDiscrepancy;                     ///< The max. discrepancy between the lar tpc sigmaUVW values
+        bool m_hasWireAxes;                              ///< Whether the wire axes could be obtained from the transformation plugin
+        pandora::CartesianVector m_wireAxisU;            ///< The u wire axis, holding the yz to u transformation coefficients
+        pandora::CartesianVector m_wireAxisV;            ///< The v wire axis, holding the yz to v transformation coefficients
+        pandora::CartesianVector m_wireAxisW;            ///< The w wire axis, holding the yz to w transformation coefficients
+        unsigned int m_nDetectorGaps;                    ///< The number of registered detector gaps
+        const pandora::DetectorGap *m_pFirstDetectorGap; ///< The address of the first registered detector gap
+        bool m_allGapsAreLineGaps;                       ///< Whether all registered detector gaps are line gaps
+        ViewGapIndex m_gapIndexU;                        ///< The index of the u view wire gaps
+        ViewGapIndex m_gapIndexV;                        ///< The index of the v view wire gaps
+        ViewGapIndex m_gapIndexW;                        ///< The index of the w view wire gaps
+        DetectorGapVector m_unindexedGaps;               ///< The gaps that are not wire gaps, tested for every view
+    };
+
+    typedef std::shared_ptr<const GeometrySummary> GeometrySummaryPtr;
+
+    /**
+     *  @brief  Get the geometry summary for a pandora instance, built once and then shared by all callers. The summary is immutable and
+     *          remains valid for as long as the caller holds it, even if it is later replaced or released.
+     *
+     *  @param  pandora the associated pandora instance
+     *
+     *  @return the geometry summary
+     */
+    static GeometrySummaryPtr GetGeometrySummary(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Release the geometry summary for a pandora instance, which must be called before the instance is deleted
+     *
+     *  @param  pandora the associated pandora instance
+     */
+    static void ReleaseGeometrySummary(const pandora::Pandora &pandora);
 
     /**
      *  @brief  Merge two views (U,V) to give a third view (Z).
@@ -267,6 +372,32 @@ public:
      *  @param  pCluster2 the second cluster
      */
     static void GetCommonDaughterVolumes(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, UIntSet &intersect);
+
+private:
+    typedef std::unordered_map<const pandora::Pandora *, GeometrySummaryPtr> GeometrySummaryMap;
+
+    /**
+     *  @brief  GeometrySummaryRegistry class, holding the geometry summary of each pandora instance
+     */
+    class GeometrySummaryRegistry
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        GeometrySummaryRegistry();
+
+        GeometrySummaryMap m_geometrySummaryMap; ///< The geometry summary of each pandora instance
+        std::atomic<unsigned int> m_generation;  ///< The generation, advanced whenever a summary is released
+        std::mutex m_mutex;                      ///< The mutex serialising access to the geometry summary map
+    };
+
+    /**
+     *  @brief  Get the geometry summary registry
+     *
+     *  @return the geometry summary registry
+     */
+    static GeometrySummaryRegistry &GetGeometrySummaryRegistry();
 };
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -0,0 +1,322 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArInstrumentationHelper.cc
+ *
+ *  @brief  Implementation of the instrumentation helper class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/Pandora.h"
+#include "Pandora/Process.h"
+
+#include "larpandoracontent/LArHelpers/LArInstrumentationHelper.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+LArInstrumentationHelper::ScopedTimer::ScopedTimer(const Process &process, const std::string &timerName) :
+    m_pProcess(LArInstrumentationHelper::IsEnabled() ? &process : nullptr),
+    m_timerName(m_pProcess ? timerName : std::string()),
+    m_startTime(m_pProcess ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArInstrumentationHelper::ScopedTimer::~ScopedTimer()
+{
+    if (!m_pProcess)
+        return;
+
+    const std::chrono::duration<double> elapsedTime(std::chrono::steady_clock::now() - m_startTime);
+    LArInstrumentationHelper::AddToTimer(*m_pProcess, m_timerName, elapsedTime.count());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArInstrumentationHelper::EnableRecording(const Pandora *const pPandora)
+{
+    if (!pPandora)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    Registry &registry(GetRegistry());
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+    if (1 == ++registry.m_enablementCountMap[pPandora])
+        ++registry.m_nEnabledInstances;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArInstrumentationHelper::DisableRecording(const Pandora *const pPandora)
+{
+    Registry &registry(GetRegistry());
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+    EnablementCountMap::iterator iter(registry.m_enablementCountMap.find(pPandora));
+
+    if (registry.m_enablementCountMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    if (0 == --iter->second)
+    {
+        registry.m_enablementCountMap.erase(iter);
+        registry.m_pandoraResultsMap.erase(pPandora);
+        --registry.m_nEnabledInstances;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArInstrumentationHelper::IsEnabled()
+{
+    return (0 != GetRegistry().m_nEnabledInstances);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArInstrumentationHelper::AddToCounter(const Process &process, const std::string &counterName, const double value)
+{
+    Registry &registry(GetRegistry());
+
+    if (0 == registry.m_nEnabledInstances)
+        return;
+
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+    InstanceResults *const pInstanceResults(GetInstanceResults(registry, process));
+
+    if (pInstanceResults)
+        pInstanceResults->m_counterMap[counterName] += value;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArInstrumentationHelper::AddToTimer(const Process &process, const std::string &timerName, const double seconds)
+{
+    Registry &registry(GetRegistry());
+
+    if (0 == registry.m_nEnabledInstances)
+        return;
+
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+    InstanceResults *const pInstanceResults(GetInstanceResults(registry, process));
+
+    if (!pInstanceResults)
+        return;
+
+    TimerResult &timerResult(pInstanceResults->m_timerResultMap[timerName]);
+    ++timerResult.m_nCalls;
+    timerResult.m_totalTime += seconds;
+    timerResult.m_maxTime = std::max(timerResult.m_maxTime, seconds);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LArInstrumentationHelper::WriteResults(
+    const PandoraInstanceVector &pandoraInstances, const std::string &fileName, const std::string &formatName, const std::string &label)
+{
+    if (("json" != formatName) && ("csv" != formatName))
+    {
+        std::cout << "LArInstrumentationHelper: unknown instrumentation output format " << formatName << ", expected json or csv"
+                  << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    Registry &registry(GetRegistry());
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+    std::ofstream stream(fileName, std::ios_base::app);
+
+    if (!stream.is_open())
+    {
+        std::cout << "LArInstrumentationHelper: could not open file for instrumentation output at " << fileName << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    stream.precision(std::numeric_limits<double>::max_digits10);
+
+    std::vector<const InstanceResultsMap::value_type *> instanceResults;
+
+    for (const Pandora *const pPandora : pandoraInstances)
+    {
+        PandoraResultsMap::const_iterator iter(registry.m_pandoraResultsMap.find(pPandora));
+
+        if (registry.m_pandoraResultsMap.end() == iter)
+            continue;
+
+        for (const InstanceResultsMap::value_type &mapEntry : iter->second)
+            instanceResults.push_back(&mapEntry);
+    }
+
+    if ("json" == formatName)
+    {
+        stream << "{\"label\":\"" << EscapeJson(label) << "\",\"instances\":[";
+        bool isFirstInstance(true);
+
+        for (const InstanceResultsMap::value_type *const pMapEntry : instanceResults)
+        {
+            const InstanceResultsMap::value_type &mapEntry(*pMapEntry);
+            stream << (isFirstInstance ? "" : ",") << "{\"pandora\":\"" << EscapeJson(std::get<0>(mapEntry.first)) << "\",\"type\":\""
+                   << EscapeJson(std::get<1>(mapEntry.first)) << "\",\"instance\":\"" << EscapeJson(std::get<2>(mapEntry.first))
+                   << "\",\"timers\":{";
+            isFirstInstance = false;
+            bool isFirstEntry(true);
+
+            for (const TimerResultMap::value_type &timerEntry : mapEntry.second.m_timerResultMap)
+            {
+                stream << (isFirstEntry ? "" : ",") << "\"" << EscapeJson(timerEntry.first) << "\":{\"calls\":"
+                       << timerEntry.second.m_nCalls << ",\"totalSeconds\":" << timerEntry.second.m_totalTime
+                       << ",\"maxSeconds\":" << timerEntry.second.m_maxTime << "}";
+                isFirstEntry = false;
+            }
+
+            stream << "},\"counters\":{";
+            isFirstEntry = true;
+
+            for (const CounterMap::value_type &counterEntry : mapEntry.second.m_counterMap)
+            {
+                stream << (isFirstEntry ? "" : ",") << "\"" << EscapeJson(counterEntry.first) << "\":" << counterEntry.second;
+                isFirstEntry = false;
+            }
+
+            stream << "}}";
+        }
+
+        stream << "]}\n";
+    }
+    else
+    {
+        if (0 == stream.tellp())
+            stream << "label,pandora,type,instance,kind,name,calls,value,maxSeconds\n";
+
+        for (const InstanceResultsMap::value_type *const pMapEntry : instanceResults)
+        {
+            const InstanceResultsMap::value_type &mapEntry(*pMapEntry);
+            const std::string prefix(EscapeCsv(label) + "," + EscapeCsv(std::get<0>(mapEntry.first)) + "," +
+                EscapeCsv(std::get<1>(mapEntry.first)) + "," + EscapeCsv(std::get<2>(mapEntry.first)));
+
+            for (const TimerResultMap::value_type &timerEntry : mapEntry.second.m_timerResultMap)
+            {
+                stream << prefix << ",timer," << EscapeCsv(timerEntry.first) << "," << timerEntry.second.m_nCalls << ","
+                       << timerEntry.second.m_totalTime << "," << timerEntry.second.m_maxTime << "\n";
+            }
+
+            for (const CounterMap::value_type &counterEntry : mapEntry.second.m_counterMap)
+                stream << prefix << ",counter," << EscapeCsv(counterEntry.first) << ",," << counterEntry.second << ",\n";
+        }
+    }
+
+    stream.flush();
+
+    if (!stream.good())
+    {
+        std::cout << "LArInstrumentationHelper: failed to write instrumentation output" << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArInstrumentationHelper::ClearResults(const PandoraInstanceVector &pandoraInstances)
+{
+    Registry &registry(GetRegistry());
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+    for (const Pandora *const pPandora : pandoraInstances)
+        registry.m_pandoraResultsMap.erase(pPandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArInstrumentationHelper::Registry &LArInstrumentationHelper::GetRegistry()
+{
+    static Registry registry;
+    return registry;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArInstrumentationHelper::InstanceResults *LArInstrumentationHelper::GetInstanceResults(Registry &registry, const Process &process)
+{
+    const Pandora *const pPandora(&process.GetPandora());
+
+    if (registry.m_enablementCountMap.end() == registry.m_enablementCountMap.find(pPandora))
+        return nullptr;
+
+    return &registry.m_pandoraResultsMap[pPandora][GetInstanceKey(process)];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArInstrumentationHelper::InstanceKey LArInstrumentationHelper::GetInstanceKey(const Process &process)
+{
+    return InstanceKey(process.GetPandora().GetName(), process.GetType(), process.GetInstanceName());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::string LArInstrumentationHelper::EscapeJson(const std::string &value)
+{
+    std::string escapedValue;
+    escapedValue.reserve(value.size());
+
+    for (const char character : value)
+    {
+        if (('"' == character) || ('\\' == character))
+            escapedValue.push_back('\\');
+
+        escapedValue.push_back(character);
+    }
+
+    return escapedValue;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::string LArInstrumentationHelper::EscapeCsv(const std::string &value)
+{
+    if (std::string::npos == value.find_first_of(",\"\n"))
+        return value;
+
+    std::string escapedValue("\"");
+
+    for (const char character : value)
+    {
+        if ('"' == character)
+            escapedValue.push_back('"');
+
+        escapedValue.push_back(character);
+    }
+
+    return escapedValue + "\"";
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArInstrumentationHelper::TimerResult::TimerResult() :
+    m_nCalls(0),
+    m_totalTime(0.),
+    m_maxTime(0.)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArInstrumentationHelper::Registry::Registry() :
+    m_nEnabledInstances(0)
+{
+}
+
+} // namespace lar_content
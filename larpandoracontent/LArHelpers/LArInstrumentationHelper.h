@@ -0,0 +1,241 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArInstrumentationHelper.h
+ *
+ *  @brief  Header file for the instrumentation helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_INSTRUMENTATION_HELPER_H
+#define LAR_INSTRUMENTATION_HELPER_H 1
+
+#include "Pandora/StatusCodes.h"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace pandora
+{
+class Pandora;
+class Process;
+} // namespace pandora
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArInstrumentationHelper class, which aggregates scoped timers and named counters emitted by algorithms and algorithm tools.
+ *          Recording is enabled per pandora instance, so that several master instances in one process each record, write and clear
+ *          only the results of their own pandora instances. Results are keyed by the configured process instance (pandora instance
+ *          name, process type and instance name). While no instance is enabled, each timer or counter costs a single counter check.
+ *          Results may be updated from concurrent workers, as all access is serialised.
+ */
+class LArInstrumentationHelper
+{
+public:
+    typedef std::vector<const pandora::Pandora *> PandoraInstanceVector;
+
+    /**
+     *  @brief  ScopedTimer class, which adds the time between its construction and destruction to a named timer
+     */
+    class ScopedTimer
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  process the algorithm or algorithm tool emitting the timer
+         *  @param  timerName the timer name
+         */
+        ScopedTimer(const pandora::Process &process, const std::string &timerName);
+
+        /**
+         *  @brief  Destructor, recording the elapsed time
+         */
+        ~ScopedTimer();
+
+        /**
+         *  @brief  Deleted copy constructor
+         */
+        ScopedTimer(const ScopedTimer &) = delete;
+
+        /**
+         *  @brief  Deleted assignment operator
+         */
+        ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+    private:
+        const pandora::Process *const m_pProcess;                ///< The address of the process, nullptr if recording was disabled
+        const std::string m_timerName;                           ///< The timer name
+        const std::chrono::steady_clock::time_point m_startTime; ///< The start time
+    };
+
+    /**
+     *  @brief  Start recording the timers and counters emitted within a pandora instance. Enabling is counted, so each call must be
+     *          matched by a call to DisableRecording.
+     *
+     *  @param  pPandora the address of the pandora instance
+     */
+    static void EnableRecording(const pandora::Pandora *const pPandora);
+
+    /**
+     *  @brief  Undo one call to EnableRecording for a pandora instance. When no enabling calls remain, recording stops and the
+     *          unwritten results of the instance are discarded. The instance is not dereferenced, so may already have been deleted.
+     *
+     *  @param  pPandora the address of the pandora instance
+     */
+    static void DisableRecording(const pandora::Pandora *const pPandora);
+
+    /**
+     *  @brief  Whether timers and counters are being recorded for any pandora instance
+     *
+     *  @return boolean
+     */
+    static bool IsEnabled();
+
+    /**
+     *  @brief  Add to a named counter, if recording is enabled
+     *
+     *  @param  process the algorithm or algorithm tool emitting the counter
+     *  @param  counterName the counter name
+     *  @param  value the value to add
+     */
+    static void AddToCounter(const pandora::Process &process, const std::string &counterName, const double value = 1.);
+
+    /**
+     *  @brief  Add a time measurement to a named timer, if recording is enabled
+     *
+     *  @param  process the algorithm or algorithm tool emitting the timer
+     *  @param  timerName the timer name
+     *  @param  seconds the measured time, units s
+     */
+    static void AddToTimer(const pandora::Process &process, const std::string &timerName, const double seconds);
+
+    /**
+     *  @brief  Append the results recorded for a set of pandora instances to a file. The json format writes one object per call, on a
+     *          single line; the csv format writes one row per timer or counter, preceded by a header row if the file is empty.
+     *
+     *  @param  pandoraInstances the pandora instances whose results to write, in output order
+     *  @param  fileName the file name
+     *  @param  formatName the format name, "json" or "csv"
+     *  @param  label the label identifying this block of results (e.g. the event or job)
+     *
+     *  @return success
+     */
+    static pandora::StatusCode WriteResults(const PandoraInstanceVector &pandoraInstances, const std::string &fileName,
+        const std::string &formatName, const std::string &label);
+
+    /**
+     *  @brief  Clear the results recorded for a set of pandora instances
+     *
+     *  @param  pandoraInstances the pandora instances whose results to clear
+     */
+    static void ClearResults(const PandoraInstanceVector &pandoraInstances);
+
+private:
+    /**
+     *  @brief  TimerResult class
+     */
+    class TimerResult
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        TimerResult();
+
+        unsigned int m_nCalls; ///< The number of timed calls
+        double m_totalTime;    ///< The total time, units s
+        double m_maxTime;      ///< The max time of a single call, units s
+    };
+
+    typedef std::map<std::string, TimerResult> TimerResultMap;
+    typedef std::map<std::string, double> CounterMap;
+
+    /**
+     *  @brief  InstanceResults class
+     */
+    class InstanceResults
+    {
+    public:
+        TimerResultMap m_timerResultMap; ///< The results of the timers, indexed by name
+        CounterMap m_counterMap;         ///< The counter values, indexed by name
+    };
+
+    typedef std::tuple<std::string, std::string, std::string> InstanceKey; ///< The pandora instance name, process type and instance name
+    typedef std::map<InstanceKey, InstanceResults> InstanceResultsMap;
+    typedef std::map<const pandora::Pandora *, InstanceResultsMap> PandoraResultsMap;
+    typedef std::map<const pandora::Pandora *, unsigned int> EnablementCountMap;
+
+    /**
+     *  @brief  Registry class, holding the recorded results
+     */
+    class Registry
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        Registry();
+
+        std::atomic<unsigned int> m_nEnabledInstances; ///< The number of pandora instances for which recording is enabled
+        EnablementCountMap m_enablementCountMap;       ///< The number of enabling calls for each pandora instance
+        PandoraResultsMap m_pandoraResultsMap;         ///< The results of each configured process instance, for each pandora instance
+        std::mutex m_mutex;                            ///< The mutex serialising access to the enablement counts and results
+    };
+
+    /**
+     *  @brief  Get the registry
+     *
+     *  @return the registry
+     */
+    static Registry &GetRegistry();
+
+    /**
+     *  @brief  Get the results of a configured process instance, if recording is enabled for its pandora instance. The registry mutex
+     *          must be held by the caller.
+     *
+     *  @param  registry the registry
+     *  @param  process the process
+     *
+     *  @return address of the results, nullptr if recording is not enabled for the pandora instance
+     */
+    static InstanceResults *GetInstanceResults(Registry &registry, const pandora::Process &process);
+
+    /**
+     *  @brief  Get the key identifying a configured process instance
+     *
+     *  @param  process the process
+     *
+     *  @return the key
+     */
+    static InstanceKey GetInstanceKey(const pandora::Process &process);
+
+    /**
+     *  @brief  Escape a string for inclusion in json output
+     *
+     *  @param  value the string
+     *
+     *  @return the escaped string
+     */
+    static std::string EscapeJson(const std::string &value);
+
+    /**
+     *  @brief  Escape a string for inclusion in csv output, quoting it if required
+     *
+     *  @param  value the string
+     *
+     *  @return the escaped string
+     */
+    static std::string EscapeCsv(const std::string &value);
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_INSTRUMENTATION_HELPER_H
@@ -9,6 +9,7 @@
 #define LAR_MVA_HELPER_H 1
 
 #include "larpandoracontent/LArObjects/LArMvaInterface.h"
+#include "larpandoracontent/LArObjects/LArMvaTrainingSink.h"
 
 #include "Api/PandoraContentApi.h"
 
@@ -26,6 +27,11 @@
 namespace lar_content
 {
 
+template <typename... Ts>
+class MvaFeaturePipeline;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  MvaFeatureTool class template
  */
@@ -35,6 +41,7 @@ class MvaFeatureTool : public pandora::AlgorithmTool
 public:
     typedef std::vector<MvaFeatureTool<Ts...> *> FeatureToolVector;
     typedef std::map<std::string, MvaFeatureTool<Ts...> *> FeatureToolMap;
+    typedef MvaFeaturePipeline<Ts...> FeaturePipeline;
 
     /**
      *  @brief  Default constructor.
@@ -65,6 +72,62 @@ using MvaFeatureToolMap = std::map<std::string, MvaFeatureTool<Ts...> *>;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+/**
+ *  @brief  MvaFeaturePipeline class template, resolving an ordered, named feature tool configuration once, so that the features of
+ *          many examples can be calculated into a single reusable feature vector
+ *
+ *          The feature names, and the slot of each feature in the feature vector, are fixed by the first calculation, which runs the
+ *          named (map) interface of the feature tools. Later calculations run the vector interface of each tool, whose features are
+ *          appended in the same order. A pipeline owns its feature vector, so must not be shared between concurrent calculations.
+ */
+template <typename... Ts>
+class MvaFeaturePipeline
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    MvaFeaturePipeline() = default;
+
+    /**
+     *  @brief  Resolve the ordered feature tool names to their feature tools
+     *
+     *  @param  featureToolOrder vector of strings of the ordered keys
+     *  @param  featureToolMap the feature tool map
+     *
+     *  @return success
+     */
+    pandora::StatusCode Initialize(const pandora::StringVector &featureToolOrder, const MvaFeatureToolMap<Ts...> &featureToolMap);
+
+    /**
+     *  @brief  Calculate the features of an example
+     *
+     *  @param  args arguments to pass to the tools
+     *
+     *  @return the vector of features, valid until the next calculation
+     */
+    template <typename... TARGS>
+    const MvaTypes::MvaFeatureVector &CalculateFeatures(TARGS &&... args);
+
+    /**
+     *  @brief  Get the feature names, in feature vector order (empty until the first calculation)
+     *
+     *  @return the feature names
+     */
+    const pandora::StringVector &GetFeatureOrder() const;
+
+private:
+    typedef std::vector<unsigned int> SlotVector;
+
+    pandora::StringVector m_featureToolNames;        ///< The ordered feature tool names
+    MvaFeatureToolVector<Ts...> m_featureToolVector; ///< The ordered feature tools
+    SlotVector m_toolEndSlots;                       ///< The feature vector slot following the last feature of each tool
+    pandora::StringVector m_featureOrder;            ///< The feature names, in feature vector order
+    MvaTypes::MvaFeatureVector m_featureVector;      ///< The reusable feature vector
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  LArMvaHelper class
  */
@@ -102,6 +165,36 @@ public:
     static pandora::StatusCode ProduceTrainingExample(
         const std::string &trainingOutputFile, const bool result, const pandora::StringVector &featureOrder, TCONTAINER &&featureContainer);
 
+    /**
+     *  @brief  Produce a training example with the given features and result, buffered by a training sink
+     *
+     *  @param  trainingSink the training sink
+     *  @param  trainingOutputFile the file to which to append the example
+     *  @param  result the result (class) of the example
+     *  @param  featureContainer the container of features
+     *  @param  featureNames the feature names, recorded by the binary output format (generic names are used if empty)
+     *
+     *  @return success
+     */
+    template <typename TCONTAINER>
+    static pandora::StatusCode ProduceTrainingExample(MvaTrainingSink &trainingSink, const std::string &trainingOutputFile, const bool result,
+        TCONTAINER &&featureContainer, const pandora::StringVector &featureNames = pandora::StringVector());
+
+    /**
+     *  @brief  Produce a training example with the given features and result, buffered by a training sink - using a map
+     *
+     *  @param  trainingSink the training sink
+     *  @param  trainingOutputFile the file to which to append the example
+     *  @param  result the result (class) of the example
+     *  @param  featureOrder the vector of strings corresponding to ordered list of keys, also recorded as the feature names
+     *  @param  featureContainer the container of features
+     *
+     *  @return success
+     */
+    template <typename TCONTAINER>
+    static pandora::StatusCode ProduceTrainingExample(MvaTrainingSink &trainingSink, const std::string &trainingOutputFile, const bool result,
+        const pandora::StringVector &featureOrder, TCONTAINER &&featureContainer);
+
     /**
      *  @brief  Use the trained classifier to predict the boolean class of an example
      *
@@ -246,6 +339,15 @@ public:
      */
     static MvaFeatureVector ConcatenateFeatureLists();
 
+    /**
+     *  @brief  Concatenate vectors of features into an existing feature vector, which is first emptied, so that it may be reused
+     *
+     *  @param  featureVector the feature vector to receive the concatenated features
+     *  @param  featureLists the lists of features
+     */
+    template <typename... TLISTS>
+    static void FillConcatenatedFeatureVector(MvaFeatureVector &featureVector, TLISTS &&... featureLists);
+
 private:
     /**
      *  @brief  Get a timestamp string for this point in time
@@ -310,6 +412,7 @@ pandora::StatusCode LArMvaHelper::ProduceTrainingExample(
 {
     // Make a feature vector from the map and calculate the features
     LArMvaHelper::MvaFeatureVector featureVector;
+    featureVector.reserve(featureOrder.size());
 
     for (auto const &pFeatureToolName : featureOrder)
     {
@@ -327,6 +430,41 @@ pandora::StatusCode LArMvaHelper::ProduceTrainingExample(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename TCONTAINER>
+pandora::StatusCode LArMvaHelper::ProduceTrainingExample(MvaTrainingSink &trainingSink, const std::string &trainingOutputFile, const bool result,
+    TCONTAINER &&featureContainer, const pandora::StringVector &featureNames)
+{
+    static_assert(std::is_same<typename std::decay<TCONTAINER>::type, LArMvaHelper::MvaFeatureVector>::value,
+        "LArMvaHelper: Could not produce training example because a passed parameter was not a vector of MvaFeatures");
+
+    return trainingSink.AddExample(trainingOutputFile, result, featureContainer, featureNames);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename TCONTAINER>
+pandora::StatusCode LArMvaHelper::ProduceTrainingExample(MvaTrainingSink &trainingSink, const std::string &trainingOutputFile, const bool result,
+    const pandora::StringVector &featureOrder, TCONTAINER &&featureContainer)
+{
+    LArMvaHelper::MvaFeatureVector featureVector;
+    featureVector.reserve(featureOrder.size());
+
+    for (auto const &pFeatureToolName : featureOrder)
+    {
+        if (featureContainer.find(pFeatureToolName) == featureContainer.end())
+        {
+            std::cout << "LArMvaHelper::ProduceTrainingExample "
+                      << "- Error: feature tool " << pFeatureToolName << " not found." << std::endl;
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
+        }
+        featureVector.push_back(featureContainer.at(pFeatureToolName));
+    }
+
+    return trainingSink.AddExample(trainingOutputFile, result, featureVector, featureOrder);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename TCONTAINER>
 bool LArMvaHelper::Classify(const MvaInterface &classifier, TCONTAINER &&featureContainer)
 {
@@ -340,6 +478,7 @@ bool LArMvaHelper::Classify(const MvaInterface &classifier, const pandora::Strin
 {
     // Make a feature vector from the map and calculate the features
     LArMvaHelper::MvaFeatureVector featureVector;
+    featureVector.reserve(featureOrder.size());
 
     for (auto const &pFeatureToolName : featureOrder)
     {
@@ -378,6 +517,7 @@ double LArMvaHelper::CalculateProbability(const MvaInterface &classifier, const
 {
     // Make a feature vector from the map and calculate the features
     LArMvaHelper::MvaFeatureVector featureVector;
+    featureVector.reserve(featureOrder.size());
 
     for (auto const &pFeatureToolName : featureOrder)
     {
@@ -478,20 +618,7 @@ pandora::StatusCode LArMvaHelper::AddFeatureToolToMap(
 
 inline std::string LArMvaHelper::GetTimestampString()
 {
-    std::time_t timestampNow = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-
-    struct tm *pTimeInfo(NULL);
-    char buffer[80];
-
-    pTimeInfo = localtime(&timestampNow);
-    strftime(buffer, 80, "%x_%X", pTimeInfo);
-
-    std::string timeString(buffer);
-
-    if (!timeString.empty() && timeString.back() == '\n') // last char is always a newline
-        timeString.pop_back();
-
-    return timeString;
+    return MvaTrainingSink::GetTimestampString();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -522,16 +649,8 @@ pandora::StatusCode LArMvaHelper::WriteFeaturesToFileImpl(std::ofstream &outfile
 template <typename TLIST, typename... TLISTS>
 LArMvaHelper::MvaFeatureVector LArMvaHelper::ConcatenateFeatureLists(TLIST &&featureList, TLISTS &&... featureLists)
 {
-    static_assert(std::is_same<typename std::decay<TLIST>::type, LArMvaHelper::MvaFeatureVector>::value,
-        "LArMvaHelper: Could not concatenate feature lists because one or more lists was not a vector of MvaFeatures");
-
     LArMvaHelper::MvaFeatureVector featureVector;
-
-    for (const MvaFeature &feature : featureList)
-        featureVector.push_back(feature);
-
-    LArMvaHelper::MvaFeatureVector newFeatureVector = ConcatenateFeatureLists(std::forward<TLISTS>(featureLists)...);
-    featureVector.insert(featureVector.end(), newFeatureVector.begin(), newFeatureVector.end());
+    FillConcatenatedFeatureVector(featureVector, std::forward<TLIST>(featureList), std::forward<TLISTS>(featureLists)...);
 
     return featureVector;
 }
@@ -543,6 +662,101 @@ inline LArMvaHelper::MvaFeatureVector LArMvaHelper::ConcatenateFeatureLists()
     return LArMvaHelper::MvaFeatureVector();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename... TLISTS>
+void LArMvaHelper::FillConcatenatedFeatureVector(MvaFeatureVector &featureVector, TLISTS &&... featureLists)
+{
+    static_assert((std::is_same<typename std::decay<TLISTS>::type, LArMvaHelper::MvaFeatureVector>::value && ...),
+        "LArMvaHelper: Could not concatenate feature lists because one or more lists was not a vector of MvaFeatures");
+
+    featureVector.clear();
+    featureVector.reserve((featureLists.size() + ... + 0));
+    (featureVector.insert(featureVector.end(), featureLists.begin(), featureLists.end()), ...);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename... Ts>
+pandora::StatusCode MvaFeaturePipeline<Ts...>::Initialize(const pandora::StringVector &featureToolOrder, const MvaFeatureToolMap<Ts...> &featureToolMap)
+{
+    m_featureToolNames.clear();
+    m_featureToolVector.clear();
+    m_toolEndSlots.clear();
+    m_featureOrder.clear();
+    m_featureVector.clear();
+
+    for (const std::string &featureToolName : featureToolOrder)
+    {
+        const typename MvaFeatureToolMap<Ts...>::const_iterator iter(featureToolMap.find(featureToolName));
+
+        if (featureToolMap.end() == iter)
+        {
+            std::cout << "MvaFeaturePipeline::Initialize - Error: feature tool " << featureToolName << " not found." << std::endl;
+            return pandora::STATUS_CODE_NOT_FOUND;
+        }
+
+        m_featureToolNames.push_back(featureToolName);
+        m_featureToolVector.push_back(iter->second);
+    }
+
+    return pandora::STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename... Ts>
+template <typename... TARGS>
+const MvaTypes::MvaFeatureVector &MvaFeaturePipeline<Ts...>::CalculateFeatures(TARGS &&... args)
+{
+    m_featureVector.clear();
+
+    if (m_toolEndSlots.empty() && !m_featureToolVector.empty())
+    {
+        // The first calculation establishes the feature names and slots
+        MvaTypes::MvaFeatureMap featureMap;
+        pandora::StringVector featureOrder;
+        SlotVector toolEndSlots;
+
+        for (unsigned int iTool = 0; iTool < m_featureToolVector.size(); ++iTool)
+        {
+            m_featureToolVector.at(iTool)->Run(featureMap, featureOrder, m_featureToolNames.at(iTool), std::forward<TARGS>(args)...);
+            toolEndSlots.push_back(featureOrder.size());
+        }
+
+        for (const std::string &featureName : featureOrder)
+            m_featureVector.push_back(featureMap.at(featureName));
+
+        m_toolEndSlots = toolEndSlots;
+        m_featureOrder = featureOrder;
+
+        return m_featureVector;
+    }
+
+    for (unsigned int iTool = 0; iTool < m_featureToolVector.size(); ++iTool)
+    {
+        m_featureToolVector.at(iTool)->Run(m_featureVector, std::forward<TARGS>(args)...);
+
+        if (m_featureVector.size() != m_toolEndSlots.at(iTool))
+        {
+            std::cout << "MvaFeaturePipeline::CalculateFeatures - Error: feature tool " << m_featureToolNames.at(iTool)
+                      << " did not provide its expected number of features." << std::endl;
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
+        }
+    }
+
+    return m_featureVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename... Ts>
+inline const pandora::StringVector &MvaFeaturePipeline<Ts...>::GetFeatureOrder() const
+{
+    return m_featureOrder;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_MVA_HELPER_H
@@ -0,0 +1,77 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArParallelHelper.cc
+ *
+ *  @brief  Implementation of the parallel helper class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace lar_content
+{
+
+void LArParallelHelper::ParallelFor(const unsigned int nTasks, const unsigned int nThreads, const IndexedTask &task)
+{
+    const unsigned int nWorkers(std::min(nTasks, nThreads));
+
+    if (nWorkers < 2)
+    {
+        for (unsigned int index = 0; index < nTasks; ++index)
+            task(index);
+
+        return;
+    }
+
+    std::atomic<unsigned int> nextIndex(0);
+    std::vector<std::exception_ptr> exceptions(nTasks);
+
+    auto worker = [&]() {
+        for (unsigned int index = nextIndex++; index < nTasks; index = nextIndex++)
+        {
+            try
+            {
+                task(index);
+            }
+            catch (...)
+            {
+                exceptions[index] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(nWorkers - 1);
+
+    for (unsigned int iThread = 1; iThread < nWorkers; ++iThread)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    for (const std::exception_ptr &pException : exceptions)
+    {
+        if (pException)
+            std::rethrow_exception(pException);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int LArParallelHelper::GetNThreads(const unsigned int nRequestedThreads)
+{
+    if (nRequestedThreads > 0)
+        return nRequestedThreads;
+
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+} // namespace lar_content
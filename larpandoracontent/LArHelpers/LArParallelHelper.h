@@ -0,0 +1,47 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArParallelHelper.h
+ *
+ *  @brief  Header file for the parallel helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_PARALLEL_HELPER_H
+#define LAR_PARALLEL_HELPER_H 1
+
+#include <functional>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArParallelHelper class
+ */
+class LArParallelHelper
+{
+public:
+    typedef std::function<void(const unsigned int)> IndexedTask;
+
+    /**
+     *  @brief  Run a task for each index in [0, nTasks), distributing the indices over a number of threads. The tasks must only read
+     *          shared (Pandora) state, and must write their results to distinct, pre-allocated locations. If any task throws, the
+     *          exception from the lowest task index is rethrown once all threads have joined, so failures are reproducible.
+     *
+     *  @param  nTasks the number of tasks
+     *  @param  nThreads the maximum number of threads to use; values less than two run all tasks, in order, on the calling thread
+     *  @param  task the task to run for each index
+     */
+    static void ParallelFor(const unsigned int nTasks, const unsigned int nThreads, const IndexedTask &task);
+
+    /**
+     *  @brief  Get the number of threads to use for a requested number, where zero requests the hardware concurrency
+     *
+     *  @param  nRequestedThreads the requested number of threads
+     *
+     *  @return the number of threads to use
+     */
+    static unsigned int GetNThreads(const unsigned int nRequestedThreads);
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_PARALLEL_HELPER_H
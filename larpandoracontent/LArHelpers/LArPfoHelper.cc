@@ -148,39 +148,28 @@ void LArPfoHelper::GetThreeDClusterList(const ParticleFlowObject *const pPfo, Cl
 
 void LArPfoHelper::GetAllConnectedPfos(const PfoList &inputPfoList, PfoList &outputPfoList)
 {
-    for (const ParticleFlowObject *const pPfo : inputPfoList)
-        LArPfoHelper::GetAllConnectedPfos(pPfo, outputPfoList);
+    LArPfoHelper::GetAllHierarchyPfos(inputPfoList, true, outputPfoList);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void LArPfoHelper::GetAllConnectedPfos(const ParticleFlowObject *const pPfo, PfoList &outputPfoList)
 {
-    if (outputPfoList.end() != std::find(outputPfoList.begin(), outputPfoList.end(), pPfo))
-        return;
-
-    outputPfoList.push_back(pPfo);
-    LArPfoHelper::GetAllConnectedPfos(pPfo->GetParentPfoList(), outputPfoList);
-    LArPfoHelper::GetAllConnectedPfos(pPfo->GetDaughterPfoList(), outputPfoList);
+    LArPfoHelper::GetAllHierarchyPfos(PfoList(1, pPfo), true, outputPfoList);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void LArPfoHelper::GetAllDownstreamPfos(const PfoList &inputPfoList, PfoList &outputPfoList)
 {
-    for (const ParticleFlowObject *const pPfo : inputPfoList)
-        LArPfoHelper::GetAllDownstreamPfos(pPfo, outputPfoList);
+    LArPfoHelper::GetAllHierarchyPfos(inputPfoList, false, outputPfoList);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void LArPfoHelper::GetAllDownstreamPfos(const ParticleFlowObject *const pPfo, PfoList &outputPfoList)
 {
-    if (outputPfoList.end() != std::find(outputPfoList.begin(), outputPfoList.end(), pPfo))
-        return;
-
-    outputPfoList.push_back(pPfo);
-    LArPfoHelper::GetAllDownstreamPfos(pPfo->GetDaughterPfoList(), outputPfoList);
+    LArPfoHelper::GetAllHierarchyPfos(PfoList(1, pPfo), false, outputPfoList);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -188,29 +177,40 @@ void LArPfoHelper::GetAllDownstreamPfos(const ParticleFlowObject *const pPfo, Pf
 void LArPfoHelper::GetAllDownstreamPfos(
     const pandora::ParticleFlowObject *const pPfo, pandora::PfoList &outputTrackPfoList, pandora::PfoList &outputLeadingShowerPfoList)
 {
-    if (LArPfoHelper::IsTrack(pPfo))
+    if (!LArPfoHelper::IsTrack(pPfo))
     {
-        outputTrackPfoList.emplace_back(pPfo);
-        for (const ParticleFlowObject *pChild : pPfo->GetDaughterPfoList())
-        {
-            if (std::find(outputTrackPfoList.begin(), outputTrackPfoList.end(), pChild) == outputTrackPfoList.end())
-            {
-                const int pdg{std::abs(pChild->GetParticleId())};
-                if (pdg == E_MINUS)
-                {
-                    outputLeadingShowerPfoList.emplace_back(pChild);
-                }
-                else
-                {
-                    outputTrackPfoList.emplace_back(pChild);
-                    LArPfoHelper::GetAllDownstreamPfos(pChild, outputTrackPfoList, outputLeadingShowerPfoList);
-                }
-            }
-        }
+        outputLeadingShowerPfoList.emplace_back(pPfo);
+        return;
     }
-    else
+
+    PfoSet visitedPfos(outputTrackPfoList.begin(), outputTrackPfoList.end());
+    PfoVector pfoStack(1, pPfo);
+
+    while (!pfoStack.empty())
     {
-        outputLeadingShowerPfoList.emplace_back(pPfo);
+        const ParticleFlowObject *const pCurrentPfo(pfoStack.back());
+        pfoStack.pop_back();
+
+        if (!visitedPfos.insert(pCurrentPfo).second)
+            continue;
+
+        // ATTN Traversal stops at leading electrons; other non-track descendants are listed as both track-like and leading showers
+        if ((pCurrentPfo != pPfo) && (E_MINUS == std::abs(pCurrentPfo->GetParticleId())))
+        {
+            outputLeadingShowerPfoList.emplace_back(pCurrentPfo);
+            continue;
+        }
+
+        outputTrackPfoList.emplace_back(pCurrentPfo);
+
+        if (!LArPfoHelper::IsTrack(pCurrentPfo))
+        {
+            outputLeadingShowerPfoList.emplace_back(pCurrentPfo);
+            continue;
+        }
+
+        const PfoList &daughterPfoList(pCurrentPfo->GetDaughterPfoList());
+        pfoStack.insert(pfoStack.end(), daughterPfoList.rbegin(), daughterPfoList.rend());
     }
 }
 
@@ -235,6 +235,40 @@ int LArPfoHelper::GetHierarchyTier(const ParticleFlowObject *const pPfo)
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArPfoHelper::GetAllHierarchyPfos(const PfoList &inputPfoList, const bool includeParents, PfoList &outputPfoList)
+{
+    PfoSet visitedPfos(outputPfoList.begin(), outputPfoList.end());
+    PfoVector pfoStack;
+
+    for (const ParticleFlowObject *const pInputPfo : inputPfoList)
+    {
+        pfoStack.push_back(pInputPfo);
+
+        while (!pfoStack.empty())
+        {
+            const ParticleFlowObject *const pPfo(pfoStack.back());
+            pfoStack.pop_back();
+
+            if (!visitedPfos.insert(pPfo).second)
+                continue;
+
+            outputPfoList.push_back(pPfo);
+
+            // ATTN Stack in reverse order, so that the pfos are output in the same depth-first order as a recursive traversal
+            const PfoList &daughterPfoList(pPfo->GetDaughterPfoList());
+            pfoStack.insert(pfoStack.end(), daughterPfoList.rbegin(), daughterPfoList.rend());
+
+            if (includeParents)
+            {
+                const PfoList &parentPfoList(pPfo->GetParentPfoList());
+                pfoStack.insert(pfoStack.end(), parentPfoList.rbegin(), parentPfoList.rend());
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float LArPfoHelper::GetTwoDLengthSquared(const ParticleFlowObject *const pPfo)
 {
     if (!LArPfoHelper::IsTwoD(pPfo))
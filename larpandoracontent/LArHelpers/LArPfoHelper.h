@@ -410,6 +410,15 @@ public:
     static void GetBreadthFirstHierarchyRepresentation(const pandora::ParticleFlowObject *const pPfo, pandora::PfoList &pfoList);
 
 private:
+    /**
+     *  @brief  Append, without duplicates, the pfos reached by a depth-first traversal of the hierarchy from the pfos in an input list
+     *
+     *  @param  inputPfoList the input pfo list
+     *  @param  includeParents whether to follow links to parents, as well as to daughters
+     *  @param  outputPfoList to receive the output pfo list
+     */
+    static void GetAllHierarchyPfos(const pandora::PfoList &inputPfoList, const bool includeParents, pandora::PfoList &outputPfoList);
+
     /**
      *  @brief  Implementation of sliding fit trajectory extraction
      *
@@ -0,0 +1,107 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArProcessingBudgetHelper.cc
+ *
+ *  @brief  Implementation of the processing budget helper class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/Pandora.h"
+
+#include "larpandoracontent/LArHelpers/LArProcessingBudgetHelper.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+LArProcessingBudgetHelper::Checkpoint::Checkpoint(const Pandora &pandora) :
+    m_pBudget(LArProcessingBudgetHelper::GetBudget(pandora))
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArProcessingBudgetHelper::Checkpoint::IsExhausted(const unsigned int nWorkUnits)
+{
+    if (!m_pBudget)
+        return false;
+
+    if (m_pBudget->m_isExhausted)
+        return true;
+
+    m_pBudget->m_nWorkUnits += nWorkUnits;
+
+    if ((m_pBudget->m_maxWorkUnits > 0) && (m_pBudget->m_nWorkUnits > m_pBudget->m_maxWorkUnits))
+        m_pBudget->m_isExhausted = true;
+
+    if (m_pBudget->m_hasDeadline && (std::chrono::steady_clock::now() >= m_pBudget->m_deadline))
+        m_pBudget->m_isExhausted = true;
+
+    return m_pBudget->m_isExhausted;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProcessingBudgetHelper::StartBudget(const Pandora &pandora, const float maxTime, const unsigned int maxWorkUnits)
+{
+    Registry &registry(GetRegistry());
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+    registry.m_budgetMap.erase(&pandora);
+    registry.m_budgetMap.emplace(&pandora, Budget(maxTime, maxWorkUnits));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArProcessingBudgetHelper::StopBudget(const Pandora &pandora)
+{
+    Registry &registry(GetRegistry());
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+    const BudgetMap::iterator iter(registry.m_budgetMap.find(&pandora));
+
+    if (registry.m_budgetMap.end() == iter)
+        return false;
+
+    const bool isExhausted(iter->second.m_isExhausted);
+    registry.m_budgetMap.erase(iter);
+
+    return isExhausted;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArProcessingBudgetHelper::Registry &LArProcessingBudgetHelper::GetRegistry()
+{
+    static Registry registry;
+    return registry;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArProcessingBudgetHelper::Budget *LArProcessingBudgetHelper::GetBudget(const Pandora &pandora)
+{
+    Registry &registry(GetRegistry());
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+    const BudgetMap::iterator iter(registry.m_budgetMap.find(&pandora));
+
+    return ((registry.m_budgetMap.end() != iter) ? &(iter->second) : nullptr);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArProcessingBudgetHelper::Budget::Budget(const float maxTime, const unsigned int maxWorkUnits) :
+    m_hasDeadline(maxTime > 0.f),
+    m_deadline(std::chrono::steady_clock::now() +
+               std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(m_hasDeadline ? maxTime : 0.f))),
+    m_maxWorkUnits(maxWorkUnits),
+    m_nWorkUnits(0),
+    m_isExhausted(false)
+{
+}
+
+} // namespace lar_content
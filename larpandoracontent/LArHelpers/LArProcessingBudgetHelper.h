@@ -0,0 +1,135 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArProcessingBudgetHelper.h
+ *
+ *  @brief  Header file for the processing budget helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_PROCESSING_BUDGET_HELPER_H
+#define LAR_PROCESSING_BUDGET_HELPER_H 1
+
+#include <chrono>
+#include <map>
+#include <mutex>
+
+namespace pandora
+{
+class Pandora;
+} // namespace pandora
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArProcessingBudgetHelper class, which holds the time and work budgets set for pandora instances (e.g. by the master algorithm,
+ *          for each slice processed by a worker instance). Algorithms cooperate with a budget by polling a checkpoint in their most
+ *          expensive loops and cutting the remaining work short once the budget is exhausted, leaving their output consistent. Where no
+ *          budget has been set, each checkpoint costs a single pointer check.
+ */
+class LArProcessingBudgetHelper
+{
+private:
+    class Budget;
+
+public:
+    /**
+     *  @brief  Checkpoint class, held by an algorithm for the duration of its processing, to poll the budget of its pandora instance
+     */
+    class Checkpoint
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pandora the pandora instance running the algorithm
+         */
+        Checkpoint(const pandora::Pandora &pandora);
+
+        /**
+         *  @brief  Charge work to the budget and check whether the budget is exhausted. Once exhausted, a budget remains exhausted.
+         *
+         *  @param  nWorkUnits the number of work units to charge, e.g. the number of combinations about to be evaluated
+         *
+         *  @return whether the budget is exhausted, always false if no budget has been set
+         */
+        bool IsExhausted(const unsigned int nWorkUnits = 0);
+
+    private:
+        Budget *const m_pBudget; ///< The address of the budget, nullptr if no budget has been set
+    };
+
+    /**
+     *  @brief  Start a budget for a pandora instance, replacing any existing budget. The budget must be stopped before the pandora instance
+     *          is used with no budget, and must only be polled by the thread running the pandora instance.
+     *
+     *  @param  pandora the pandora instance
+     *  @param  maxTime the max time from now, units s, or zero for no time limit
+     *  @param  maxWorkUnits the max number of work units, or zero for no work limit
+     */
+    static void StartBudget(const pandora::Pandora &pandora, const float maxTime, const unsigned int maxWorkUnits);
+
+    /**
+     *  @brief  Stop the budget for a pandora instance
+     *
+     *  @param  pandora the pandora instance
+     *
+     *  @return whether the budget was found to be exhausted at any checkpoint
+     */
+    static bool StopBudget(const pandora::Pandora &pandora);
+
+private:
+    /**
+     *  @brief  Budget class
+     */
+    class Budget
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  maxTime the max time from now, units s, or zero for no time limit
+         *  @param  maxWorkUnits the max number of work units, or zero for no work limit
+         */
+        Budget(const float maxTime, const unsigned int maxWorkUnits);
+
+        bool m_hasDeadline;                               ///< Whether the budget has a time limit
+        std::chrono::steady_clock::time_point m_deadline; ///< The time at which the budget is exhausted
+        unsigned long long m_maxWorkUnits;                ///< The max number of work units, or zero for no work limit
+        unsigned long long m_nWorkUnits;                  ///< The number of work units charged so far
+        bool m_isExhausted;                               ///< Whether the budget has been found to be exhausted
+    };
+
+    typedef std::map<const pandora::Pandora *, Budget> BudgetMap;
+
+    /**
+     *  @brief  Registry class, holding the budgets
+     */
+    class Registry
+    {
+    public:
+        BudgetMap m_budgetMap; ///< The budget of each pandora instance with a budget set
+        std::mutex m_mutex;    ///< The mutex serialising changes to the budget map
+    };
+
+    /**
+     *  @brief  Get the registry
+     *
+     *  @return the registry
+     */
+    static Registry &GetRegistry();
+
+    /**
+     *  @brief  Get the budget for a pandora instance
+     *
+     *  @param  pandora the pandora instance
+     *
+     *  @return the address of the budget, nullptr if no budget has been set
+     */
+    static Budget *GetBudget(const pandora::Pandora &pandora);
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_PROCESSING_BUDGET_HELPER_H
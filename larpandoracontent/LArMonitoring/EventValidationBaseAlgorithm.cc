@@ -30,7 +30,9 @@ EventValidationBaseAlgorithm::EventValidationBaseAlgorithm() :
     m_useSmallPrimaries(true),
     m_matchingMinSharedHits(5),
     m_matchingMinCompleteness(0.1f),
-    m_matchingMinPurity(0.5f)
+    m_matchingMinPurity(0.5f),
+    m_outputFormat("root"),
+    m_maxBufferedOutputEntries(1000)
 {
 }
 
@@ -38,16 +40,10 @@ EventValidationBaseAlgorithm::EventValidationBaseAlgorithm() :
 
 EventValidationBaseAlgorithm::~EventValidationBaseAlgorithm()
 {
-    if (m_writeToTree)
+    if (m_writeToTree && m_pOutputSink)
     {
-        try
-        {
-            PANDORA_MONITORING_API(SaveTree(this->GetPandora(), m_treeName.c_str(), m_fileName.c_str(), "UPDATE"));
-        }
-        catch (const StatusCodeException &)
-        {
+        if (STATUS_CODE_SUCCESS != m_pOutputSink->Close())
             std::cout << "EventValidationBaseAlgorithm: Unable to write tree " << m_treeName << " to file " << m_fileName << std::endl;
-        }
     }
 }
 
@@ -264,6 +260,21 @@ StatusCode EventValidationBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandl
 
         PANDORA_RETURN_RESULT_IF_AND_IF(
             STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "FileIdentifier", m_fileIdentifier));
+
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "OutputFormat", m_outputFormat));
+
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+            XmlHelper::ReadValue(xmlHandle, "MaxBufferedOutputEntries", m_maxBufferedOutputEntries));
+
+        if (0 == m_maxBufferedOutputEntries)
+            return STATUS_CODE_INVALID_PARAMETER;
+
+        m_pOutputSink =
+            ValidationOutputSink::Create(m_outputFormat, this->GetPandora(), m_treeName, m_fileName, m_maxBufferedOutputEntries);
+
+        if (!m_pOutputSink)
+            return STATUS_CODE_INVALID_PARAMETER;
     }
 
     return STATUS_CODE_SUCCESS;
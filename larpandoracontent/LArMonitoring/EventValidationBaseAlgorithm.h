@@ -12,11 +12,14 @@
 
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 
+#include "larpandoracontent/LArObjects/LArValidationOutputSink.h"
+
 #ifdef MONITORING
 #include "PandoraMonitoringApi.h"
 #endif
 
 #include <map>
+#include <memory>
 
 namespace lar_content
 {
@@ -193,7 +196,8 @@ protected:
     int m_fileIdentifier;                                       ///< The input file identifier
     int m_eventNumber;                                          ///< The event number
 
-    std::string m_treeName; ///< Name of output tree
+    std::string m_treeName;                              ///< Name of output tree
+    std::unique_ptr<ValidationOutputSink> m_pOutputSink; ///< The sink for the output tree, created if writing to tree
 
 private:
     pandora::StatusCode Run();
@@ -232,7 +236,9 @@ private:
     float m_matchingMinCompleteness;      ///< The minimum particle completeness to declare a match
     float m_matchingMinPurity;            ///< The minimum particle purity to declare a match
 
-    std::string m_fileName; ///< Name of output file
+    std::string m_fileName;                  ///< Name of output file
+    std::string m_outputFormat;              ///< The output tree format, root or columnar
+    unsigned int m_maxBufferedOutputEntries; ///< The number of output entries buffered before they are written (columnar format)
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
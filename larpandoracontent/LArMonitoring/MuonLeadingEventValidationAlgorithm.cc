@@ -271,12 +271,10 @@ void MuonLeadingEventValidationAlgorithm::ProcessOutput(
         // Cosmic ray parameters
         int nReconstructableChildCRLs(0), nCorrectChildCRLs(0);
 
-#ifdef MONITORING
         int ID_CR(0);
         float mcE_CR(0.f), mcPX_CR(0.f), mcPY_CR(0.f), mcPZ_CR(0.f);
         int nMCHitsTotal_CR(0), nMCHitsU_CR(0), nMCHitsV_CR(0), nMCHitsW_CR(0);
         float mcVertexX_CR(0.f), mcVertexY_CR(0.f), mcVertexZ_CR(0.f), mcEndX_CR(0.f), mcEndY_CR(0.f), mcEndZ_CR(0.f);
-#endif
 
         // Leading particle parameters
         FloatVector mcE_CRL, mcPX_CRL, mcPY_CRL, mcPZ_CRL;
@@ -356,7 +354,6 @@ void MuonLeadingEventValidationAlgorithm::ProcessOutput(
         }
         ///////////////////////////////
 
-#ifdef MONITORING
         ID_CR = muonCount;
         mcE_CR = pCosmicRay->GetEnergy();
         mcPX_CR = pCosmicRay->GetMomentum().GetX();
@@ -372,7 +369,6 @@ void MuonLeadingEventValidationAlgorithm::ProcessOutput(
         nMCHitsU_CR = LArMonitoringHelper::CountHitsByType(TPC_VIEW_U, cosmicRayHitList);
         nMCHitsV_CR = LArMonitoringHelper::CountHitsByType(TPC_VIEW_V, cosmicRayHitList);
         nMCHitsW_CR = LArMonitoringHelper::CountHitsByType(TPC_VIEW_W, cosmicRayHitList);
-#endif
         nReconstructableChildCRLs = childLeadingParticles.size();
 
         stringStream << "\033[34m"
@@ -672,102 +668,78 @@ void MuonLeadingEventValidationAlgorithm::ProcessOutput(
 
         if (fillTree)
         {
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "eventNumber", m_eventNumber - 1));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "ID_CR", ID_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcE_CR", mcE_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPX_CR", mcPX_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPY_CR", mcPY_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPZ_CR", mcPZ_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nMCHitsTotal_CR", nMCHitsTotal_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nMCHitsU_CR", nMCHitsU_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nMCHitsV_CR", nMCHitsV_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nMCHitsW_CR", nMCHitsW_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcVertexX_CR", mcVertexX_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcVertexY_CR", mcVertexY_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcVertexZ_CR", mcVertexZ_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcEndX_CR", mcEndX_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcEndY_CR", mcEndY_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcEndZ_CR", mcEndZ_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nReconstructableChildCRLs", nReconstructableChildCRLs));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nCorrectChildCRLs", nCorrectChildCRLs));
-
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "ID_CRL", &ID_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcE_CRL", &mcE_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPX_CRL", &mcPX_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPY_CRL", &mcPY_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPZ_CRL", &mcPZ_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nMCHitsTotal_CRL", &nMCHitsTotal_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nMCHitsU_CRL", &nMCHitsU_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nMCHitsV_CRL", &nMCHitsV_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nMCHitsW_CRL", &nMCHitsW_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcVertexX_CRL", &mcVertexX_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcVertexY_CRL", &mcVertexY_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcVertexZ_CRL", &mcVertexZ_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcEndX_CRL", &mcEndX_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcEndY_CRL", &mcEndY_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcEndZ_CRL", &mcEndZ_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nAboveThresholdMatches_CRL", &nAboveThresholdMatches_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCorrect_CRL", &isCorrect_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCorrectParentLink_CRL", &isCorrectParentLink_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNHitsTotal_CRL", &bestMatchNHitsTotal_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNHitsU_CRL", &bestMatchNHitsU_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNHitsV_CRL", &bestMatchNHitsV_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNHitsW_CRL", &bestMatchNHitsW_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNSharedHitsTotal_CRL", &bestMatchNSharedHitsTotal_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNSharedHitsU_CRL", &bestMatchNSharedHitsU_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNSharedHitsV_CRL", &bestMatchNSharedHitsV_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNSharedHitsW_CRL", &bestMatchNSharedHitsW_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(
-                this->GetPandora(), m_treeName.c_str(), "bestMatchNParentTrackHitsTotal_CRL", &bestMatchNParentTrackHitsTotal_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNParentTrackHitsU_CRL", &bestMatchNParentTrackHitsU_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNParentTrackHitsV_CRL", &bestMatchNParentTrackHitsV_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNParentTrackHitsW_CRL", &bestMatchNParentTrackHitsW_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNOtherTrackHitsTotal_CRL", &bestMatchNOtherTrackHitsTotal_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNOtherTrackHitsU_CRL", &bestMatchNOtherTrackHitsU_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNOtherTrackHitsV_CRL", &bestMatchNOtherTrackHitsV_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNOtherTrackHitsW_CRL", &bestMatchNOtherTrackHitsW_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(
-                this->GetPandora(), m_treeName.c_str(), "bestMatchNOtherShowerHitsTotal_CRL", &bestMatchNOtherShowerHitsTotal_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNOtherShowerHitsU_CRL", &bestMatchNOtherShowerHitsU_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNOtherShowerHitsV_CRL", &bestMatchNOtherShowerHitsV_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNOtherShowerHitsW_CRL", &bestMatchNOtherShowerHitsW_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(
-                this->GetPandora(), m_treeName.c_str(), "totalCRLHitsInBestMatchParentCR_CRL", &totalCRLHitsInBestMatchParentCR_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "uCRLHitsInBestMatchParentCR_CRL", &uCRLHitsInBestMatchParentCR_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "vCRLHitsInBestMatchParentCR_CRL", &vCRLHitsInBestMatchParentCR_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "wCRLHitsInBestMatchParentCR_CRL", &wCRLHitsInBestMatchParentCR_CRL));
-
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchOtherShowerHitsID_CRL", &bestMatchOtherShowerHitsID_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(
-                this->GetPandora(), m_treeName.c_str(), "bestMatchOtherShowerHitsDistance_CRL", &bestMatchOtherShowerHitsDistance_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchOtherTrackHitsID_CRL", &bestMatchOtherTrackHitsID_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(
-                this->GetPandora(), m_treeName.c_str(), "bestMatchOtherTrackHitsDistance_CRL", &bestMatchOtherTrackHitsDistance_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchParentTrackHitsID_CRL", &bestMatchParentTrackHitsID_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(
-                this->GetPandora(), m_treeName.c_str(), "bestMatchParentTrackHitsDistance_CRL", &bestMatchParentTrackHitsDistance_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchCRLHitsInCRID_CRL", &bestMatchCRLHitsInCRID_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchCRLHitsInCRDistance_CRL", &bestMatchCRLHitsInCRDistance_CRL));
-
-            PANDORA_MONITORING_API(FillTree(this->GetPandora(), m_treeName.c_str()));
+            m_pOutputSink->SetValue("eventNumber", m_eventNumber - 1);
+            m_pOutputSink->SetValue("ID_CR", ID_CR);
+            m_pOutputSink->SetValue("mcE_CR", mcE_CR);
+            m_pOutputSink->SetValue("mcPX_CR", mcPX_CR);
+            m_pOutputSink->SetValue("mcPY_CR", mcPY_CR);
+            m_pOutputSink->SetValue("mcPZ_CR", mcPZ_CR);
+            m_pOutputSink->SetValue("nMCHitsTotal_CR", nMCHitsTotal_CR);
+            m_pOutputSink->SetValue("nMCHitsU_CR", nMCHitsU_CR);
+            m_pOutputSink->SetValue("nMCHitsV_CR", nMCHitsV_CR);
+            m_pOutputSink->SetValue("nMCHitsW_CR", nMCHitsW_CR);
+            m_pOutputSink->SetValue("mcVertexX_CR", mcVertexX_CR);
+            m_pOutputSink->SetValue("mcVertexY_CR", mcVertexY_CR);
+            m_pOutputSink->SetValue("mcVertexZ_CR", mcVertexZ_CR);
+            m_pOutputSink->SetValue("mcEndX_CR", mcEndX_CR);
+            m_pOutputSink->SetValue("mcEndY_CR", mcEndY_CR);
+            m_pOutputSink->SetValue("mcEndZ_CR", mcEndZ_CR);
+            m_pOutputSink->SetValue("nReconstructableChildCRLs", nReconstructableChildCRLs);
+            m_pOutputSink->SetValue("nCorrectChildCRLs", nCorrectChildCRLs);
+
+            m_pOutputSink->SetValue("ID_CRL", &ID_CRL);
+            m_pOutputSink->SetValue("mcE_CRL", &mcE_CRL);
+            m_pOutputSink->SetValue("mcPX_CRL", &mcPX_CRL);
+            m_pOutputSink->SetValue("mcPY_CRL", &mcPY_CRL);
+            m_pOutputSink->SetValue("mcPZ_CRL", &mcPZ_CRL);
+            m_pOutputSink->SetValue("nMCHitsTotal_CRL", &nMCHitsTotal_CRL);
+            m_pOutputSink->SetValue("nMCHitsU_CRL", &nMCHitsU_CRL);
+            m_pOutputSink->SetValue("nMCHitsV_CRL", &nMCHitsV_CRL);
+            m_pOutputSink->SetValue("nMCHitsW_CRL", &nMCHitsW_CRL);
+            m_pOutputSink->SetValue("mcVertexX_CRL", &mcVertexX_CRL);
+            m_pOutputSink->SetValue("mcVertexY_CRL", &mcVertexY_CRL);
+            m_pOutputSink->SetValue("mcVertexZ_CRL", &mcVertexZ_CRL);
+            m_pOutputSink->SetValue("mcEndX_CRL", &mcEndX_CRL);
+            m_pOutputSink->SetValue("mcEndY_CRL", &mcEndY_CRL);
+            m_pOutputSink->SetValue("mcEndZ_CRL", &mcEndZ_CRL);
+            m_pOutputSink->SetValue("nAboveThresholdMatches_CRL", &nAboveThresholdMatches_CRL);
+            m_pOutputSink->SetValue("isCorrect_CRL", &isCorrect_CRL);
+            m_pOutputSink->SetValue("isCorrectParentLink_CRL", &isCorrectParentLink_CRL);
+            m_pOutputSink->SetValue("bestMatchNHitsTotal_CRL", &bestMatchNHitsTotal_CRL);
+            m_pOutputSink->SetValue("bestMatchNHitsU_CRL", &bestMatchNHitsU_CRL);
+            m_pOutputSink->SetValue("bestMatchNHitsV_CRL", &bestMatchNHitsV_CRL);
+            m_pOutputSink->SetValue("bestMatchNHitsW_CRL", &bestMatchNHitsW_CRL);
+            m_pOutputSink->SetValue("bestMatchNSharedHitsTotal_CRL", &bestMatchNSharedHitsTotal_CRL);
+            m_pOutputSink->SetValue("bestMatchNSharedHitsU_CRL", &bestMatchNSharedHitsU_CRL);
+            m_pOutputSink->SetValue("bestMatchNSharedHitsV_CRL", &bestMatchNSharedHitsV_CRL);
+            m_pOutputSink->SetValue("bestMatchNSharedHitsW_CRL", &bestMatchNSharedHitsW_CRL);
+            m_pOutputSink->SetValue("bestMatchNParentTrackHitsTotal_CRL", &bestMatchNParentTrackHitsTotal_CRL);
+            m_pOutputSink->SetValue("bestMatchNParentTrackHitsU_CRL", &bestMatchNParentTrackHitsU_CRL);
+            m_pOutputSink->SetValue("bestMatchNParentTrackHitsV_CRL", &bestMatchNParentTrackHitsV_CRL);
+            m_pOutputSink->SetValue("bestMatchNParentTrackHitsW_CRL", &bestMatchNParentTrackHitsW_CRL);
+            m_pOutputSink->SetValue("bestMatchNOtherTrackHitsTotal_CRL", &bestMatchNOtherTrackHitsTotal_CRL);
+            m_pOutputSink->SetValue("bestMatchNOtherTrackHitsU_CRL", &bestMatchNOtherTrackHitsU_CRL);
+            m_pOutputSink->SetValue("bestMatchNOtherTrackHitsV_CRL", &bestMatchNOtherTrackHitsV_CRL);
+            m_pOutputSink->SetValue("bestMatchNOtherTrackHitsW_CRL", &bestMatchNOtherTrackHitsW_CRL);
+            m_pOutputSink->SetValue("bestMatchNOtherShowerHitsTotal_CRL", &bestMatchNOtherShowerHitsTotal_CRL);
+            m_pOutputSink->SetValue("bestMatchNOtherShowerHitsU_CRL", &bestMatchNOtherShowerHitsU_CRL);
+            m_pOutputSink->SetValue("bestMatchNOtherShowerHitsV_CRL", &bestMatchNOtherShowerHitsV_CRL);
+            m_pOutputSink->SetValue("bestMatchNOtherShowerHitsW_CRL", &bestMatchNOtherShowerHitsW_CRL);
+            m_pOutputSink->SetValue("totalCRLHitsInBestMatchParentCR_CRL", &totalCRLHitsInBestMatchParentCR_CRL);
+            m_pOutputSink->SetValue("uCRLHitsInBestMatchParentCR_CRL", &uCRLHitsInBestMatchParentCR_CRL);
+            m_pOutputSink->SetValue("vCRLHitsInBestMatchParentCR_CRL", &vCRLHitsInBestMatchParentCR_CRL);
+            m_pOutputSink->SetValue("wCRLHitsInBestMatchParentCR_CRL", &wCRLHitsInBestMatchParentCR_CRL);
+
+            m_pOutputSink->SetValue("bestMatchOtherShowerHitsID_CRL", &bestMatchOtherShowerHitsID_CRL);
+            m_pOutputSink->SetValue("bestMatchOtherShowerHitsDistance_CRL", &bestMatchOtherShowerHitsDistance_CRL);
+            m_pOutputSink->SetValue("bestMatchOtherTrackHitsID_CRL", &bestMatchOtherTrackHitsID_CRL);
+            m_pOutputSink->SetValue("bestMatchOtherTrackHitsDistance_CRL", &bestMatchOtherTrackHitsDistance_CRL);
+            m_pOutputSink->SetValue("bestMatchParentTrackHitsID_CRL", &bestMatchParentTrackHitsID_CRL);
+            m_pOutputSink->SetValue("bestMatchParentTrackHitsDistance_CRL", &bestMatchParentTrackHitsDistance_CRL);
+            m_pOutputSink->SetValue("bestMatchCRLHitsInCRID_CRL", &bestMatchCRLHitsInCRID_CRL);
+            m_pOutputSink->SetValue("bestMatchCRLHitsInCRDistance_CRL", &bestMatchCRLHitsInCRDistance_CRL);
+
+            m_pOutputSink->Fill();
         }
 
         stringStream << "------------------------------------------------------------------------------------------------" << std::endl;
@@ -175,10 +175,8 @@ void NeutrinoEventValidationAlgorithm::ProcessOutput(
         const int mcNuanceCode(LArMCParticleHelper::GetNuanceCode(LArMCParticleHelper::GetParentMCParticle(pMCPrimary)));
         const int isBeamNeutrinoFinalState(LArMCParticleHelper::IsBeamNeutrinoFinalState(pMCPrimary));
         const int isCosmicRay(LArMCParticleHelper::IsCosmicRay(pMCPrimary));
-#ifdef MONITORING
         const CartesianVector &targetVertex(LArMCParticleHelper::GetParentMCParticle(pMCPrimary)->GetVertex());
         const float targetVertexX(targetVertex.GetX()), targetVertexY(targetVertex.GetY()), targetVertexZ(targetVertex.GetZ());
-#endif
 
         targetSS << (!isTargetPrimary ? "(Non target) " : "") << "PrimaryId " << mcPrimaryIndex << ", Nu " << isBeamNeutrinoFinalState
                  << ", CR " << isCosmicRay << ", MCPDG " << pMCPrimary->GetParticleId() << ", Energy " << pMCPrimary->GetEnergy()
@@ -205,10 +203,8 @@ void NeutrinoEventValidationAlgorithm::ProcessOutput(
         nMCHitsW.push_back(LArMonitoringHelper::CountHitsByType(TPC_VIEW_W, mcPrimaryHitList));
 
         int matchIndex(0), nPrimaryMatches(0), nPrimaryNuMatches(0), nPrimaryCRMatches(0), nPrimaryGoodNuMatches(0), nPrimaryNuSplits(0);
-#ifdef MONITORING
         float recoVertexX(std::numeric_limits<float>::max()), recoVertexY(std::numeric_limits<float>::max()),
             recoVertexZ(std::numeric_limits<float>::max());
-#endif
         for (const LArMCParticleHelper::PfoCaloHitListPair &pfoToSharedHits : mcToPfoHitSharingMap.at(pMCPrimary))
         {
             const CaloHitList &sharedHitList(pfoToSharedHits.second);
@@ -234,7 +230,6 @@ void NeutrinoEventValidationAlgorithm::ProcessOutput(
                 bestMatchPfoNSharedHitsU.push_back(LArMonitoringHelper::CountHitsByType(TPC_VIEW_U, sharedHitList));
                 bestMatchPfoNSharedHitsV.push_back(LArMonitoringHelper::CountHitsByType(TPC_VIEW_V, sharedHitList));
                 bestMatchPfoNSharedHitsW.push_back(LArMonitoringHelper::CountHitsByType(TPC_VIEW_W, sharedHitList));
-#ifdef MONITORING
                 try
                 {
                     const Vertex *const pRecoVertex(LArPfoHelper::GetVertex(
@@ -246,7 +241,6 @@ void NeutrinoEventValidationAlgorithm::ProcessOutput(
                 catch (const StatusCodeException &)
                 {
                 }
-#endif
             }
 
             if (isGoodMatch)
@@ -310,63 +304,61 @@ void NeutrinoEventValidationAlgorithm::ProcessOutput(
 
         if (fillTree)
         {
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "fileIdentifier", m_fileIdentifier));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "eventNumber", m_eventNumber - 1));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcNuanceCode", mcNuanceCode));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isNeutrino", isBeamNeutrinoFinalState));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCosmicRay", isCosmicRay));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetPrimaries", nTargetPrimaries));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexX", targetVertexX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexY", targetVertexY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexZ", targetVertexZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexX", recoVertexX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexY", recoVertexY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexZ", recoVertexZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryId", &mcPrimaryId));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPdg", &mcPrimaryPdg));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryE", &mcPrimaryE));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPX", &mcPrimaryPX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPY", &mcPrimaryPY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPZ", &mcPrimaryPZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxX", &mcPrimaryVtxX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxY", &mcPrimaryVtxY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxZ", &mcPrimaryVtxZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndX", &mcPrimaryEndX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndY", &mcPrimaryEndY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndZ", &mcPrimaryEndZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsTotal", &nMCHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsU", &nMCHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsV", &nMCHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsW", &nMCHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedPfos", &nPrimaryMatchedPfos));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedNuPfos", &nPrimaryMatchedNuPfos));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedCRPfos", &nPrimaryMatchedCRPfos));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoId", &bestMatchPfoId));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoPdg", &bestMatchPfoPdg));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoIsRecoNu", &bestMatchPfoIsRecoNu));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoRecoNuId", &bestMatchPfoRecoNuId));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsTotal", &bestMatchPfoNHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsU", &bestMatchPfoNHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsV", &bestMatchPfoNHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsW", &bestMatchPfoNHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsTotal", &bestMatchPfoNSharedHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsU", &bestMatchPfoNSharedHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsV", &bestMatchPfoNSharedHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsW", &bestMatchPfoNSharedHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetMatches", nTargetMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetNuMatches", nTargetNuMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetCRMatches", nTargetCRMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetGoodNuMatches", nTargetGoodNuMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetNuSplits", nTargetNuSplits));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetNuLosses", nTargetNuLosses));
+            m_pOutputSink->SetValue("fileIdentifier", m_fileIdentifier);
+            m_pOutputSink->SetValue("eventNumber", m_eventNumber - 1);
+            m_pOutputSink->SetValue("mcNuanceCode", mcNuanceCode);
+            m_pOutputSink->SetValue("isNeutrino", isBeamNeutrinoFinalState);
+            m_pOutputSink->SetValue("isCosmicRay", isCosmicRay);
+            m_pOutputSink->SetValue("nTargetPrimaries", nTargetPrimaries);
+            m_pOutputSink->SetValue("targetVertexX", targetVertexX);
+            m_pOutputSink->SetValue("targetVertexY", targetVertexY);
+            m_pOutputSink->SetValue("targetVertexZ", targetVertexZ);
+            m_pOutputSink->SetValue("recoVertexX", recoVertexX);
+            m_pOutputSink->SetValue("recoVertexY", recoVertexY);
+            m_pOutputSink->SetValue("recoVertexZ", recoVertexZ);
+            m_pOutputSink->SetValue("mcPrimaryId", &mcPrimaryId);
+            m_pOutputSink->SetValue("mcPrimaryPdg", &mcPrimaryPdg);
+            m_pOutputSink->SetValue("mcPrimaryE", &mcPrimaryE);
+            m_pOutputSink->SetValue("mcPrimaryPX", &mcPrimaryPX);
+            m_pOutputSink->SetValue("mcPrimaryPY", &mcPrimaryPY);
+            m_pOutputSink->SetValue("mcPrimaryPZ", &mcPrimaryPZ);
+            m_pOutputSink->SetValue("mcPrimaryVtxX", &mcPrimaryVtxX);
+            m_pOutputSink->SetValue("mcPrimaryVtxY", &mcPrimaryVtxY);
+            m_pOutputSink->SetValue("mcPrimaryVtxZ", &mcPrimaryVtxZ);
+            m_pOutputSink->SetValue("mcPrimaryEndX", &mcPrimaryEndX);
+            m_pOutputSink->SetValue("mcPrimaryEndY", &mcPrimaryEndY);
+            m_pOutputSink->SetValue("mcPrimaryEndZ", &mcPrimaryEndZ);
+            m_pOutputSink->SetValue("mcPrimaryNHitsTotal", &nMCHitsTotal);
+            m_pOutputSink->SetValue("mcPrimaryNHitsU", &nMCHitsU);
+            m_pOutputSink->SetValue("mcPrimaryNHitsV", &nMCHitsV);
+            m_pOutputSink->SetValue("mcPrimaryNHitsW", &nMCHitsW);
+            m_pOutputSink->SetValue("nPrimaryMatchedPfos", &nPrimaryMatchedPfos);
+            m_pOutputSink->SetValue("nPrimaryMatchedNuPfos", &nPrimaryMatchedNuPfos);
+            m_pOutputSink->SetValue("nPrimaryMatchedCRPfos", &nPrimaryMatchedCRPfos);
+            m_pOutputSink->SetValue("bestMatchPfoId", &bestMatchPfoId);
+            m_pOutputSink->SetValue("bestMatchPfoPdg", &bestMatchPfoPdg);
+            m_pOutputSink->SetValue("bestMatchPfoIsRecoNu", &bestMatchPfoIsRecoNu);
+            m_pOutputSink->SetValue("bestMatchPfoRecoNuId", &bestMatchPfoRecoNuId);
+            m_pOutputSink->SetValue("bestMatchPfoNHitsTotal", &bestMatchPfoNHitsTotal);
+            m_pOutputSink->SetValue("bestMatchPfoNHitsU", &bestMatchPfoNHitsU);
+            m_pOutputSink->SetValue("bestMatchPfoNHitsV", &bestMatchPfoNHitsV);
+            m_pOutputSink->SetValue("bestMatchPfoNHitsW", &bestMatchPfoNHitsW);
+            m_pOutputSink->SetValue("bestMatchPfoNSharedHitsTotal", &bestMatchPfoNSharedHitsTotal);
+            m_pOutputSink->SetValue("bestMatchPfoNSharedHitsU", &bestMatchPfoNSharedHitsU);
+            m_pOutputSink->SetValue("bestMatchPfoNSharedHitsV", &bestMatchPfoNSharedHitsV);
+            m_pOutputSink->SetValue("bestMatchPfoNSharedHitsW", &bestMatchPfoNSharedHitsW);
+            m_pOutputSink->SetValue("nTargetMatches", nTargetMatches);
+            m_pOutputSink->SetValue("nTargetNuMatches", nTargetNuMatches);
+            m_pOutputSink->SetValue("nTargetCRMatches", nTargetCRMatches);
+            m_pOutputSink->SetValue("nTargetGoodNuMatches", nTargetGoodNuMatches);
+            m_pOutputSink->SetValue("nTargetNuSplits", nTargetNuSplits);
+            m_pOutputSink->SetValue("nTargetNuLosses", nTargetNuLosses);
         }
 
         if (isLastNeutrinoPrimary || isCosmicRay)
         {
             const LArInteractionTypeHelper::InteractionType interactionType(LArInteractionTypeHelper::GetInteractionType(associatedMCPrimaries));
-#ifdef MONITORING
             const int interactionTypeInt(static_cast<int>(interactionType));
-#endif
             // ATTN Some redundancy introduced to contributing variables
             const int isCorrectNu(isBeamNeutrinoFinalState && (nTargetGoodNuMatches == nTargetNuMatches) && (nTargetGoodNuMatches == nTargetPrimaries) &&
                                   (nTargetCRMatches == 0) && (nTargetNuSplits == 0) && (nTargetNuLosses == 0));
@@ -427,15 +419,15 @@ void NeutrinoEventValidationAlgorithm::ProcessOutput(
 
             if (fillTree)
             {
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "interactionType", interactionTypeInt));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCorrectNu", isCorrectNu));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCorrectCR", isCorrectCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isFakeNu", isFakeNu));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isFakeCR", isFakeCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isSplitNu", isSplitNu));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isSplitCR", isSplitCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isLost", isLost));
-                PANDORA_MONITORING_API(FillTree(this->GetPandora(), m_treeName.c_str()));
+                m_pOutputSink->SetValue("interactionType", interactionTypeInt);
+                m_pOutputSink->SetValue("isCorrectNu", isCorrectNu);
+                m_pOutputSink->SetValue("isCorrectCR", isCorrectCR);
+                m_pOutputSink->SetValue("isFakeNu", isFakeNu);
+                m_pOutputSink->SetValue("isFakeCR", isFakeCR);
+                m_pOutputSink->SetValue("isSplitNu", isSplitNu);
+                m_pOutputSink->SetValue("isSplitCR", isSplitCR);
+                m_pOutputSink->SetValue("isLost", isLost);
+                m_pOutputSink->Fill();
             }
 
             targetSS.str(std::string());
@@ -154,11 +154,9 @@ void TestBeamEventValidationAlgorithm::ProcessOutput(
         const int mcNuanceCode(LArMCParticleHelper::GetNuanceCode(LArMCParticleHelper::GetParentMCParticle(pMCPrimary)));
         const int isBeamParticle(LArMCParticleHelper::IsBeamParticle(pMCPrimary));
         const int isCosmicRay(LArMCParticleHelper::IsCosmicRay(pMCPrimary));
-#ifdef MONITORING
         const int nTargetPrimaries(associatedMCPrimaries.size());
         const CartesianVector &targetVertex(LArMCParticleHelper::GetParentMCParticle(pMCPrimary)->GetVertex());
         const float targetVertexX(targetVertex.GetX()), targetVertexY(targetVertex.GetY()), targetVertexZ(targetVertex.GetZ());
-#endif
 
         targetSS << (!isTargetPrimary ? "(Non target) " : "") << "PrimaryId " << mcPrimaryIndex << ", TB " << isBeamParticle << ", CR "
                  << isCosmicRay << ", MCPDG " << pMCPrimary->GetParticleId() << ", Energy " << pMCPrimary->GetEnergy() << ", Dist. "
@@ -185,10 +183,8 @@ void TestBeamEventValidationAlgorithm::ProcessOutput(
         nMCHitsW.push_back(LArMonitoringHelper::CountHitsByType(TPC_VIEW_W, mcPrimaryHitList));
 
         int matchIndex(0), nPrimaryMatches(0), nPrimaryTBMatches(0), nPrimaryCRMatches(0);
-#ifdef MONITORING
         float recoVertexX(std::numeric_limits<float>::max()), recoVertexY(std::numeric_limits<float>::max()),
             recoVertexZ(std::numeric_limits<float>::max());
-#endif
         for (const LArMCParticleHelper::PfoCaloHitListPair &pfoToSharedHits : mcToPfoHitSharingMap.at(pMCPrimary))
         {
             const CaloHitList &sharedHitList(pfoToSharedHits.second);
@@ -214,7 +210,6 @@ void TestBeamEventValidationAlgorithm::ProcessOutput(
                 bestMatchPfoNSharedHitsW.push_back(LArMonitoringHelper::CountHitsByType(TPC_VIEW_W, sharedHitList));
                 bestMatchPfoX0.push_back(pfoToSharedHits.first->GetPropertiesMap().count("X0") ? pfoToSharedHits.first->GetPropertiesMap().at("X0")
                                                                                                : std::numeric_limits<float>::max());
-#ifdef MONITORING
                 try
                 {
                     const Vertex *const pRecoVertex(isRecoTestBeam ? LArPfoHelper::GetTestBeamInteractionVertex(pfoToSharedHits.first)
@@ -226,7 +221,6 @@ void TestBeamEventValidationAlgorithm::ProcessOutput(
                 catch (const StatusCodeException &)
                 {
                 }
-#endif
             }
 
             if (isGoodMatch)
@@ -273,60 +267,58 @@ void TestBeamEventValidationAlgorithm::ProcessOutput(
 
         if (fillTree)
         {
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "fileIdentifier", m_fileIdentifier));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "eventNumber", eventNumber));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcNuanceCode", mcNuanceCode));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isBeamParticle", isBeamParticle));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCosmicRay", isCosmicRay));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetPrimaries", nTargetPrimaries));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexX", targetVertexX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexY", targetVertexY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexZ", targetVertexZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexX", recoVertexX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexY", recoVertexY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexZ", recoVertexZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryId", &mcPrimaryId));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPdg", &mcPrimaryPdg));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryE", &mcPrimaryE));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPX", &mcPrimaryPX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPY", &mcPrimaryPY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPZ", &mcPrimaryPZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxX", &mcPrimaryVtxX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxY", &mcPrimaryVtxY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxZ", &mcPrimaryVtxZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndX", &mcPrimaryEndX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndY", &mcPrimaryEndY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndZ", &mcPrimaryEndZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsTotal", &nMCHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsU", &nMCHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsV", &nMCHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsW", &nMCHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedPfos", &nPrimaryMatchedPfos));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedTBPfos", &nPrimaryMatchedTBPfos));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedCRPfos", &nPrimaryMatchedCRPfos));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoId", &bestMatchPfoId));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoPdg", &bestMatchPfoPdg));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsTotal", &bestMatchPfoNHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsU", &bestMatchPfoNHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsV", &bestMatchPfoNHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsW", &bestMatchPfoNHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsTotal", &bestMatchPfoNSharedHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsU", &bestMatchPfoNSharedHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsV", &bestMatchPfoNSharedHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsW", &bestMatchPfoNSharedHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoX0", &bestMatchPfoX0));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetMatches", nTargetMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetTBMatches", nTargetTBMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetCRMatches", nTargetCRMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoIsTB", &bestMatchPfoIsTB));
+            m_pOutputSink->SetValue("fileIdentifier", m_fileIdentifier);
+            m_pOutputSink->SetValue("eventNumber", eventNumber);
+            m_pOutputSink->SetValue("mcNuanceCode", mcNuanceCode);
+            m_pOutputSink->SetValue("isBeamParticle", isBeamParticle);
+            m_pOutputSink->SetValue("isCosmicRay", isCosmicRay);
+            m_pOutputSink->SetValue("nTargetPrimaries", nTargetPrimaries);
+            m_pOutputSink->SetValue("targetVertexX", targetVertexX);
+            m_pOutputSink->SetValue("targetVertexY", targetVertexY);
+            m_pOutputSink->SetValue("targetVertexZ", targetVertexZ);
+            m_pOutputSink->SetValue("recoVertexX", recoVertexX);
+            m_pOutputSink->SetValue("recoVertexY", recoVertexY);
+            m_pOutputSink->SetValue("recoVertexZ", recoVertexZ);
+            m_pOutputSink->SetValue("mcPrimaryId", &mcPrimaryId);
+            m_pOutputSink->SetValue("mcPrimaryPdg", &mcPrimaryPdg);
+            m_pOutputSink->SetValue("mcPrimaryE", &mcPrimaryE);
+            m_pOutputSink->SetValue("mcPrimaryPX", &mcPrimaryPX);
+            m_pOutputSink->SetValue("mcPrimaryPY", &mcPrimaryPY);
+            m_pOutputSink->SetValue("mcPrimaryPZ", &mcPrimaryPZ);
+            m_pOutputSink->SetValue("mcPrimaryVtxX", &mcPrimaryVtxX);
+            m_pOutputSink->SetValue("mcPrimaryVtxY", &mcPrimaryVtxY);
+            m_pOutputSink->SetValue("mcPrimaryVtxZ", &mcPrimaryVtxZ);
+            m_pOutputSink->SetValue("mcPrimaryEndX", &mcPrimaryEndX);
+            m_pOutputSink->SetValue("mcPrimaryEndY", &mcPrimaryEndY);
+            m_pOutputSink->SetValue("mcPrimaryEndZ", &mcPrimaryEndZ);
+            m_pOutputSink->SetValue("mcPrimaryNHitsTotal", &nMCHitsTotal);
+            m_pOutputSink->SetValue("mcPrimaryNHitsU", &nMCHitsU);
+            m_pOutputSink->SetValue("mcPrimaryNHitsV", &nMCHitsV);
+            m_pOutputSink->SetValue("mcPrimaryNHitsW", &nMCHitsW);
+            m_pOutputSink->SetValue("nPrimaryMatchedPfos", &nPrimaryMatchedPfos);
+            m_pOutputSink->SetValue("nPrimaryMatchedTBPfos", &nPrimaryMatchedTBPfos);
+            m_pOutputSink->SetValue("nPrimaryMatchedCRPfos", &nPrimaryMatchedCRPfos);
+            m_pOutputSink->SetValue("bestMatchPfoId", &bestMatchPfoId);
+            m_pOutputSink->SetValue("bestMatchPfoPdg", &bestMatchPfoPdg);
+            m_pOutputSink->SetValue("bestMatchPfoNHitsTotal", &bestMatchPfoNHitsTotal);
+            m_pOutputSink->SetValue("bestMatchPfoNHitsU", &bestMatchPfoNHitsU);
+            m_pOutputSink->SetValue("bestMatchPfoNHitsV", &bestMatchPfoNHitsV);
+            m_pOutputSink->SetValue("bestMatchPfoNHitsW", &bestMatchPfoNHitsW);
+            m_pOutputSink->SetValue("bestMatchPfoNSharedHitsTotal", &bestMatchPfoNSharedHitsTotal);
+            m_pOutputSink->SetValue("bestMatchPfoNSharedHitsU", &bestMatchPfoNSharedHitsU);
+            m_pOutputSink->SetValue("bestMatchPfoNSharedHitsV", &bestMatchPfoNSharedHitsV);
+            m_pOutputSink->SetValue("bestMatchPfoNSharedHitsW", &bestMatchPfoNSharedHitsW);
+            m_pOutputSink->SetValue("bestMatchPfoX0", &bestMatchPfoX0);
+            m_pOutputSink->SetValue("nTargetMatches", nTargetMatches);
+            m_pOutputSink->SetValue("nTargetTBMatches", nTargetTBMatches);
+            m_pOutputSink->SetValue("nTargetCRMatches", nTargetCRMatches);
+            m_pOutputSink->SetValue("bestMatchPfoIsTB", &bestMatchPfoIsTB);
         }
 
         if (isBeamParticle || isCosmicRay)
         {
             const LArInteractionTypeHelper::InteractionType interactionType(LArInteractionTypeHelper::GetInteractionType(associatedMCPrimaries));
-#ifdef MONITORING
             const int interactionTypeInt(static_cast<int>(interactionType));
-#endif
             // ATTN Some redundancy introduced to contributing variables
             const int isCorrectTB(isBeamParticle && (nTargetTBMatches == 1) && (nTargetCRMatches == 0));
             const int isCorrectCR(isCosmicRay && (nTargetTBMatches == 0) && (nTargetCRMatches == 1));
@@ -382,15 +374,15 @@ void TestBeamEventValidationAlgorithm::ProcessOutput(
 
             if (fillTree)
             {
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "interactionType", interactionTypeInt));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCorrectTB", isCorrectTB));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCorrectCR", isCorrectCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isFakeTB", isFakeTB));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isFakeCR", isFakeCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isSplitTB", isSplitTB));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isSplitCR", isSplitCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isLost", isLost));
-                PANDORA_MONITORING_API(FillTree(this->GetPandora(), m_treeName.c_str()));
+                m_pOutputSink->SetValue("interactionType", interactionTypeInt);
+                m_pOutputSink->SetValue("isCorrectTB", isCorrectTB);
+                m_pOutputSink->SetValue("isCorrectCR", isCorrectCR);
+                m_pOutputSink->SetValue("isFakeTB", isFakeTB);
+                m_pOutputSink->SetValue("isFakeCR", isFakeCR);
+                m_pOutputSink->SetValue("isSplitTB", isSplitTB);
+                m_pOutputSink->SetValue("isSplitCR", isSplitCR);
+                m_pOutputSink->SetValue("isLost", isLost);
+                m_pOutputSink->Fill();
             }
 
             targetSS.str(std::string());
@@ -14,6 +14,8 @@
 
 #include "larpandoracontent/LArMonitoring/TestBeamHierarchyEventValidationAlgorithm.h"
 
+#include "larpandoracontent/LArObjects/LArPfoHierarchyIndex.h"
+
 #include <sstream>
 
 using namespace pandora;
@@ -111,6 +113,9 @@ void TestBeamHierarchyEventValidationAlgorithm::ProcessOutput(
     PfoVector primaryPfoVector;
     LArMonitoringHelper::GetOrderedPfoVector(validationInfo.GetPfoToHitsMap(), primaryPfoVector);
 
+    // ATTN Index the pfo hierarchies once, rather than walking them for every matched pfo
+    const PfoHierarchyIndex pfoHierarchyIndex(PfoList(primaryPfoVector.begin(), primaryPfoVector.end()));
+
     // Test Beam Hierarchy Validation Pfo Bookkeeping
     int pfoIndex(0), testBeamPfoIndex(0);
     PfoToIdMap pfoToIdMap, testBeamPfoToIdMap;
@@ -118,7 +123,8 @@ void TestBeamHierarchyEventValidationAlgorithm::ProcessOutput(
     for (const Pfo *const pPrimaryPfo : primaryPfoVector)
     {
         pfoToIdMap.insert(PfoToIdMap::value_type(pPrimaryPfo, ++pfoIndex));
-        const Pfo *const pRecoTestBeam(LArPfoHelper::IsTestBeamFinalState(pPrimaryPfo) ? LArPfoHelper::GetParentPfo(pPrimaryPfo) : nullptr);
+        const Pfo *const pRecoTestBeam(
+            LArPfoHelper::IsTestBeamFinalState(pPrimaryPfo) ? pfoHierarchyIndex.GetParentPfo(pPrimaryPfo) : nullptr);
 
         if (pRecoTestBeam && !testBeamPfoToIdMap.count(pRecoTestBeam))
             testBeamPfoToIdMap.insert(PfoToIdMap::value_type(pRecoTestBeam, ++testBeamPfoIndex));
@@ -233,10 +239,8 @@ void TestBeamHierarchyEventValidationAlgorithm::ProcessOutput(
             isLastTestBeamLeading = (nHierarchyLeading == triggeredToLeading.at(LArMCParticleHelper::GetParentMCParticle(pMCPrimary)));
         }
 
-#ifdef MONITORING
         const CartesianVector &targetVertex(LArMCParticleHelper::GetParentMCParticle(pMCPrimary)->GetVertex());
         const float targetVertexX(targetVertex.GetX()), targetVertexY(targetVertex.GetY()), targetVertexZ(targetVertex.GetZ());
-#endif
 
         for (int tier = 0; tier < mcHierarchyTier; tier++)
             targetSS << " -> ";
@@ -268,10 +272,8 @@ void TestBeamHierarchyEventValidationAlgorithm::ProcessOutput(
 
         int matchIndex(0), nPrimaryMatches(0), nPrimaryTBHierarchyMatches(0), nPrimaryCRMatches(0), nPrimaryGoodTBHierarchyMatches(0),
             nPrimaryTBHierarchySplits(0);
-#ifdef MONITORING
         float recoVertexX(std::numeric_limits<float>::max()), recoVertexY(std::numeric_limits<float>::max()),
             recoVertexZ(std::numeric_limits<float>::max());
-#endif
         for (const LArMCParticleHelper::PfoCaloHitListPair &pfoToSharedHits : mcToPfoHitSharingMap.at(pMCPrimary))
         {
             const CaloHitList &sharedHitList(pfoToSharedHits.second);
@@ -282,10 +284,11 @@ void TestBeamHierarchyEventValidationAlgorithm::ProcessOutput(
             const bool isGoodMatch(this->IsGoodMatch(mcPrimaryHitList, pfoHitList, sharedHitList));
 
             // Tier (0) : Primary, (1) : Daughter, (2) : Granddaughter etc...  Note that the tier only increases for visible particle
-            const int pfoHierarchyTier(LArPfoHelper::GetHierarchyTier(pfoToSharedHits.first));
+            const int pfoHierarchyTier(pfoHierarchyIndex.GetHierarchyTier(pfoToSharedHits.first));
             const int pfoId(pfoToIdMap.at(pfoToSharedHits.first));
-            const int recoTBId(
-                isRecoTestBeam || isRecoTestBeamHierarchy ? testBeamPfoToIdMap.at(LArPfoHelper::GetParentPfo(pfoToSharedHits.first)) : -1);
+            const int recoTBId(isRecoTestBeam || isRecoTestBeamHierarchy
+                    ? testBeamPfoToIdMap.at(pfoHierarchyIndex.GetParentPfo(pfoToSharedHits.first))
+                    : -1);
 
             if (0 == matchIndex++)
             {
@@ -305,12 +308,11 @@ void TestBeamHierarchyEventValidationAlgorithm::ProcessOutput(
                 bestMatchPfoNSharedHitsW.push_back(LArMonitoringHelper::CountHitsByType(TPC_VIEW_W, sharedHitList));
                 bestMatchPfoX0.push_back(pfoToSharedHits.first->GetPropertiesMap().count("X0") ? pfoToSharedHits.first->GetPropertiesMap().at("X0")
                                                                                                : std::numeric_limits<float>::max());
-#ifdef MONITORING
                 try
                 {
-                    const Vertex *const pRecoVertex(
-                        isRecoTestBeamHierarchy ? LArPfoHelper::GetTestBeamInteractionVertex(LArPfoHelper::GetParentPfo(pfoToSharedHits.first))
-                                                : LArPfoHelper::GetVertex(pfoToSharedHits.first));
+                    const Vertex *const pRecoVertex(isRecoTestBeamHierarchy
+                            ? LArPfoHelper::GetTestBeamInteractionVertex(pfoHierarchyIndex.GetParentPfo(pfoToSharedHits.first))
+                            : LArPfoHelper::GetVertex(pfoToSharedHits.first));
                     recoVertexX = pRecoVertex->GetPosition().GetX();
                     recoVertexY = pRecoVertex->GetPosition().GetY();
                     recoVertexZ = pRecoVertex->GetPosition().GetZ();
@@ -318,7 +320,6 @@ void TestBeamHierarchyEventValidationAlgorithm::ProcessOutput(
                 catch (const StatusCodeException &)
                 {
                 }
-#endif
             }
 
             if (isGoodMatch)
@@ -333,7 +334,7 @@ void TestBeamHierarchyEventValidationAlgorithm::ProcessOutput(
             if (isRecoTestBeamHierarchy)
             {
                 // Account for splitting of test beam particle into separate reconstructed primary pfos
-                const Pfo *const pRecoTB(LArPfoHelper::GetParentPfo(pfoToSharedHits.first));
+                const Pfo *const pRecoTB(pfoHierarchyIndex.GetParentPfo(pfoToSharedHits.first));
                 const bool isSplitRecoTBHierarchy(!recoTestBeamHierarchies.empty() && !recoTestBeamHierarchies.count(pRecoTB));
                 if (!isSplitRecoTBHierarchy && isGoodMatch)
                     ++nPrimaryGoodTBHierarchyMatches;
@@ -394,72 +395,67 @@ void TestBeamHierarchyEventValidationAlgorithm::ProcessOutput(
 
         if (fillTree)
         {
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "fileIdentifier", m_fileIdentifier));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "eventNumber", eventNumber));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcNuanceCode", mcNuanceCode));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isBeamParticle", isBeamParticle));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCosmicRay", isCosmicRay));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetPrimaries", nTargetPrimaries));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexX", targetVertexX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexY", targetVertexY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexZ", targetVertexZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexX", recoVertexX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexY", recoVertexY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexZ", recoVertexZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryId", &mcPrimaryId));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPdg", &mcPrimaryPdg));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryTier", &mcPrimaryTier));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryE", &mcPrimaryE));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPX", &mcPrimaryPX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPY", &mcPrimaryPY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPZ", &mcPrimaryPZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxX", &mcPrimaryVtxX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxY", &mcPrimaryVtxY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxZ", &mcPrimaryVtxZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndX", &mcPrimaryEndX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndY", &mcPrimaryEndY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndZ", &mcPrimaryEndZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsTotal", &nMCHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsU", &nMCHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsV", &nMCHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsW", &nMCHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedPfos", &nPrimaryMatchedPfos));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedTBHierarchyPfos", &nPrimaryMatchedTBHierarchyPfos));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedCRPfos", &nPrimaryMatchedCRPfos));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoId", &bestMatchPfoId));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoPdg", &bestMatchPfoPdg));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoTier", &bestMatchPfoTier));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsTotal", &bestMatchPfoNHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsU", &bestMatchPfoNHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsV", &bestMatchPfoNHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsW", &bestMatchPfoNHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsTotal", &bestMatchPfoNSharedHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsU", &bestMatchPfoNSharedHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsV", &bestMatchPfoNSharedHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsW", &bestMatchPfoNSharedHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoX0", &bestMatchPfoX0));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetMatches", nTargetMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetTBHierarchyMatches", nTargetTBHierarchyMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetCRMatches", nTargetCRMatches));
-
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoIsTestBeam", &bestMatchPfoIsTestBeam));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoIsTestBeamHierarchy", &bestMatchPfoIsTestBeamHierarchy));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoRecoTBId", &bestMatchPfoRecoTBId));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetGoodTBHierarchyMatches", nTargetGoodTBHierarchyMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetTBHierarchySplits", nTargetTBHierarchySplits));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetTBHierarchyLosses", nTargetTBHierarchyLosses));
+            m_pOutputSink->SetValue("fileIdentifier", m_fileIdentifier);
+            m_pOutputSink->SetValue("eventNumber", eventNumber);
+            m_pOutputSink->SetValue("mcNuanceCode", mcNuanceCode);
+            m_pOutputSink->SetValue("isBeamParticle", isBeamParticle);
+            m_pOutputSink->SetValue("isCosmicRay", isCosmicRay);
+            m_pOutputSink->SetValue("nTargetPrimaries", nTargetPrimaries);
+            m_pOutputSink->SetValue("targetVertexX", targetVertexX);
+            m_pOutputSink->SetValue("targetVertexY", targetVertexY);
+            m_pOutputSink->SetValue("targetVertexZ", targetVertexZ);
+            m_pOutputSink->SetValue("recoVertexX", recoVertexX);
+            m_pOutputSink->SetValue("recoVertexY", recoVertexY);
+            m_pOutputSink->SetValue("recoVertexZ", recoVertexZ);
+            m_pOutputSink->SetValue("mcPrimaryId", &mcPrimaryId);
+            m_pOutputSink->SetValue("mcPrimaryPdg", &mcPrimaryPdg);
+            m_pOutputSink->SetValue("mcPrimaryTier", &mcPrimaryTier);
+            m_pOutputSink->SetValue("mcPrimaryE", &mcPrimaryE);
+            m_pOutputSink->SetValue("mcPrimaryPX", &mcPrimaryPX);
+            m_pOutputSink->SetValue("mcPrimaryPY", &mcPrimaryPY);
+            m_pOutputSink->SetValue("mcPrimaryPZ", &mcPrimaryPZ);
+            m_pOutputSink->SetValue("mcPrimaryVtxX", &mcPrimaryVtxX);
+            m_pOutputSink->SetValue("mcPrimaryVtxY", &mcPrimaryVtxY);
+            m_pOutputSink->SetValue("mcPrimaryVtxZ", &mcPrimaryVtxZ);
+            m_pOutputSink->SetValue("mcPrimaryEndX", &mcPrimaryEndX);
+            m_pOutputSink->SetValue("mcPrimaryEndY", &mcPrimaryEndY);
+            m_pOutputSink->SetValue("mcPrimaryEndZ", &mcPrimaryEndZ);
+            m_pOutputSink->SetValue("mcPrimaryNHitsTotal", &nMCHitsTotal);
+            m_pOutputSink->SetValue("mcPrimaryNHitsU", &nMCHitsU);
+            m_pOutputSink->SetValue("mcPrimaryNHitsV", &nMCHitsV);
+            m_pOutputSink->SetValue("mcPrimaryNHitsW", &nMCHitsW);
+            m_pOutputSink->SetValue("nPrimaryMatchedPfos", &nPrimaryMatchedPfos);
+            m_pOutputSink->SetValue("nPrimaryMatchedTBHierarchyPfos", &nPrimaryMatchedTBHierarchyPfos);
+            m_pOutputSink->SetValue("nPrimaryMatchedCRPfos", &nPrimaryMatchedCRPfos);
+            m_pOutputSink->SetValue("bestMatchPfoId", &bestMatchPfoId);
+            m_pOutputSink->SetValue("bestMatchPfoPdg", &bestMatchPfoPdg);
+            m_pOutputSink->SetValue("bestMatchPfoTier", &bestMatchPfoTier);
+            m_pOutputSink->SetValue("bestMatchPfoNHitsTotal", &bestMatchPfoNHitsTotal);
+            m_pOutputSink->SetValue("bestMatchPfoNHitsU", &bestMatchPfoNHitsU);
+            m_pOutputSink->SetValue("bestMatchPfoNHitsV", &bestMatchPfoNHitsV);
+            m_pOutputSink->SetValue("bestMatchPfoNHitsW", &bestMatchPfoNHitsW);
+            m_pOutputSink->SetValue("bestMatchPfoNSharedHitsTotal", &bestMatchPfoNSharedHitsTotal);
+            m_pOutputSink->SetValue("bestMatchPfoNSharedHitsU", &bestMatchPfoNSharedHitsU);
+            m_pOutputSink->SetValue("bestMatchPfoNSharedHitsV", &bestMatchPfoNSharedHitsV);
+            m_pOutputSink->SetValue("bestMatchPfoNSharedHitsW", &bestMatchPfoNSharedHitsW);
+            m_pOutputSink->SetValue("bestMatchPfoX0", &bestMatchPfoX0);
+            m_pOutputSink->SetValue("nTargetMatches", nTargetMatches);
+            m_pOutputSink->SetValue("nTargetTBHierarchyMatches", nTargetTBHierarchyMatches);
+            m_pOutputSink->SetValue("nTargetCRMatches", nTargetCRMatches);
+
+            m_pOutputSink->SetValue("bestMatchPfoIsTestBeam", &bestMatchPfoIsTestBeam);
+            m_pOutputSink->SetValue("bestMatchPfoIsTestBeamHierarchy", &bestMatchPfoIsTestBeamHierarchy);
+            m_pOutputSink->SetValue("bestMatchPfoRecoTBId", &bestMatchPfoRecoTBId);
+            m_pOutputSink->SetValue("nTargetGoodTBHierarchyMatches", nTargetGoodTBHierarchyMatches);
+            m_pOutputSink->SetValue("nTargetTBHierarchySplits", nTargetTBHierarchySplits);
+            m_pOutputSink->SetValue("nTargetTBHierarchyLosses", nTargetTBHierarchyLosses);
         }
 
         if (isCosmicRay || isLastTestBeamLeading)
         {
             const LArInteractionTypeHelper::InteractionType interactionType(
                 LArInteractionTypeHelper::GetTestBeamHierarchyInteractionType(associatedMCPrimaries));
-#ifdef MONITORING
             const int interactionTypeInt(static_cast<int>(interactionType));
-#endif
             // ATTN Some redundancy introduced to contributing variables
             const int isCorrectTB(isBeamParticle && (nTargetTBHierarchyMatches == 1) && (nTargetCRMatches == 0));
             const int isCorrectTBHierarchy(isLeadingBeamParticle && (nTargetGoodTBHierarchyMatches == nTargetTBHierarchyMatches) &&
@@ -527,15 +523,15 @@ void TestBeamHierarchyEventValidationAlgorithm::ProcessOutput(
 
             if (fillTree)
             {
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "interactionType", interactionTypeInt));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCorrectTBHierarchy", isCorrectTBHierarchy));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCorrectCR", isCorrectCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isFakeTBHierarchy", isFakeTBHierarchy));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isFakeCR", isFakeCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isSplitTBHierarchy", isSplitTBHierarchy));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isSplitCR", isSplitCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isLost", isLost));
-                PANDORA_MONITORING_API(FillTree(this->GetPandora(), m_treeName.c_str()));
+                m_pOutputSink->SetValue("interactionType", interactionTypeInt);
+                m_pOutputSink->SetValue("isCorrectTBHierarchy", isCorrectTBHierarchy);
+                m_pOutputSink->SetValue("isCorrectCR", isCorrectCR);
+                m_pOutputSink->SetValue("isFakeTBHierarchy", isFakeTBHierarchy);
+                m_pOutputSink->SetValue("isFakeCR", isFakeCR);
+                m_pOutputSink->SetValue("isSplitTBHierarchy", isSplitTBHierarchy);
+                m_pOutputSink->SetValue("isSplitCR", isSplitCR);
+                m_pOutputSink->SetValue("isLost", isLost);
+                m_pOutputSink->Fill();
             }
 
             targetSS.str(std::string());
@@ -15,15 +15,14 @@ using namespace pandora;
 namespace lar_content
 {
 
-AdaBoostDecisionTree::AdaBoostDecisionTree() : m_pStrongClassifier(nullptr)
+AdaBoostDecisionTree::AdaBoostDecisionTree()
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-AdaBoostDecisionTree::AdaBoostDecisionTree(const AdaBoostDecisionTree &rhs)
+AdaBoostDecisionTree::AdaBoostDecisionTree(const AdaBoostDecisionTree &rhs) : m_spStrongClassifier(rhs.m_spStrongClassifier)
 {
-    m_pStrongClassifier = new StrongClassifier(*(rhs.m_pStrongClassifier));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -31,7 +30,7 @@ AdaBoostDecisionTree::AdaBoostDecisionTree(const AdaBoostDecisionTree &rhs)
 AdaBoostDecisionTree &AdaBoostDecisionTree::operator=(const AdaBoostDecisionTree &rhs)
 {
     if (this != &rhs)
-        m_pStrongClassifier = new StrongClassifier(*(rhs.m_pStrongClassifier));
+        m_spStrongClassifier = rhs.m_spStrongClassifier;
 
     return *this;
 }
@@ -40,19 +39,28 @@ AdaBoostDecisionTree &AdaBoostDecisionTree::operator=(const AdaBoostDecisionTree
 
 AdaBoostDecisionTree::~AdaBoostDecisionTree()
 {
-    delete m_pStrongClassifier;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode AdaBoostDecisionTree::Initialize(const std::string &bdtXmlFileName, const std::string &bdtName)
 {
-    if (m_pStrongClassifier)
+    if (m_spStrongClassifier)
     {
         std::cout << "AdaBoostDecisionTree: AdaBoostDecisionTree was already initialized" << std::endl;
         return STATUS_CODE_ALREADY_INITIALIZED;
     }
 
+    // ATTN: The classifier is immutable once read, so instances configured with the same model share it. The lock is held while the file
+    // is read, so that concurrently initialized instances read each model once.
+    StrongClassifierRegistry &registry(AdaBoostDecisionTree::GetStrongClassifierRegistry());
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+    std::weak_ptr<const StrongClassifier> &wpStrongClassifier(registry.m_strongClassifierMap[ModelKey(bdtXmlFileName, bdtName)]);
+    m_spStrongClassifier = wpStrongClassifier.lock();
+
+    if (m_spStrongClassifier)
+        return STATUS_CODE_SUCCESS;
+
     TiXmlDocument xmlDocument(bdtXmlFileName);
 
     if (!xmlDocument.LoadFile())
@@ -96,12 +104,11 @@ StatusCode AdaBoostDecisionTree::Initialize(const std::string &bdtXmlFileName, c
 
     try
     {
-        m_pStrongClassifier = new StrongClassifier(&xmlHandle);
+        m_spStrongClassifier = std::make_shared<const StrongClassifier>(&xmlHandle);
+        wpStrongClassifier = m_spStrongClassifier;
     }
     catch (StatusCodeException &statusCodeException)
     {
-        delete m_pStrongClassifier;
-
         if (STATUS_CODE_INVALID_PARAMETER == statusCodeException.GetStatusCode())
             std::cout << "AdaBoostDecisionTree: Initialization failure, unknown component in xml file." << std::endl;
 
@@ -141,7 +148,7 @@ double AdaBoostDecisionTree::CalculateProbability(const LArMvaHelper::MvaFeature
 
 double AdaBoostDecisionTree::CalculateScore(const LArMvaHelper::MvaFeatureVector &features) const
 {
-    if (!m_pStrongClassifier)
+    if (!m_spStrongClassifier)
     {
         std::cout << "AdaBoostDecisionTree: Attempting to use an uninitialized bdt" << std::endl;
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
@@ -150,7 +157,7 @@ double AdaBoostDecisionTree::CalculateScore(const LArMvaHelper::MvaFeatureVector
     try
     {
         // TODO: Add consistency check for number of features, bearing in mind not all features in a bdt may be used
-        return m_pStrongClassifier->Predict(features);
+        return m_spStrongClassifier->Predict(features);
     }
     catch (StatusCodeException &statusCodeException)
     {
@@ -176,6 +183,14 @@ double AdaBoostDecisionTree::CalculateScore(const LArMvaHelper::MvaFeatureVector
     }
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+AdaBoostDecisionTree::StrongClassifierRegistry &AdaBoostDecisionTree::GetStrongClassifierRegistry()
+{
+    static StrongClassifierRegistry registry;
+    return registry;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
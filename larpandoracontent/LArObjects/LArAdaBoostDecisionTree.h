@@ -16,6 +16,10 @@
 
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace lar_content
@@ -322,7 +326,28 @@ private:
      */
     double CalculateScore(const LArMvaHelper::MvaFeatureVector &features) const;
 
-    StrongClassifier *m_pStrongClassifier; ///< Strong adaptive boost tree classifier
+    typedef std::pair<std::string, std::string> ModelKey;
+    typedef std::map<ModelKey, std::weak_ptr<const StrongClassifier>> StrongClassifierMap;
+
+    /**
+     *  @brief  StrongClassifierRegistry class, holding the strong classifiers already read from each bdt xml file, so that pandora
+     *          instances in the same process, each configured with the same model, share a single read-only copy
+     */
+    class StrongClassifierRegistry
+    {
+    public:
+        StrongClassifierMap m_strongClassifierMap; ///< The strong classifier for each xml file name and bdt name, while in use
+        std::mutex m_mutex;                        ///< The mutex serialising access to the strong classifier map
+    };
+
+    /**
+     *  @brief  Get the strong classifier registry
+     *
+     *  @return the strong classifier registry
+     */
+    static StrongClassifierRegistry &GetStrongClassifierRegistry();
+
+    std::shared_ptr<const StrongClassifier> m_spStrongClassifier; ///< The strong classifier, shared by copies
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -18,6 +18,8 @@
 #include "Persistency/XmlFileReader.h"
 #include "Persistency/XmlFileWriter.h"
 
+#include "larpandoracontent/LArObjects/LArPackedFieldCodec.h"
+
 namespace lar_content
 {
 
@@ -29,6 +31,8 @@ class LArCaloHitParameters : public object_creation::CaloHit::Parameters
 public:
     pandora::InputUInt m_larTPCVolumeId;   ///< The lar tpc volume id
     pandora::InputUInt m_daughterVolumeId; ///< The daughter volume id
+    pandora::InputFloat m_pTrack;          ///< The probability that the hit is track-like (optional)
+    pandora::InputFloat m_pShower;         ///< The probability that the hit is shower-like (optional)
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -67,6 +71,20 @@ public:
      */
     void FillParameters(LArCaloHitParameters &parameters) const;
 
+    /**
+     *  @brief  Whether the probability that the hit is track-like has been set
+     *
+     *  @return boolean
+     */
+    bool HasTrackProbability() const;
+
+    /**
+     *  @brief  Whether the probability that the hit is shower-like has been set
+     *
+     *  @return boolean
+     */
+    bool HasShowerProbability() const;
+
     /**
      *  @brief  Get the probability that the hit is track-like
      *
@@ -113,9 +131,12 @@ public:
     /**
      *  @brief  Constructor
      *
-     *  @param  version the LArCaloHit version
+     *  @param  version the LArCaloHit version: 1 persists the lar tpc volume id, 2 adds the daughter volume id and 3 (binary files only)
+     *          writes both ids and any track and shower probabilities as a single packed payload
+     *  @param  useHalfPrecisionProbabilities whether version 3 writes the track and shower probabilities as half precision floats,
+     *          rather than full precision; files record the choice, so reading is unaffected
      */
-    LArCaloHitFactory(const unsigned int version = 1);
+    LArCaloHitFactory(const unsigned int version = 1, const bool useHalfPrecisionProbabilities = false);
 
     /**
      *  @brief  Create new parameters instance on the heap (memory-management to be controlled by user)
@@ -149,7 +170,25 @@ public:
     pandora::StatusCode Create(const Parameters &parameters, const Object *&pObject) const;
 
 private:
-    unsigned int m_version; ///< The LArCaloHit version
+    /**
+     *  @brief  Read a probability from a version 3 binary payload
+     *
+     *  @param  isHalfPrecision whether the probability is stored as a half precision float
+     *  @param  binaryFileReader the binary file reader
+     *  @param  probability to receive the probability
+     */
+    pandora::StatusCode ReadProbability(const bool isHalfPrecision, pandora::BinaryFileReader &binaryFileReader, float &probability) const;
+
+    /**
+     *  @brief  Write a probability to a version 3 binary payload, at the configured precision
+     *
+     *  @param  probability the probability
+     *  @param  binaryFileWriter the binary file writer
+     */
+    pandora::StatusCode WriteProbability(const float probability, pandora::BinaryFileWriter &binaryFileWriter) const;
+
+    unsigned int m_version;               ///< The LArCaloHit version
+    bool m_useHalfPrecisionProbabilities; ///< Whether version 3 writes the track and shower probabilities as half precision floats
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -160,6 +199,11 @@ inline LArCaloHit::LArCaloHit(const LArCaloHitParameters &parameters) :
     m_larTPCVolumeId(parameters.m_larTPCVolumeId.Get()),
     m_daughterVolumeId(parameters.m_daughterVolumeId.IsInitialized() ? parameters.m_daughterVolumeId.Get() : 0)
 {
+    if (parameters.m_pTrack.IsInitialized())
+        this->SetTrackProbability(parameters.m_pTrack.Get());
+
+    if (parameters.m_pShower.IsInitialized())
+        this->SetShowerProbability(parameters.m_pShower.Get());
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -207,6 +251,20 @@ inline void LArCaloHit::FillParameters(LArCaloHitParameters &parameters) const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline bool LArCaloHit::HasTrackProbability() const
+{
+    return m_pTrack.IsInitialized();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool LArCaloHit::HasShowerProbability() const
+{
+    return m_pShower.IsInitialized();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline float LArCaloHit::GetTrackProbability() const
 {
     return m_pTrack.Get();
@@ -242,7 +300,9 @@ inline void LArCaloHit::SetShowerProbability(const float probability)
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline LArCaloHitFactory::LArCaloHitFactory(const unsigned int version) : m_version(version)
+inline LArCaloHitFactory::LArCaloHitFactory(const unsigned int version, const bool useHalfPrecisionProbabilities) :
+    m_version(version),
+    m_useHalfPrecisionProbabilities(useHalfPrecisionProbabilities)
 {
 }
 
@@ -270,8 +330,36 @@ inline pandora::StatusCode LArCaloHitFactory::Read(Parameters &parameters, pando
     // ATTN: To receive this call-back must have already set file reader mc particle factory to this factory
     unsigned int larTPCVolumeId(std::numeric_limits<unsigned int>::max());
     unsigned int daughterVolumeId(0);
+    LArCaloHitParameters &larCaloHitParameters(dynamic_cast<LArCaloHitParameters &>(parameters));
 
-    if (pandora::BINARY == fileReader.GetFileType())
+    if ((pandora::BINARY == fileReader.GetFileType()) && (m_version > 2))
+    {
+        pandora::BinaryFileReader &binaryFileReader(dynamic_cast<pandora::BinaryFileReader &>(fileReader));
+        std::uint8_t layout(0);
+        PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, binaryFileReader.ReadVariable(layout));
+        PANDORA_RETURN_RESULT_IF(
+            pandora::STATUS_CODE_SUCCESS, !=, PackedFieldCodec::ReadField(layout & 0x3u, binaryFileReader, larTPCVolumeId));
+        PANDORA_RETURN_RESULT_IF(
+            pandora::STATUS_CODE_SUCCESS, !=, PackedFieldCodec::ReadField((layout >> 2) & 0x3u, binaryFileReader, daughterVolumeId));
+
+        const bool isHalfPrecision(layout & 0x40u);
+        float probability(0.f);
+
+        if (layout & 0x10u)
+        {
+            PANDORA_RETURN_RESULT_IF(
+                pandora::STATUS_CODE_SUCCESS, !=, this->ReadProbability(isHalfPrecision, binaryFileReader, probability));
+            larCaloHitParameters.m_pTrack = probability;
+        }
+
+        if (layout & 0x20u)
+        {
+            PANDORA_RETURN_RESULT_IF(
+                pandora::STATUS_CODE_SUCCESS, !=, this->ReadProbability(isHalfPrecision, binaryFileReader, probability));
+            larCaloHitParameters.m_pShower = probability;
+        }
+    }
+    else if (pandora::BINARY == fileReader.GetFileType())
     {
         pandora::BinaryFileReader &binaryFileReader(dynamic_cast<pandora::BinaryFileReader &>(fileReader));
         PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, binaryFileReader.ReadVariable(larTPCVolumeId));
@@ -290,7 +378,6 @@ inline pandora::StatusCode LArCaloHitFactory::Read(Parameters &parameters, pando
         return pandora::STATUS_CODE_INVALID_PARAMETER;
     }
 
-    LArCaloHitParameters &larCaloHitParameters(dynamic_cast<LArCaloHitParameters &>(parameters));
     larCaloHitParameters.m_larTPCVolumeId = larTPCVolumeId;
     larCaloHitParameters.m_daughterVolumeId = daughterVolumeId;
 
@@ -307,7 +394,35 @@ inline pandora::StatusCode LArCaloHitFactory::Write(const Object *const pObject,
     if (!pLArCaloHit)
         return pandora::STATUS_CODE_INVALID_PARAMETER;
 
-    if (pandora::BINARY == fileWriter.GetFileType())
+    if ((pandora::BINARY == fileWriter.GetFileType()) && (m_version > 2))
+    {
+        // Layout byte: bits 0-1 and 2-3 hold the width codes of the two volume ids, bits 4 and 5 flag the presence of the probabilities
+        // and bit 6 flags that they are stored as half precision floats
+        pandora::BinaryFileWriter &binaryFileWriter(dynamic_cast<pandora::BinaryFileWriter &>(fileWriter));
+        const std::uint32_t larTPCVolumeId(pLArCaloHit->GetLArTPCVolumeId());
+        const std::uint32_t daughterVolumeId(pLArCaloHit->GetDaughterVolumeId());
+        const std::uint8_t larTPCVolumeIdCode(PackedFieldCodec::GetWidthCode(larTPCVolumeId));
+        const std::uint8_t daughterVolumeIdCode(PackedFieldCodec::GetWidthCode(daughterVolumeId));
+        const bool hasTrackProbability(pLArCaloHit->HasTrackProbability());
+        const bool hasShowerProbability(pLArCaloHit->HasShowerProbability());
+        const std::uint8_t layout(larTPCVolumeIdCode | (daughterVolumeIdCode << 2) | (hasTrackProbability ? 0x10u : 0u) |
+            (hasShowerProbability ? 0x20u : 0u) | (m_useHalfPrecisionProbabilities ? 0x40u : 0u));
+
+        PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, binaryFileWriter.WriteVariable(layout));
+        PANDORA_RETURN_RESULT_IF(
+            pandora::STATUS_CODE_SUCCESS, !=, PackedFieldCodec::WriteField(larTPCVolumeId, larTPCVolumeIdCode, binaryFileWriter));
+        PANDORA_RETURN_RESULT_IF(
+            pandora::STATUS_CODE_SUCCESS, !=, PackedFieldCodec::WriteField(daughterVolumeId, daughterVolumeIdCode, binaryFileWriter));
+
+        if (hasTrackProbability)
+            PANDORA_RETURN_RESULT_IF(
+                pandora::STATUS_CODE_SUCCESS, !=, this->WriteProbability(pLArCaloHit->GetTrackProbability(), binaryFileWriter));
+
+        if (hasShowerProbability)
+            PANDORA_RETURN_RESULT_IF(
+                pandora::STATUS_CODE_SUCCESS, !=, this->WriteProbability(pLArCaloHit->GetShowerProbability(), binaryFileWriter));
+    }
+    else if (pandora::BINARY == fileWriter.GetFileType())
     {
         pandora::BinaryFileWriter &binaryFileWriter(dynamic_cast<pandora::BinaryFileWriter &>(fileWriter));
         PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, binaryFileWriter.WriteVariable(pLArCaloHit->GetLArTPCVolumeId()));
@@ -330,6 +445,31 @@ inline pandora::StatusCode LArCaloHitFactory::Write(const Object *const pObject,
     return pandora::STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline pandora::StatusCode LArCaloHitFactory::ReadProbability(
+    const bool isHalfPrecision, pandora::BinaryFileReader &binaryFileReader, float &probability) const
+{
+    if (!isHalfPrecision)
+        return binaryFileReader.ReadVariable(probability);
+
+    std::uint16_t halfProbability(0);
+    PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, binaryFileReader.ReadVariable(halfProbability));
+    probability = PackedFieldCodec::HalfToFloat(halfProbability);
+
+    return pandora::STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline pandora::StatusCode LArCaloHitFactory::WriteProbability(const float probability, pandora::BinaryFileWriter &binaryFileWriter) const
+{
+    if (m_useHalfPrecisionProbabilities)
+        return binaryFileWriter.WriteVariable(PackedFieldCodec::FloatToHalf(probability));
+
+    return binaryFileWriter.WriteVariable(probability);
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_CALO_HIT_H
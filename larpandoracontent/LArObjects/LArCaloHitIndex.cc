@@ -0,0 +1,46 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArCaloHitIndex.cc
+ *
+ *  @brief  Implementation of the lar calo hit index class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArObjects/LArCaloHitIndex.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+CaloHitIndex::CaloHitIndex(const CaloHitList &caloHitList)
+{
+    this->AddCaloHits(caloHitList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CaloHitIndex::CaloHitIndex(const CaloHitVector &caloHitVector)
+{
+    this->AddCaloHits(caloHitVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void CaloHitIndex::AddCaloHits(const T &caloHits)
+{
+    m_caloHitVector.reserve(caloHits.size());
+    m_caloHitToIdMap.reserve(caloHits.size());
+
+    for (const CaloHit *const pCaloHit : caloHits)
+    {
+        // ATTN A hit listed twice would need two ids, so that id-indexed containers could no longer stand in for hit-keyed containers
+        if (!m_caloHitToIdMap.insert(CaloHitToIdMap::value_type(pCaloHit, m_caloHitVector.size())).second)
+            throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+
+        m_caloHitVector.push_back(pCaloHit);
+    }
+}
+
+} // namespace lar_content
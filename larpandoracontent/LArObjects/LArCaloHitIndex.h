@@ -0,0 +1,404 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArCaloHitIndex.h
+ *
+ *  @brief  Header file for the lar calo hit index and calo hit id container classes.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_CALO_HIT_INDEX_H
+#define LAR_CALO_HIT_INDEX_H 1
+
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace lar_content
+{
+
+typedef std::vector<unsigned int> CaloHitIdVector;
+
+/**
+ *  @brief  CaloHitIndex class, which assigns each calo hit in a list a dense integer id, from zero up to the number of hits. The ids follow
+ *          the order of the input list and are stable for the lifetime of the index, so that hit-keyed bookkeeping can be held in the flat,
+ *          id-indexed containers below. Translating a hit to its id costs a single hash lookup, so algorithms should translate each hit
+ *          once and then work with ids; translating an id back to its hit is an array lookup.
+ */
+class CaloHitIndex
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  caloHitList the calo hit list, in which each hit must appear only once
+     */
+    CaloHitIndex(const pandora::CaloHitList &caloHitList);
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  caloHitVector the calo hit vector, in which each hit must appear only once
+     */
+    CaloHitIndex(const pandora::CaloHitVector &caloHitVector);
+
+    /**
+     *  @brief  Get the number of indexed calo hits, which is one beyond the largest id
+     *
+     *  @return the number of indexed calo hits
+     */
+    unsigned int GetNCaloHits() const;
+
+    /**
+     *  @brief  Whether a calo hit is indexed
+     *
+     *  @param  pCaloHit the address of the calo hit
+     *
+     *  @return boolean
+     */
+    bool Contains(const pandora::CaloHit *const pCaloHit) const;
+
+    /**
+     *  @brief  Get the id of a calo hit, throwing if the calo hit is not indexed
+     *
+     *  @param  pCaloHit the address of the calo hit
+     *
+     *  @return the id
+     */
+    unsigned int GetId(const pandora::CaloHit *const pCaloHit) const;
+
+    /**
+     *  @brief  Get the calo hit with a given id, which must be less than the number of indexed calo hits
+     *
+     *  @param  id the id
+     *
+     *  @return the address of the calo hit
+     */
+    const pandora::CaloHit *GetCaloHit(const unsigned int id) const;
+
+    /**
+     *  @brief  Get the indexed calo hits, in id order
+     *
+     *  @return the indexed calo hits
+     */
+    const pandora::CaloHitVector &GetCaloHitVector() const;
+
+private:
+    typedef std::unordered_map<const pandora::CaloHit *, unsigned int> CaloHitToIdMap;
+
+    /**
+     *  @brief  Assign ids to a sequence of calo hits
+     *
+     *  @param  caloHits the calo hits
+     */
+    template <typename T>
+    void AddCaloHits(const T &caloHits);
+
+    pandora::CaloHitVector m_caloHitVector; ///< The indexed calo hits, in id order
+    CaloHitToIdMap m_caloHitToIdMap;        ///< The map from each calo hit to its id
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  CaloHitIdSet class, a set of ids from a calo hit index, held as a bitset so that membership tests are a single bit lookup
+ */
+class CaloHitIdSet
+{
+public:
+    /**
+     *  @brief  Constructor, creating an empty set able to hold any id from the calo hit index
+     *
+     *  @param  caloHitIndex the calo hit index
+     */
+    CaloHitIdSet(const CaloHitIndex &caloHitIndex);
+
+    /**
+     *  @brief  Whether the set contains an id
+     *
+     *  @param  id the id
+     *
+     *  @return boolean
+     */
+    bool Contains(const unsigned int id) const;
+
+    /**
+     *  @brief  Insert an id
+     *
+     *  @param  id the id
+     *
+     *  @return whether the id was inserted, i.e. was not already present
+     */
+    bool Insert(const unsigned int id);
+
+    /**
+     *  @brief  Erase an id
+     *
+     *  @param  id the id
+     *
+     *  @return whether the id was erased, i.e. was present
+     */
+    bool Erase(const unsigned int id);
+
+    /**
+     *  @brief  Get the number of ids in the set
+     *
+     *  @return the number of ids
+     */
+    unsigned int GetSize() const;
+
+    /**
+     *  @brief  Erase all ids
+     */
+    void Clear();
+
+private:
+    std::vector<std::uint64_t> m_words; ///< The bitset words, bit (id % 64) of word (id / 64) flagging the presence of each id
+    unsigned int m_size;                ///< The number of ids in the set
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  CaloHitIdMap class, a map from the ids of a calo hit index to values, held in an id-indexed vector so that lookups and
+ *          insertions are array accesses and never allocate
+ */
+template <typename T>
+class CaloHitIdMap
+{
+public:
+    /**
+     *  @brief  Constructor, creating an empty map able to hold any id from the calo hit index
+     *
+     *  @param  caloHitIndex the calo hit index
+     *  @param  defaultValue the value held, but not reported, for ids not in the map
+     */
+    CaloHitIdMap(const CaloHitIndex &caloHitIndex, const T &defaultValue = T());
+
+    /**
+     *  @brief  Whether the map contains an id
+     *
+     *  @param  id the id
+     *
+     *  @return boolean
+     */
+    bool Contains(const unsigned int id) const;
+
+    /**
+     *  @brief  Get the value for an id, throwing if the map does not contain the id
+     *
+     *  @param  id the id
+     *
+     *  @return the value
+     */
+    const T &Get(const unsigned int id) const;
+
+    /**
+     *  @brief  Get the value for an id, throwing if the map does not contain the id
+     *
+     *  @param  id the id
+     *
+     *  @return the value, which may be modified
+     */
+    T &Get(const unsigned int id);
+
+    /**
+     *  @brief  Set the value for an id, adding the id to the map or replacing its existing value
+     *
+     *  @param  id the id
+     *  @param  value the value
+     */
+    void Set(const unsigned int id, const T &value);
+
+    /**
+     *  @brief  Erase an id
+     *
+     *  @param  id the id
+     *
+     *  @return whether the id was erased, i.e. was present
+     */
+    bool Erase(const unsigned int id);
+
+    /**
+     *  @brief  Get the number of ids in the map
+     *
+     *  @return the number of ids
+     */
+    unsigned int GetSize() const;
+
+private:
+    CaloHitIdSet m_idSet;    ///< The set of ids in the map
+    std::vector<T> m_values; ///< The values, indexed by id
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int CaloHitIndex::GetNCaloHits() const
+{
+    return m_caloHitVector.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool CaloHitIndex::Contains(const pandora::CaloHit *const pCaloHit) const
+{
+    return (m_caloHitToIdMap.count(pCaloHit) > 0);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int CaloHitIndex::GetId(const pandora::CaloHit *const pCaloHit) const
+{
+    const CaloHitToIdMap::const_iterator iter(m_caloHitToIdMap.find(pCaloHit));
+
+    if (m_caloHitToIdMap.end() == iter)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
+
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CaloHit *CaloHitIndex::GetCaloHit(const unsigned int id) const
+{
+    return m_caloHitVector[id];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CaloHitVector &CaloHitIndex::GetCaloHitVector() const
+{
+    return m_caloHitVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline CaloHitIdSet::CaloHitIdSet(const CaloHitIndex &caloHitIndex) :
+    m_words((caloHitIndex.GetNCaloHits() + 63) / 64, 0),
+    m_size(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool CaloHitIdSet::Contains(const unsigned int id) const
+{
+    return (m_words[id >> 6] & (std::uint64_t(1) << (id & 63)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool CaloHitIdSet::Insert(const unsigned int id)
+{
+    std::uint64_t &word(m_words[id >> 6]);
+    const std::uint64_t bit(std::uint64_t(1) << (id & 63));
+
+    if (word & bit)
+        return false;
+
+    word |= bit;
+    ++m_size;
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool CaloHitIdSet::Erase(const unsigned int id)
+{
+    std::uint64_t &word(m_words[id >> 6]);
+    const std::uint64_t bit(std::uint64_t(1) << (id & 63));
+
+    if (!(word & bit))
+        return false;
+
+    word &= ~bit;
+    --m_size;
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int CaloHitIdSet::GetSize() const
+{
+    return m_size;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void CaloHitIdSet::Clear()
+{
+    std::fill(m_words.begin(), m_words.end(), 0);
+    m_size = 0;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline CaloHitIdMap<T>::CaloHitIdMap(const CaloHitIndex &caloHitIndex, const T &defaultValue) :
+    m_idSet(caloHitIndex),
+    m_values(caloHitIndex.GetNCaloHits(), defaultValue)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline bool CaloHitIdMap<T>::Contains(const unsigned int id) const
+{
+    return m_idSet.Contains(id);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline const T &CaloHitIdMap<T>::Get(const unsigned int id) const
+{
+    if (!m_idSet.Contains(id))
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
+
+    return m_values[id];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline T &CaloHitIdMap<T>::Get(const unsigned int id)
+{
+    if (!m_idSet.Contains(id))
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
+
+    return m_values[id];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void CaloHitIdMap<T>::Set(const unsigned int id, const T &value)
+{
+    m_idSet.Insert(id);
+    m_values[id] = value;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline bool CaloHitIdMap<T>::Erase(const unsigned int id)
+{
+    return m_idSet.Erase(id);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline unsigned int CaloHitIdMap<T>::GetSize() const
+{
+    return m_idSet.GetSize();
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_CALO_HIT_INDEX_H
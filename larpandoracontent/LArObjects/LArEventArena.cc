@@ -0,0 +1,85 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArEventArena.cc
+ *
+ *  @brief  Implementation of the lar event arena class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArObjects/LArEventArena.h"
+
+#include <algorithm>
+
+namespace lar_content
+{
+
+EventArena::Statistics::Statistics() :
+    m_nResets(0),
+    m_nAllocations(0),
+    m_nBytes(0),
+    m_nTotalAllocations(0),
+    m_nTotalBytes(0),
+    m_maxBytesPerReset(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventArena::EventArena(const std::size_t initialBlockSize) :
+    m_monotonicBuffer(initialBlockSize, std::pmr::new_delete_resource()),
+    m_countingResource(&m_monotonicBuffer, m_statistics)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventArena::Reset()
+{
+    m_monotonicBuffer.release();
+
+    m_statistics.m_maxBytesPerReset = std::max(m_statistics.m_maxBytesPerReset, m_statistics.m_nBytes);
+    m_statistics.m_nAllocations = 0;
+    m_statistics.m_nBytes = 0;
+    ++m_statistics.m_nResets;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventArena::CountingResource::CountingResource(std::pmr::memory_resource *const pUpstream, Statistics &statistics) :
+    m_pUpstream(pUpstream),
+    m_statistics(statistics)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void *EventArena::CountingResource::do_allocate(std::size_t nBytes, std::size_t alignment)
+{
+    void *const pMemory(m_pUpstream->allocate(nBytes, alignment));
+
+    ++m_statistics.m_nAllocations;
+    ++m_statistics.m_nTotalAllocations;
+    m_statistics.m_nBytes += nBytes;
+    m_statistics.m_nTotalBytes += nBytes;
+
+    return pMemory;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventArena::CountingResource::do_deallocate(void *pMemory, std::size_t nBytes, std::size_t alignment)
+{
+    // ATTN A no-op for the monotonic buffer, whose memory is only released when the arena is reset
+    m_pUpstream->deallocate(pMemory, nBytes, alignment);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool EventArena::CountingResource::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+    return (this == &other);
+}
+
+} // namespace lar_content
@@ -0,0 +1,126 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArEventArena.h
+ *
+ *  @brief  Header file for the lar event arena class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_EVENT_ARENA_H
+#define LAR_EVENT_ARENA_H 1
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  EventArena class, a monotonic allocation arena for short-lived containers. Allocations are carved from large blocks and are
+ *          only released, all at once, when the arena is reset; the owner must reset the arena once all containers using it are gone,
+ *          typically at the end of each event. The arena counts the allocations it serves, so that the allocation traffic of the
+ *          owner can be monitored. An arena must only be used by one thread at a time.
+ */
+class EventArena
+{
+public:
+    /**
+     *  @brief  Statistics class
+     */
+    class Statistics
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        Statistics();
+
+        unsigned int m_nResets;          ///< The number of times the arena has been reset
+        std::size_t m_nAllocations;      ///< The number of allocations since the last reset
+        std::size_t m_nBytes;            ///< The number of bytes allocated since the last reset
+        std::size_t m_nTotalAllocations; ///< The total number of allocations
+        std::size_t m_nTotalBytes;       ///< The total number of bytes allocated
+        std::size_t m_maxBytesPerReset;  ///< The max number of bytes allocated between two resets
+    };
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  initialBlockSize the size of the first block requested from the upstream (heap) memory resource, units bytes
+     */
+    EventArena(const std::size_t initialBlockSize = 65536);
+
+    /**
+     *  @brief  Deleted copy constructor
+     */
+    EventArena(const EventArena &) = delete;
+
+    /**
+     *  @brief  Deleted assignment operator
+     */
+    EventArena &operator=(const EventArena &) = delete;
+
+    /**
+     *  @brief  Get the memory resource, for use by arena-aware containers
+     *
+     *  @return the address of the memory resource
+     */
+    std::pmr::memory_resource *GetMemoryResource();
+
+    /**
+     *  @brief  Release all memory allocated from the arena, invalidating any remaining containers that use it
+     */
+    void Reset();
+
+    /**
+     *  @brief  Get the allocation statistics
+     *
+     *  @return the allocation statistics
+     */
+    const Statistics &GetStatistics() const;
+
+private:
+    /**
+     *  @brief  CountingResource class, which passes allocations through to the monotonic buffer and counts them
+     */
+    class CountingResource : public std::pmr::memory_resource
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pUpstream the address of the memory resource serving the allocations
+         *  @param  statistics the statistics to update
+         */
+        CountingResource(std::pmr::memory_resource *const pUpstream, Statistics &statistics);
+
+    private:
+        void *do_allocate(std::size_t nBytes, std::size_t alignment) override;
+        void do_deallocate(void *pMemory, std::size_t nBytes, std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+        std::pmr::memory_resource *const m_pUpstream; ///< The address of the memory resource serving the allocations
+        Statistics &m_statistics;                     ///< The statistics to update
+    };
+
+    Statistics m_statistics;                               ///< The allocation statistics
+    std::pmr::monotonic_buffer_resource m_monotonicBuffer; ///< The monotonic buffer, holding the arena blocks
+    CountingResource m_countingResource;                   ///< The counting resource, handed to arena-aware containers
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline std::pmr::memory_resource *EventArena::GetMemoryResource()
+{
+    return &m_countingResource;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const EventArena::Statistics &EventArena::GetStatistics() const
+{
+    return m_statistics;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_EVENT_ARENA_H
@@ -18,6 +18,8 @@
 #include "Persistency/XmlFileReader.h"
 #include "Persistency/XmlFileWriter.h"
 
+#include "larpandoracontent/LArObjects/LArPackedFieldCodec.h"
+
 namespace lar_content
 {
 
@@ -138,7 +140,8 @@ public:
     /**
      *  @brief  Constructor
      *
-     *  @param  version the LArMCParticle version
+     *  @param  version the LArMCParticle version: 1 persists the nuance code, 2 adds the process and 3 (binary files only) writes both
+     *          as a single packed payload
      */
     LArMCParticleFactory(const unsigned int version = 2);
 
@@ -249,7 +252,20 @@ inline pandora::StatusCode LArMCParticleFactory::Read(Parameters &parameters, pa
     int nuanceCode(0);
     int process(0);
 
-    if (pandora::BINARY == fileReader.GetFileType())
+    if ((pandora::BINARY == fileReader.GetFileType()) && (m_version > 2))
+    {
+        pandora::BinaryFileReader &binaryFileReader(dynamic_cast<pandora::BinaryFileReader &>(fileReader));
+        std::uint8_t layout(0);
+        std::uint32_t encodedNuanceCode(0), encodedProcess(0);
+        PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, binaryFileReader.ReadVariable(layout));
+        PANDORA_RETURN_RESULT_IF(
+            pandora::STATUS_CODE_SUCCESS, !=, PackedFieldCodec::ReadField(layout & 0x3u, binaryFileReader, encodedNuanceCode));
+        PANDORA_RETURN_RESULT_IF(
+            pandora::STATUS_CODE_SUCCESS, !=, PackedFieldCodec::ReadField((layout >> 2) & 0x3u, binaryFileReader, encodedProcess));
+        nuanceCode = PackedFieldCodec::ZigZagDecode(encodedNuanceCode);
+        process = PackedFieldCodec::ZigZagDecode(encodedProcess);
+    }
+    else if (pandora::BINARY == fileReader.GetFileType())
     {
         pandora::BinaryFileReader &binaryFileReader(dynamic_cast<pandora::BinaryFileReader &>(fileReader));
         PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, binaryFileReader.ReadVariable(nuanceCode));
@@ -287,7 +303,23 @@ inline pandora::StatusCode LArMCParticleFactory::Write(const Object *const pObje
     if (!pLArMCParticle)
         return pandora::STATUS_CODE_INVALID_PARAMETER;
 
-    if (pandora::BINARY == fileWriter.GetFileType())
+    if ((pandora::BINARY == fileWriter.GetFileType()) && (m_version > 2))
+    {
+        // Layout byte: bits 0-1 and 2-3 hold the width codes of the zigzag encoded nuance code and process
+        pandora::BinaryFileWriter &binaryFileWriter(dynamic_cast<pandora::BinaryFileWriter &>(fileWriter));
+        const std::uint32_t encodedNuanceCode(PackedFieldCodec::ZigZagEncode(pLArMCParticle->GetNuanceCode()));
+        const std::uint32_t encodedProcess(PackedFieldCodec::ZigZagEncode(static_cast<int>(pLArMCParticle->GetProcess())));
+        const std::uint8_t nuanceCodeWidthCode(PackedFieldCodec::GetWidthCode(encodedNuanceCode));
+        const std::uint8_t processWidthCode(PackedFieldCodec::GetWidthCode(encodedProcess));
+        const std::uint8_t layout(nuanceCodeWidthCode | (processWidthCode << 2));
+
+        PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, binaryFileWriter.WriteVariable(layout));
+        PANDORA_RETURN_RESULT_IF(
+            pandora::STATUS_CODE_SUCCESS, !=, PackedFieldCodec::WriteField(encodedNuanceCode, nuanceCodeWidthCode, binaryFileWriter));
+        PANDORA_RETURN_RESULT_IF(
+            pandora::STATUS_CODE_SUCCESS, !=, PackedFieldCodec::WriteField(encodedProcess, processWidthCode, binaryFileWriter));
+    }
+    else if (pandora::BINARY == fileWriter.GetFileType())
     {
         pandora::BinaryFileWriter &binaryFileWriter(dynamic_cast<pandora::BinaryFileWriter &>(fileWriter));
         PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, binaryFileWriter.WriteVariable(pLArMCParticle->GetNuanceCode()));
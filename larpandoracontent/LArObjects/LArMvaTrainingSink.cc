@@ -0,0 +1,262 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArMvaTrainingSink.cc
+ *
+ *  @brief  Implementation of the lar mva training sink class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArObjects/LArMvaTrainingSink.h"
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+MvaTrainingSink::MvaTrainingSink() :
+    m_format(CSV),
+    m_maxBufferedExamples(1000)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+MvaTrainingSink::~MvaTrainingSink()
+{
+    try
+    {
+        this->Flush();
+    }
+    catch (...)
+    {
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MvaTrainingSink::SetFormat(const std::string &formatName)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if ("csv" == formatName)
+    {
+        m_format = CSV;
+    }
+    else if ("binary" == formatName)
+    {
+        m_format = BINARY;
+    }
+    else
+    {
+        std::cout << "MvaTrainingSink: unknown training output format " << formatName << ", expected csv or binary" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MvaTrainingSink::SetMaxBufferedExamples(const unsigned int maxBufferedExamples)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_maxBufferedExamples = maxBufferedExamples;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MvaTrainingSink::AddExample(
+    const std::string &fileName, const bool result, const MvaTypes::MvaFeatureVector &featureVector, const StringVector &featureNames)
+{
+    if (!featureNames.empty() && (featureNames.size() != featureVector.size()))
+    {
+        std::cout << "MvaTrainingSink: number of feature names does not match number of features for " << fileName << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    // ATTN Read all feature values before touching the buffers, as an uninitialized feature throws
+    std::vector<double> featureValues;
+    featureValues.reserve(featureVector.size());
+
+    for (const MvaTypes::MvaFeature &feature : featureVector)
+        featureValues.push_back(feature.Get());
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    OutputFileMap::iterator iter(m_outputFileMap.find(fileName));
+    OutputFile *pOutputFile((m_outputFileMap.end() == iter) ? this->OpenOutputFile(fileName, featureValues.size(), featureNames) : &iter->second);
+
+    if (!pOutputFile)
+        return STATUS_CODE_FAILURE;
+
+    if (CSV == pOutputFile->m_format)
+    {
+        const std::string delimiter(",");
+        pOutputFile->m_textBuffer << GetTimestampString() << delimiter;
+
+        for (const double featureValue : featureValues)
+            pOutputFile->m_textBuffer << featureValue << delimiter;
+
+        pOutputFile->m_textBuffer << static_cast<int>(result) << '\n';
+    }
+    else
+    {
+        if (featureValues.size() != pOutputFile->m_nFeatures)
+        {
+            std::cout << "MvaTrainingSink: inconsistent number of features for binary training output " << fileName << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
+
+        pOutputFile->m_featureBuffer.insert(pOutputFile->m_featureBuffer.end(), featureValues.begin(), featureValues.end());
+        pOutputFile->m_resultBuffer.push_back(static_cast<unsigned char>(result));
+    }
+
+    if (++pOutputFile->m_nBufferedExamples >= m_maxBufferedExamples)
+        return this->WriteBufferedExamples(*pOutputFile);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MvaTrainingSink::Flush()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    StatusCode statusCode(STATUS_CODE_SUCCESS);
+
+    for (OutputFileMap::value_type &mapEntry : m_outputFileMap)
+    {
+        if (STATUS_CODE_SUCCESS != this->WriteBufferedExamples(mapEntry.second))
+            statusCode = STATUS_CODE_FAILURE;
+    }
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::string MvaTrainingSink::GetTimestampString()
+{
+    std::time_t timestampNow = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+
+    struct tm *pTimeInfo(NULL);
+    char buffer[80];
+
+    pTimeInfo = localtime(&timestampNow);
+    strftime(buffer, 80, "%x_%X", pTimeInfo);
+
+    std::string timeString(buffer);
+
+    if (!timeString.empty() && timeString.back() == '\n') // last char is always a newline
+        timeString.pop_back();
+
+    return timeString;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+MvaTrainingSink::OutputFile *MvaTrainingSink::OpenOutputFile(const std::string &fileName, const unsigned int nFeatures, const StringVector &featureNames)
+{
+    OutputFile *const pOutputFile(&m_outputFileMap[fileName]);
+    pOutputFile->m_format = m_format;
+    pOutputFile->m_nFeatures = nFeatures;
+    pOutputFile->m_nBufferedExamples = 0;
+
+    // Always append to the output file; binary files may hold several header and data chunk sequences
+    pOutputFile->m_stream.open(fileName, (CSV == m_format) ? std::ios_base::app : (std::ios_base::app | std::ios_base::binary));
+
+    if (!pOutputFile->m_stream.is_open())
+    {
+        std::cout << "MvaTrainingSink: could not open file for training examples at " << fileName << std::endl;
+        m_outputFileMap.erase(fileName);
+        return nullptr;
+    }
+
+    if (BINARY == m_format)
+    {
+        const std::uint32_t formatVersion(1);
+        pOutputFile->m_stream.write("HEAD", 4);
+        WriteBinaryValue<std::uint32_t>(pOutputFile->m_stream, formatVersion);
+        WriteBinaryString(pOutputFile->m_stream, GetTimestampString());
+        WriteBinaryValue<std::uint32_t>(pOutputFile->m_stream, nFeatures);
+
+        for (unsigned int iFeature = 0; iFeature < nFeatures; ++iFeature)
+            WriteBinaryString(pOutputFile->m_stream, featureNames.empty() ? ("feature" + std::to_string(iFeature)) : featureNames.at(iFeature));
+    }
+
+    return pOutputFile;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MvaTrainingSink::WriteBufferedExamples(OutputFile &outputFile) const
+{
+    if (0 == outputFile.m_nBufferedExamples)
+        return STATUS_CODE_SUCCESS;
+
+    if (CSV == outputFile.m_format)
+    {
+        outputFile.m_stream << outputFile.m_textBuffer.str();
+        outputFile.m_textBuffer.str(std::string());
+    }
+    else
+    {
+        const unsigned int nExamples(outputFile.m_nBufferedExamples);
+        const std::int64_t blockTimestamp(std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+
+        outputFile.m_stream.write("DATA", 4);
+        WriteBinaryValue<std::uint32_t>(outputFile.m_stream, nExamples);
+        WriteBinaryValue<std::int64_t>(outputFile.m_stream, blockTimestamp);
+
+        // Transpose the buffered examples into feature columns
+        std::vector<double> featureColumn(nExamples);
+
+        for (unsigned int iFeature = 0; iFeature < outputFile.m_nFeatures; ++iFeature)
+        {
+            for (unsigned int iExample = 0; iExample < nExamples; ++iExample)
+                featureColumn[iExample] = outputFile.m_featureBuffer[iExample * outputFile.m_nFeatures + iFeature];
+
+            outputFile.m_stream.write(reinterpret_cast<const char *>(featureColumn.data()), nExamples * sizeof(double));
+        }
+
+        outputFile.m_stream.write(reinterpret_cast<const char *>(outputFile.m_resultBuffer.data()), nExamples);
+
+        outputFile.m_featureBuffer.clear();
+        outputFile.m_resultBuffer.clear();
+    }
+
+    outputFile.m_nBufferedExamples = 0;
+    outputFile.m_stream.flush();
+
+    if (!outputFile.m_stream.good())
+    {
+        std::cout << "MvaTrainingSink: failed to write training examples" << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void MvaTrainingSink::WriteBinaryValue(std::ofstream &stream, const T value)
+{
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MvaTrainingSink::WriteBinaryString(std::ofstream &stream, const std::string &value)
+{
+    WriteBinaryValue<std::uint32_t>(stream, static_cast<std::uint32_t>(value.size()));
+    stream.write(value.data(), value.size());
+}
+
+} // namespace lar_content
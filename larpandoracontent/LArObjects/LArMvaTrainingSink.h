@@ -0,0 +1,174 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArMvaTrainingSink.h
+ *
+ *  @brief  Header file for the lar mva training sink class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_MVA_TRAINING_SINK_H
+#define LAR_MVA_TRAINING_SINK_H 1
+
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArObjects/LArMvaInterface.h"
+
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  MvaTrainingSink class, which keeps its training output files open and writes their examples in buffered blocks
+ *
+ *          Two formats are supported. The csv format is identical to the per-example text output of LArMvaHelper (a timestamp, the
+ *          features and the result on each line). The binary format is a sequence of tagged chunks: a "HEAD" chunk, carrying the
+ *          format version, creation timestamp and feature names, is written whenever a file is opened, and each buffered block of
+ *          examples is written as a "DATA" chunk, carrying the number of examples, the block timestamp, one column of doubles per
+ *          feature and a column of byte results. Values are written in the native byte order. A sink may be shared by concurrent
+ *          workers, as all access is serialised internally.
+ */
+class MvaTrainingSink
+{
+public:
+    /**
+     *  @brief  Format enumeration
+     */
+    enum Format
+    {
+        CSV,
+        BINARY
+    };
+
+    /**
+     *  @brief  Default constructor
+     */
+    MvaTrainingSink();
+
+    /**
+     *  @brief  Destructor, writing any buffered examples
+     */
+    ~MvaTrainingSink();
+
+    /**
+     *  @brief  Deleted copy constructor
+     */
+    MvaTrainingSink(const MvaTrainingSink &) = delete;
+
+    /**
+     *  @brief  Deleted assignment operator
+     */
+    MvaTrainingSink &operator=(const MvaTrainingSink &) = delete;
+
+    /**
+     *  @brief  Set the output format, applying to files not yet opened
+     *
+     *  @param  formatName the format name, "csv" or "binary"
+     *
+     *  @return success
+     */
+    pandora::StatusCode SetFormat(const std::string &formatName);
+
+    /**
+     *  @brief  Set the number of examples buffered for a file before they are written
+     *
+     *  @param  maxBufferedExamples the max. number of buffered examples
+     */
+    void SetMaxBufferedExamples(const unsigned int maxBufferedExamples);
+
+    /**
+     *  @brief  Add a training example
+     *
+     *  @param  fileName the name of the file to which the example belongs
+     *  @param  result the result (class) of the example
+     *  @param  featureVector the features of the example
+     *  @param  featureNames the feature names, recorded in the binary format header (generic names are used if empty)
+     *
+     *  @return success
+     */
+    pandora::StatusCode AddExample(const std::string &fileName, const bool result, const MvaTypes::MvaFeatureVector &featureVector,
+        const pandora::StringVector &featureNames = pandora::StringVector());
+
+    /**
+     *  @brief  Write the buffered examples of all files
+     *
+     *  @return success
+     */
+    pandora::StatusCode Flush();
+
+    /**
+     *  @brief  Get a timestamp string for this point in time
+     *
+     *  @return a timestamp string
+     */
+    static std::string GetTimestampString();
+
+private:
+    /**
+     *  @brief  OutputFile class
+     */
+    class OutputFile
+    {
+    public:
+        std::ofstream m_stream;                    ///< The output file stream
+        Format m_format;                           ///< The format of the file
+        unsigned int m_nFeatures;                  ///< The number of features per example (binary format)
+        unsigned int m_nBufferedExamples;          ///< The number of buffered examples
+        std::ostringstream m_textBuffer;           ///< The buffered examples (csv format)
+        std::vector<double> m_featureBuffer;       ///< The buffered example features, example by example (binary format)
+        std::vector<unsigned char> m_resultBuffer; ///< The buffered example results (binary format)
+    };
+
+    typedef std::map<std::string, OutputFile> OutputFileMap;
+
+    /**
+     *  @brief  Open an output file, writing the binary format header if required
+     *
+     *  @param  fileName the file name
+     *  @param  nFeatures the number of features per example
+     *  @param  featureNames the feature names
+     *
+     *  @return the address of the output file, nullptr if it could not be opened
+     */
+    OutputFile *OpenOutputFile(const std::string &fileName, const unsigned int nFeatures, const pandora::StringVector &featureNames);
+
+    /**
+     *  @brief  Write the buffered examples of an output file
+     *
+     *  @param  outputFile the output file
+     *
+     *  @return success
+     */
+    pandora::StatusCode WriteBufferedExamples(OutputFile &outputFile) const;
+
+    /**
+     *  @brief  Write a value to a binary stream, in the native byte order
+     *
+     *  @param  stream the output stream
+     *  @param  value the value
+     */
+    template <typename T>
+    static void WriteBinaryValue(std::ofstream &stream, const T value);
+
+    /**
+     *  @brief  Write a string to a binary stream, preceded by its length
+     *
+     *  @param  stream the output stream
+     *  @param  value the string
+     */
+    static void WriteBinaryString(std::ofstream &stream, const std::string &value);
+
+    Format m_format;                    ///< The format for newly opened files
+    unsigned int m_maxBufferedExamples; ///< The max. number of examples buffered for a file before they are written
+    OutputFileMap m_outputFileMap;      ///< The map from file name to open output file
+    std::mutex m_mutex;                 ///< The mutex serialising access to the sink
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_MVA_TRAINING_SINK_H
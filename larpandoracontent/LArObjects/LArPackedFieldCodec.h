@@ -0,0 +1,260 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArPackedFieldCodec.h
+ *
+ *  @brief  Header file for the lar packed field codec class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_PACKED_FIELD_CODEC_H
+#define LAR_PACKED_FIELD_CODEC_H 1
+
+#include "Persistency/BinaryFileReader.h"
+#include "Persistency/BinaryFileWriter.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  PackedFieldCodec class, providing the building blocks of the compact binary payloads written by the lar object factories.
+ *
+ *          Integer fields are stored in the smallest of 0, 1, 2 or 4 bytes that can hold them, with a two bit width code per field
+ *          collected in a leading layout byte, so that the small ids and codes that dominate event files typically cost a byte or less.
+ *          Signed fields are zigzag encoded first, so that small negative values are also short. Probabilities may be stored as ieee 754
+ *          half precision floats, which are exact to around one part in two thousand over the unit interval.
+ */
+class PackedFieldCodec
+{
+public:
+    /**
+     *  @brief  Get the two bit width code for an unsigned field: 0 for a zero value (no bytes stored), else 1, 2 or 3 for 1, 2 or 4 bytes
+     *
+     *  @param  value the field value
+     *
+     *  @return the width code
+     */
+    static std::uint8_t GetWidthCode(const std::uint32_t value);
+
+    /**
+     *  @brief  Write an unsigned field using the number of bytes given by its width code
+     *
+     *  @param  value the field value
+     *  @param  widthCode the width code, as returned by GetWidthCode
+     *  @param  binaryFileWriter the binary file writer
+     *
+     *  @return success
+     */
+    static pandora::StatusCode WriteField(
+        const std::uint32_t value, const std::uint8_t widthCode, pandora::BinaryFileWriter &binaryFileWriter);
+
+    /**
+     *  @brief  Read an unsigned field using the number of bytes given by its width code
+     *
+     *  @param  widthCode the width code, as recorded in the layout byte
+     *  @param  binaryFileReader the binary file reader
+     *  @param  value to receive the field value
+     *
+     *  @return success
+     */
+    static pandora::StatusCode ReadField(const std::uint8_t widthCode, pandora::BinaryFileReader &binaryFileReader, std::uint32_t &value);
+
+    /**
+     *  @brief  Map a signed value to an unsigned value, interleaving positive and negative values so that small magnitudes remain small
+     *
+     *  @param  value the signed value
+     *
+     *  @return the zigzag encoded value
+     */
+    static std::uint32_t ZigZagEncode(const int value);
+
+    /**
+     *  @brief  Invert the zigzag encoding
+     *
+     *  @param  value the zigzag encoded value
+     *
+     *  @return the signed value
+     */
+    static int ZigZagDecode(const std::uint32_t value);
+
+    /**
+     *  @brief  Convert a single precision float to half precision, rounding to nearest even; out of range values saturate to infinity
+     *
+     *  @param  value the single precision value
+     *
+     *  @return the half precision bit pattern
+     */
+    static std::uint16_t FloatToHalf(const float value);
+
+    /**
+     *  @brief  Convert a half precision float to single precision, which is exact
+     *
+     *  @param  halfValue the half precision bit pattern
+     *
+     *  @return the single precision value
+     */
+    static float HalfToFloat(const std::uint16_t halfValue);
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline std::uint8_t PackedFieldCodec::GetWidthCode(const std::uint32_t value)
+{
+    if (0 == value)
+        return 0;
+
+    if (value <= 0xFFu)
+        return 1;
+
+    if (value <= 0xFFFFu)
+        return 2;
+
+    return 3;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline pandora::StatusCode PackedFieldCodec::WriteField(
+    const std::uint32_t value, const std::uint8_t widthCode, pandora::BinaryFileWriter &binaryFileWriter)
+{
+    if (1 == widthCode)
+        return binaryFileWriter.WriteVariable(static_cast<std::uint8_t>(value));
+
+    if (2 == widthCode)
+        return binaryFileWriter.WriteVariable(static_cast<std::uint16_t>(value));
+
+    if (3 == widthCode)
+        return binaryFileWriter.WriteVariable(value);
+
+    return pandora::STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline pandora::StatusCode PackedFieldCodec::ReadField(
+    const std::uint8_t widthCode, pandora::BinaryFileReader &binaryFileReader, std::uint32_t &value)
+{
+    value = 0;
+
+    if (1 == widthCode)
+    {
+        std::uint8_t byteValue(0);
+        PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, binaryFileReader.ReadVariable(byteValue));
+        value = byteValue;
+    }
+    else if (2 == widthCode)
+    {
+        std::uint16_t shortValue(0);
+        PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, binaryFileReader.ReadVariable(shortValue));
+        value = shortValue;
+    }
+    else if (3 == widthCode)
+    {
+        PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, binaryFileReader.ReadVariable(value));
+    }
+
+    return pandora::STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline std::uint32_t PackedFieldCodec::ZigZagEncode(const int value)
+{
+    const std::uint32_t bits(static_cast<std::uint32_t>(value));
+    return ((bits << 1) ^ ((value < 0) ? 0xFFFFFFFFu : 0u));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline int PackedFieldCodec::ZigZagDecode(const std::uint32_t value)
+{
+    const std::uint32_t bits((value >> 1) ^ ((value & 1u) ? 0xFFFFFFFFu : 0u));
+    int result(0);
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline std::uint16_t PackedFieldCodec::FloatToHalf(const float value)
+{
+    std::uint32_t bits(0);
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const std::uint16_t sign(static_cast<std::uint16_t>((bits >> 16) & 0x8000u));
+    const std::uint32_t exponent((bits >> 23) & 0xFFu);
+    std::uint32_t mantissa(bits & 0x7FFFFFu);
+
+    // Nan and infinity
+    if (0xFFu == exponent)
+        return (sign | 0x7C00u | (mantissa ? 0x200u : 0u));
+
+    const int halfExponent(static_cast<int>(exponent) - 127 + 15);
+
+    if (halfExponent >= 31)
+        return (sign | 0x7C00u);
+
+    if (halfExponent <= 0)
+    {
+        // Subnormal half precision values, or zero if too small
+        if (halfExponent < -10)
+            return sign;
+
+        mantissa |= 0x800000u;
+        const unsigned int shift(14 - halfExponent);
+        const std::uint32_t halfMantissa(mantissa >> shift);
+        const std::uint32_t remainder(mantissa & ((1u << shift) - 1u));
+        const std::uint32_t halfway(1u << (shift - 1));
+        const bool roundUp((remainder > halfway) || ((remainder == halfway) && (halfMantissa & 1u)));
+
+        return static_cast<std::uint16_t>(sign | (halfMantissa + (roundUp ? 1u : 0u)));
+    }
+
+    const std::uint32_t halfValue((static_cast<std::uint32_t>(halfExponent) << 10) | (mantissa >> 13));
+    const std::uint32_t remainder(mantissa & 0x1FFFu);
+    const bool roundUp((remainder > 0x1000u) || ((remainder == 0x1000u) && (halfValue & 1u)));
+
+    // ATTN A carry out of the mantissa correctly increments the exponent, reaching infinity at the top of the range
+    return static_cast<std::uint16_t>(sign | (halfValue + (roundUp ? 1u : 0u)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float PackedFieldCodec::HalfToFloat(const std::uint16_t halfValue)
+{
+    const std::uint32_t sign(static_cast<std::uint32_t>(halfValue & 0x8000u) << 16);
+    const std::uint32_t exponent((halfValue >> 10) & 0x1Fu);
+    std::uint32_t mantissa(halfValue & 0x3FFu);
+    std::uint32_t bits(sign);
+
+    if (0x1Fu == exponent)
+    {
+        bits |= 0x7F800000u | (mantissa << 13);
+    }
+    else if (0 != exponent)
+    {
+        bits |= ((exponent + 127 - 15) << 23) | (mantissa << 13);
+    }
+    else if (0 != mantissa)
+    {
+        // Normalise a subnormal half precision value
+        std::uint32_t floatExponent(127 - 15 + 1);
+
+        while (!(mantissa & 0x400u))
+        {
+            mantissa <<= 1;
+            --floatExponent;
+        }
+
+        bits |= (floatExponent << 23) | ((mantissa & 0x3FFu) << 13);
+    }
+
+    float result(0.f);
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_PACKED_FIELD_CODEC_H
@@ -0,0 +1,132 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArPfoHierarchyIndex.cc
+ *
+ *  @brief  Implementation of the lar pfo hierarchy index class.
+ *
+ *  $Log: $
+ */
+
+#include "Objects/ParticleFlowObject.h"
+
+#include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+
+#include "larpandoracontent/LArObjects/LArPfoHierarchyIndex.h"
+
+#include <algorithm>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+PfoHierarchyIndex::PfoHierarchyIndex(const PfoList &pfoList)
+{
+    PfoList allConnectedPfos;
+    LArPfoHelper::GetAllConnectedPfos(pfoList, allConnectedPfos);
+
+    m_pfoVector.reserve(allConnectedPfos.size());
+    m_entryVector.reserve(allConnectedPfos.size());
+
+    typedef std::pair<const ParticleFlowObject *, unsigned int> PfoParentIndexPair;
+    std::vector<PfoParentIndexPair> pfoStack;
+
+    for (const ParticleFlowObject *const pRootPfo : allConnectedPfos)
+    {
+        if (!pRootPfo->GetParentPfoList().empty())
+            continue;
+
+        const unsigned int rootIndex(m_pfoVector.size());
+        pfoStack.emplace_back(pRootPfo, rootIndex);
+
+        while (!pfoStack.empty())
+        {
+            const ParticleFlowObject *const pPfo(pfoStack.back().first);
+            const unsigned int parentIndex(pfoStack.back().second), index(m_pfoVector.size());
+            pfoStack.pop_back();
+
+            // ATTN A pfo reached twice has several parents, for which the hierarchy tier and top-level parent are undefined
+            if (!m_pfoToIndexMap.insert(PfoToIndexMap::value_type(pPfo, index)).second)
+                throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+            m_pfoVector.push_back(pPfo);
+            m_entryVector.emplace_back(index, parentIndex, rootIndex, (index == rootIndex) ? 0 : m_entryVector.at(parentIndex).m_tier + 1);
+
+            const PfoList &daughterPfoList(pPfo->GetDaughterPfoList());
+
+            for (PfoList::const_reverse_iterator iter = daughterPfoList.rbegin(); iter != daughterPfoList.rend(); ++iter)
+                pfoStack.emplace_back(*iter, index);
+        }
+    }
+
+    // ATTN Pfos in a hierarchy without a top-level parent cannot be reached
+    if (m_pfoVector.size() != allConnectedPfos.size())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    // Downstream pfos follow their parent in depth-first order, so each range end can be propagated upwards in a single reverse pass
+    for (unsigned int index = m_entryVector.size(); index > 0; --index)
+    {
+        const HierarchyEntry &entry(m_entryVector.at(index - 1));
+
+        if (entry.m_parentIndex != index - 1)
+        {
+            HierarchyEntry &parentEntry(m_entryVector.at(entry.m_parentIndex));
+            parentEntry.m_endIndex = std::max(parentEntry.m_endIndex, entry.m_endIndex);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int PfoHierarchyIndex::GetHierarchyTier(const ParticleFlowObject *const pPfo) const
+{
+    return m_entryVector.at(this->GetIndex(pPfo)).m_tier;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const ParticleFlowObject *PfoHierarchyIndex::GetParentPfo(const ParticleFlowObject *const pPfo) const
+{
+    return m_pfoVector.at(m_entryVector.at(this->GetIndex(pPfo)).m_rootIndex);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PfoHierarchyIndex::GetAllDownstreamPfos(const ParticleFlowObject *const pPfo, PfoList &outputPfoList) const
+{
+    const unsigned int index(this->GetIndex(pPfo));
+    outputPfoList.insert(outputPfoList.end(), m_pfoVector.begin() + index, m_pfoVector.begin() + m_entryVector.at(index).m_endIndex);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int PfoHierarchyIndex::GetNDownstreamPfos(const ParticleFlowObject *const pPfo) const
+{
+    const unsigned int index(this->GetIndex(pPfo));
+    return (m_entryVector.at(index).m_endIndex - index - 1);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int PfoHierarchyIndex::GetIndex(const ParticleFlowObject *const pPfo) const
+{
+    const PfoToIndexMap::const_iterator iter(m_pfoToIndexMap.find(pPfo));
+
+    if (m_pfoToIndexMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+PfoHierarchyIndex::HierarchyEntry::HierarchyEntry(
+    const unsigned int index, const unsigned int parentIndex, const unsigned int rootIndex, const int tier) :
+    m_parentIndex(parentIndex),
+    m_rootIndex(rootIndex),
+    m_endIndex(index + 1),
+    m_tier(tier)
+{
+}
+
+} // namespace lar_content
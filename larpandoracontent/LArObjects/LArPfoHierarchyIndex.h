@@ -0,0 +1,142 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArPfoHierarchyIndex.h
+ *
+ *  @brief  Header file for the lar pfo hierarchy index class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_PFO_HIERARCHY_INDEX_H
+#define LAR_PFO_HIERARCHY_INDEX_H 1
+
+#include "Pandora/PandoraInternal.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  PfoHierarchyIndex class, a flattened snapshot of one or more pfo hierarchies. The pfos are stored in depth-first order, so that
+ *          the downstream pfos of each pfo occupy a contiguous range, and the hierarchy tier and top-level parent of each pfo are recorded.
+ *          The index is not updated if the hierarchies are subsequently modified; it should be built once the hierarchies are complete,
+ *          e.g. once per event, and then shared by the repeated queries.
+ */
+class PfoHierarchyIndex
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pfoList the input pfo list, all pfos connected to which are indexed; each pfo must have at most one parent
+     */
+    PfoHierarchyIndex(const pandora::PfoList &pfoList);
+
+    /**
+     *  @brief  Whether a pfo is indexed
+     *
+     *  @param  pPfo the address of the pfo
+     *
+     *  @return boolean
+     */
+    bool Contains(const pandora::ParticleFlowObject *const pPfo) const;
+
+    /**
+     *  @brief  Get the indexed pfos, in depth-first order
+     *
+     *  @return the indexed pfos
+     */
+    const pandora::PfoVector &GetPfoVector() const;
+
+    /**
+     *  @brief  Get the position of a pfo in the hierarchy, with zero for pfos without parents (equivalent to LArPfoHelper::GetHierarchyTier)
+     *
+     *  @param  pPfo the address of the pfo
+     *
+     *  @return the hierarchy tier
+     */
+    int GetHierarchyTier(const pandora::ParticleFlowObject *const pPfo) const;
+
+    /**
+     *  @brief  Get the top-level parent of a pfo (equivalent to LArPfoHelper::GetParentPfo)
+     *
+     *  @param  pPfo the address of the pfo
+     *
+     *  @return the address of the top-level parent pfo
+     */
+    const pandora::ParticleFlowObject *GetParentPfo(const pandora::ParticleFlowObject *const pPfo) const;
+
+    /**
+     *  @brief  Append a pfo and all of its downstream pfos to a list, in the order given by LArPfoHelper::GetAllDownstreamPfos
+     *
+     *  @param  pPfo the address of the pfo
+     *  @param  outputPfoList to receive the pfo and its downstream pfos
+     */
+    void GetAllDownstreamPfos(const pandora::ParticleFlowObject *const pPfo, pandora::PfoList &outputPfoList) const;
+
+    /**
+     *  @brief  Get the number of pfos downstream of a pfo, excluding the pfo itself
+     *
+     *  @param  pPfo the address of the pfo
+     *
+     *  @return the number of downstream pfos
+     */
+    unsigned int GetNDownstreamPfos(const pandora::ParticleFlowObject *const pPfo) const;
+
+private:
+    /**
+     *  @brief  HierarchyEntry class
+     */
+    class HierarchyEntry
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  index the index of the pfo
+         *  @param  parentIndex the index of the parent pfo, equal to the pfo index for pfos without parents
+         *  @param  rootIndex the index of the top-level parent pfo
+         *  @param  tier the hierarchy tier
+         */
+        HierarchyEntry(const unsigned int index, const unsigned int parentIndex, const unsigned int rootIndex, const int tier);
+
+        unsigned int m_parentIndex; ///< The index of the parent pfo, equal to the pfo index for pfos without parents
+        unsigned int m_rootIndex;   ///< The index of the top-level parent pfo
+        unsigned int m_endIndex;    ///< The index one beyond the last downstream pfo
+        int m_tier;                 ///< The hierarchy tier
+    };
+
+    typedef std::vector<HierarchyEntry> HierarchyEntryVector;
+    typedef std::unordered_map<const pandora::ParticleFlowObject *, unsigned int> PfoToIndexMap;
+
+    /**
+     *  @brief  Get the index of a pfo, throwing if the pfo is not indexed
+     *
+     *  @param  pPfo the address of the pfo
+     *
+     *  @return the index
+     */
+    unsigned int GetIndex(const pandora::ParticleFlowObject *const pPfo) const;
+
+    pandora::PfoVector m_pfoVector;     ///< The indexed pfos, in depth-first order
+    HierarchyEntryVector m_entryVector; ///< The hierarchy entries, in the same order as the pfos
+    PfoToIndexMap m_pfoToIndexMap;      ///< The map from each pfo to its index
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool PfoHierarchyIndex::Contains(const pandora::ParticleFlowObject *const pPfo) const
+{
+    return (m_pfoToIndexMap.count(pPfo) > 0);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::PfoVector &PfoHierarchyIndex::GetPfoVector() const
+{
+    return m_pfoVector;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_PFO_HIERARCHY_INDEX_H
@@ -0,0 +1,137 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArTwoDHitGrid.cc
+ *
+ *  @brief  Implementation of the two dimensional hit grid class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArObjects/LArTwoDHitGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+TwoDHitGrid::TwoDHitGrid(const CaloHitList *const pCaloHitList, const float cellSize, const float searchTolerance) :
+    m_pCaloHitList(pCaloHitList),
+    m_searchTolerance(searchTolerance),
+    m_maxHitWidth(0.f),
+    m_pointGrid(cellSize)
+{
+    if (!m_pCaloHitList || (m_searchTolerance < 0.f))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    m_caloHitVector.reserve(m_pCaloHitList->size());
+    m_positionsX.reserve(m_pCaloHitList->size());
+    m_positionsZ.reserve(m_pCaloHitList->size());
+
+    for (const CaloHit *const pCaloHit : *m_pCaloHitList)
+    {
+        const CartesianVector &hitPosition(pCaloHit->GetPositionVector());
+
+        m_pointGrid.AddPoint(hitPosition, m_caloHitVector.size());
+        m_caloHitVector.push_back(pCaloHit);
+        m_positionsX.push_back(hitPosition.GetX());
+        m_positionsZ.push_back(hitPosition.GetZ());
+        m_maxHitWidth = std::max(m_maxHitWidth, pCaloHit->GetCellSize1());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDHitGrid::FindHitsInRadius(const CartesianVector &centre, const float nominalRadius, CaloHitList &caloHitList) const
+{
+    const float radius(nominalRadius + m_searchTolerance);
+
+    HitIndexVector candidateIndices;
+    m_pointGrid.GetBoxIndices(centre.GetX() - radius, centre.GetX() + radius, centre.GetZ() - radius, centre.GetZ() + radius, candidateIndices);
+
+    const float radiusSquared(radius * radius);
+    HitIndexVector hitIndices;
+
+    for (const unsigned int hitIndex : candidateIndices)
+    {
+        const float dX(m_positionsX[hitIndex] - centre.GetX()), dZ(m_positionsZ[hitIndex] - centre.GetZ());
+
+        if ((dX * dX + dZ * dZ) <= radiusSquared)
+            hitIndices.push_back(hitIndex);
+    }
+
+    this->FillCaloHitList(hitIndices, caloHitList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDHitGrid::FindHitsInCorridor(
+    const CartesianVector &start, const CartesianVector &end, const float nominalHalfWidth, CaloHitList &caloHitList) const
+{
+    HitIndexVector hitIndices;
+    this->CollectCorridorHits(start, end, nominalHalfWidth + m_searchTolerance, hitIndices);
+    this->FillCaloHitList(hitIndices, caloHitList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDHitGrid::FindHitsInRay(
+    const CartesianVector &start, const CartesianVector &direction, const float nominalHalfWidth, CaloHitList &caloHitList) const
+{
+    this->FindHitsInRays(start, CartesianPointVector(1, direction), nominalHalfWidth, caloHitList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDHitGrid::FindHitsInRays(
+    const CartesianVector &start, const CartesianPointVector &directions, const float nominalHalfWidth, CaloHitList &caloHitList) const
+{
+    if (m_pointGrid.IsEmpty())
+        return;
+
+    const float halfWidth(nominalHalfWidth + m_searchTolerance);
+
+    // Clip the rays at the furthest corner of the grid extent
+    const float deltaX(std::max(std::fabs(m_pointGrid.GetMinX() - start.GetX()), std::fabs(m_pointGrid.GetMaxX() - start.GetX())));
+    const float deltaZ(std::max(std::fabs(m_pointGrid.GetMinZ() - start.GetZ()), std::fabs(m_pointGrid.GetMaxZ() - start.GetZ())));
+    const float rayLength(std::sqrt(deltaX * deltaX + deltaZ * deltaZ) + halfWidth);
+
+    HitIndexVector hitIndices;
+
+    for (const CartesianVector &direction : directions)
+        this->CollectCorridorHits(start, start + (direction * rayLength), halfWidth, hitIndices);
+
+    this->FillCaloHitList(hitIndices, caloHitList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDHitGrid::CollectCorridorHits(const CartesianVector &start, const CartesianVector &end, const float halfWidth, HitIndexVector &hitIndices) const
+{
+    HitIndexVector candidateIndices;
+    m_pointGrid.GetSegmentIndices(start, end, halfWidth, candidateIndices);
+
+    const float halfWidthSquared(halfWidth * halfWidth);
+
+    for (const unsigned int hitIndex : candidateIndices)
+    {
+        if (TwoDPointGrid::GetDistanceToSegmentSquared(m_positionsX[hitIndex], m_positionsZ[hitIndex], start, end) <= halfWidthSquared)
+            hitIndices.push_back(hitIndex);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDHitGrid::FillCaloHitList(HitIndexVector &hitIndices, CaloHitList &caloHitList) const
+{
+    std::sort(hitIndices.begin(), hitIndices.end());
+    hitIndices.erase(std::unique(hitIndices.begin(), hitIndices.end()), hitIndices.end());
+
+    for (const unsigned int hitIndex : hitIndices)
+        caloHitList.push_back(m_caloHitVector[hitIndex]);
+}
+
+} // namespace lar_content
@@ -0,0 +1,168 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArTwoDHitGrid.h
+ *
+ *  @brief  Header file for the two dimensional hit grid class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_TWO_D_HIT_GRID_H
+#define LAR_TWO_D_HIT_GRID_H 1
+
+#include "Objects/CaloHit.h"
+#include "Objects/CartesianVector.h"
+
+#include "Pandora/PandoraInternal.h"
+
+#include "larpandoracontent/LArObjects/LArTwoDPointGrid.h"
+
+#include <string>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  TwoDHitGrid class, a uniform grid over the cached (x, z) positions of the hits in a 2D hit list. All queries return hits in
+ *          the order of the input list, so can replace a full scan of the list without changing the result of order-dependent logic.
+ *          Each query region is widened by the search tolerance, so callers applying their own cut at the nominal distance are not
+ *          exposed to rounding differences at the region boundary.
+ */
+class TwoDHitGrid
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pCaloHitList the address of the 2D hit list, which must outlive the grid
+     *  @param  cellSize the grid cell size
+     *  @param  searchTolerance the distance by which each query region is widened
+     */
+    TwoDHitGrid(const pandora::CaloHitList *const pCaloHitList, const float cellSize, const float searchTolerance);
+
+    /**
+     *  @brief  Get the indexed hit list
+     *
+     *  @return the indexed hit list
+     */
+    const pandora::CaloHitList &GetCaloHitList() const;
+
+    /**
+     *  @brief  Get the largest hit width (cell size 1) in the indexed hit list
+     *
+     *  @return the largest hit width
+     */
+    float GetMaxHitWidth() const;
+
+    /**
+     *  @brief  Collect the hits whose positions lie within a given radius of a point
+     *
+     *  @param  centre the point
+     *  @param  nominalRadius the radius, before widening by the search tolerance
+     *  @param  caloHitList to receive the hits, in input list order
+     */
+    void FindHitsInRadius(const pandora::CartesianVector &centre, const float nominalRadius, pandora::CaloHitList &caloHitList) const;
+
+    /**
+     *  @brief  Collect the hits whose positions lie within a given distance of a line segment
+     *
+     *  @param  start the segment start position
+     *  @param  end the segment end position
+     *  @param  nominalHalfWidth the corridor half width, before widening by the search tolerance
+     *  @param  caloHitList to receive the hits, in input list order
+     */
+    void FindHitsInCorridor(const pandora::CartesianVector &start, const pandora::CartesianVector &end, const float nominalHalfWidth,
+        pandora::CaloHitList &caloHitList) const;
+
+    /**
+     *  @brief  Collect the hits whose positions lie within a given distance of a ray
+     *
+     *  @param  start the ray start position
+     *  @param  direction the (unit) ray direction
+     *  @param  nominalHalfWidth the corridor half width, before widening by the search tolerance
+     *  @param  caloHitList to receive the hits, in input list order
+     */
+    void FindHitsInRay(const pandora::CartesianVector &start, const pandora::CartesianVector &direction, const float nominalHalfWidth,
+        pandora::CaloHitList &caloHitList) const;
+
+    /**
+     *  @brief  Collect the hits whose positions lie within a given distance of any of a set of rays with a common start position
+     *
+     *  @param  start the ray start position
+     *  @param  directions the (unit) ray directions
+     *  @param  nominalHalfWidth the corridor half width, before widening by the search tolerance
+     *  @param  caloHitList to receive the hits, in input list order and without duplicates
+     */
+    void FindHitsInRays(const pandora::CartesianVector &start, const pandora::CartesianPointVector &directions,
+        const float nominalHalfWidth, pandora::CaloHitList &caloHitList) const;
+
+private:
+    typedef TwoDPointGrid::IndexVector HitIndexVector;
+
+    /**
+     *  @brief  Collect the indices of the hits whose positions lie within a given distance of a line segment
+     *
+     *  @param  start the segment start position
+     *  @param  end the segment end position
+     *  @param  halfWidth the corridor half width
+     *  @param  hitIndices to receive the hit indices
+     */
+    void CollectCorridorHits(const pandora::CartesianVector &start, const pandora::CartesianVector &end, const float halfWidth,
+        HitIndexVector &hitIndices) const;
+
+    /**
+     *  @brief  Fill a hit list with the hits of a set of indices, in input list order and without duplicates
+     *
+     *  @param  hitIndices the hit indices (will be sorted)
+     *  @param  caloHitList to receive the hits
+     */
+    void FillCaloHitList(HitIndexVector &hitIndices, pandora::CaloHitList &caloHitList) const;
+
+    const pandora::CaloHitList *m_pCaloHitList; ///< The address of the indexed hit list
+    float m_searchTolerance;                    ///< The distance by which each query region is widened
+    float m_maxHitWidth;                        ///< The largest hit width in the indexed hit list
+    pandora::CaloHitVector m_caloHitVector;     ///< The hits, in input list order
+    pandora::FloatVector m_positionsX;          ///< The cached hit x positions
+    pandora::FloatVector m_positionsZ;          ///< The cached hit z positions
+    TwoDPointGrid m_pointGrid;                  ///< The grid over the hit positions, indexed by position in the input list
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CaloHitList &TwoDHitGrid::GetCaloHitList() const
+{
+    return *m_pCaloHitList;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float TwoDHitGrid::GetMaxHitWidth() const
+{
+    return m_maxHitWidth;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  TwoDHitGridProvider class, an interface for algorithms that index named 2D hit lists, so that their tools can share the index
+ */
+class TwoDHitGridProvider
+{
+public:
+    /**
+     *  @brief  Destructor
+     */
+    virtual ~TwoDHitGridProvider() = default;
+
+    /**
+     *  @brief  Get the hit grid indexing a named 2D hit list
+     *
+     *  @param  caloHitListName the name of the hit list
+     *
+     *  @return address of the hit grid, nullptr if no grid currently indexes the named list
+     */
+    virtual const TwoDHitGrid *GetHitGrid(const std::string &caloHitListName) const = 0;
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_TWO_D_HIT_GRID_H
@@ -0,0 +1,192 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArTwoDPointGrid.cc
+ *
+ *  @brief  Implementation of the two dimensional point grid class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArObjects/LArTwoDPointGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+TwoDPointGrid::TwoDPointGrid(const float cellSize) :
+    m_cellSize(cellSize),
+    m_isEmpty(true),
+    m_minX(std::numeric_limits<float>::max()),
+    m_maxX(-std::numeric_limits<float>::max()),
+    m_minZ(std::numeric_limits<float>::max()),
+    m_maxZ(-std::numeric_limits<float>::max())
+{
+    if (m_cellSize < std::numeric_limits<float>::epsilon())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDPointGrid::AddPoint(const CartesianVector &position, const unsigned int index)
+{
+    m_isEmpty = false;
+    m_minX = std::min(m_minX, position.GetX());
+    m_maxX = std::max(m_maxX, position.GetX());
+    m_minZ = std::min(m_minZ, position.GetZ());
+    m_maxZ = std::max(m_maxZ, position.GetZ());
+
+    const int xIndex(this->GetGridIndex(position.GetX())), zIndex(this->GetGridIndex(position.GetZ()));
+    Cell &cell(m_cellMap[this->GetCellKey(xIndex, zIndex)]);
+    cell.m_xIndex = xIndex;
+    cell.m_zIndex = zIndex;
+    cell.m_indices.push_back(index);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDPointGrid::GetNeighbourIndices(const CartesianVector &position, IndexVector &indices) const
+{
+    if (m_isEmpty)
+        return;
+
+    if ((position.GetX() - m_maxX >= m_cellSize) || (m_minX - position.GetX() >= m_cellSize) || (position.GetZ() - m_maxZ >= m_cellSize) ||
+        (m_minZ - position.GetZ() >= m_cellSize))
+    {
+        return;
+    }
+
+    const int xIndex(this->GetGridIndex(position.GetX())), zIndex(this->GetGridIndex(position.GetZ()));
+
+    for (int xOffset = -1; xOffset <= 1; ++xOffset)
+    {
+        for (int zOffset = -1; zOffset <= 1; ++zOffset)
+        {
+            CellMap::const_iterator iter(m_cellMap.find(this->GetCellKey(xIndex + xOffset, zIndex + zOffset)));
+
+            if (m_cellMap.end() != iter)
+                indices.insert(indices.end(), iter->second.m_indices.begin(), iter->second.m_indices.end());
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDPointGrid::GetBoxIndices(const float minX, const float maxX, const float minZ, const float maxZ, IndexVector &indices) const
+{
+    this->CollectIndices(minX, maxX, minZ, maxZ, nullptr, nullptr, 0.f, indices);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDPointGrid::GetSegmentIndices(const CartesianVector &start, const CartesianVector &end, const float maxDistance, IndexVector &indices) const
+{
+    // ATTN Cells are skipped if their centre is further from the segment than the max distance plus the cell half diagonal
+    const float maxCellDistance(maxDistance + m_cellSize * std::sqrt(0.5f));
+
+    this->CollectIndices(std::min(start.GetX(), end.GetX()) - maxDistance, std::max(start.GetX(), end.GetX()) + maxDistance,
+        std::min(start.GetZ(), end.GetZ()) - maxDistance, std::max(start.GetZ(), end.GetZ()) + maxDistance, &start, &end, maxCellDistance, indices);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool TwoDPointGrid::IsSeparatedFrom(const TwoDPointGrid &other) const
+{
+    if (m_isEmpty || other.m_isEmpty)
+        return true;
+
+    return ((other.m_minX - m_maxX >= m_cellSize) || (m_minX - other.m_maxX >= m_cellSize) || (other.m_minZ - m_maxZ >= m_cellSize) ||
+        (m_minZ - other.m_maxZ >= m_cellSize));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float TwoDPointGrid::GetDistanceToSegmentSquared(const float x, const float z, const CartesianVector &start, const CartesianVector &end)
+{
+    const float segmentX(end.GetX() - start.GetX()), segmentZ(end.GetZ() - start.GetZ());
+    const float segmentLengthSquared(segmentX * segmentX + segmentZ * segmentZ);
+    const float dX(x - start.GetX()), dZ(z - start.GetZ());
+
+    if (segmentLengthSquared < std::numeric_limits<float>::epsilon())
+        return (dX * dX + dZ * dZ);
+
+    const float fraction(std::max(0.f, std::min(1.f, (dX * segmentX + dZ * segmentZ) / segmentLengthSquared)));
+    const float perpX(dX - fraction * segmentX), perpZ(dZ - fraction * segmentZ);
+
+    return (perpX * perpX + perpZ * perpZ);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int TwoDPointGrid::GetGridIndex(const float coordinate) const
+{
+    return static_cast<int>(std::floor(coordinate / m_cellSize));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned long long TwoDPointGrid::GetCellKey(const int xIndex, const int zIndex) const
+{
+    // ATTN Shift the unsigned bit pattern, as left-shifting a negative index is undefined
+    return (static_cast<unsigned long long>(static_cast<unsigned int>(xIndex)) << 32) | static_cast<unsigned int>(zIndex);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDPointGrid::CollectIndices(const float minX, const float maxX, const float minZ, const float maxZ, const CartesianVector *const pStart,
+    const CartesianVector *const pEnd, const float maxCellDistance, IndexVector &indices) const
+{
+    if (m_isEmpty || (maxX < m_minX) || (minX > m_maxX) || (maxZ < m_minZ) || (minZ > m_maxZ))
+        return;
+
+    const int minXIndex(this->GetGridIndex(std::max(minX, m_minX))), maxXIndex(this->GetGridIndex(std::min(maxX, m_maxX)));
+    const int minZIndex(this->GetGridIndex(std::max(minZ, m_minZ))), maxZIndex(this->GetGridIndex(std::min(maxZ, m_maxZ)));
+    const float maxCellDistanceSquared(maxCellDistance * maxCellDistance);
+
+    auto isCellRelevant = [&](const int xIndex, const int zIndex) {
+        if (!pStart || !pEnd)
+            return true;
+
+        const float cellCentreX((static_cast<float>(xIndex) + 0.5f) * m_cellSize), cellCentreZ((static_cast<float>(zIndex) + 0.5f) * m_cellSize);
+        return (TwoDPointGrid::GetDistanceToSegmentSquared(cellCentreX, cellCentreZ, *pStart, *pEnd) <= maxCellDistanceSquared);
+    };
+
+    const double nBoxCells(static_cast<double>(maxXIndex - minXIndex + 1) * static_cast<double>(maxZIndex - minZIndex + 1));
+
+    if (nBoxCells > static_cast<double>(m_cellMap.size()))
+    {
+        // Sparse grid: visit the occupied cells and test whether they lie in the box
+        for (const CellMap::value_type &mapEntry : m_cellMap)
+        {
+            const Cell &cell(mapEntry.second);
+
+            if ((cell.m_xIndex < minXIndex) || (cell.m_xIndex > maxXIndex) || (cell.m_zIndex < minZIndex) || (cell.m_zIndex > maxZIndex) ||
+                !isCellRelevant(cell.m_xIndex, cell.m_zIndex))
+                continue;
+
+            indices.insert(indices.end(), cell.m_indices.begin(), cell.m_indices.end());
+        }
+    }
+    else
+    {
+        for (int xIndex = minXIndex; xIndex <= maxXIndex; ++xIndex)
+        {
+            for (int zIndex = minZIndex; zIndex <= maxZIndex; ++zIndex)
+            {
+                CellMap::const_iterator iter(m_cellMap.find(this->GetCellKey(xIndex, zIndex)));
+
+                if ((m_cellMap.end() == iter) || !isCellRelevant(xIndex, zIndex))
+                    continue;
+
+                indices.insert(indices.end(), iter->second.m_indices.begin(), iter->second.m_indices.end());
+            }
+        }
+    }
+}
+
+} // namespace lar_content
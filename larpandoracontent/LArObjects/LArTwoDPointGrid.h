@@ -0,0 +1,225 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArTwoDPointGrid.h
+ *
+ *  @brief  Header file for the two dimensional point grid class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_TWO_D_POINT_GRID_H
+#define LAR_TWO_D_POINT_GRID_H 1
+
+#include "Objects/CartesianVector.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  TwoDPointGrid class, a sparse uniform grid over the (x, z) coordinates of a set of indexed points. Queries return the indices
+ *          of the points in the relevant cells, a superset of the points of interest, which callers then select exactly.
+ */
+class TwoDPointGrid
+{
+public:
+    typedef std::vector<unsigned int> IndexVector;
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  cellSize the grid cell size, which must be positive
+     */
+    TwoDPointGrid(const float cellSize);
+
+    /**
+     *  @brief  Add a point to the grid
+     *
+     *  @param  position the point position
+     *  @param  index the point index
+     */
+    void AddPoint(const pandora::CartesianVector &position, const unsigned int index);
+
+    /**
+     *  @brief  Whether the grid is empty
+     *
+     *  @return boolean
+     */
+    bool IsEmpty() const;
+
+    /**
+     *  @brief  Get the min. point x position
+     *
+     *  @return the min. point x position
+     */
+    float GetMinX() const;
+
+    /**
+     *  @brief  Get the max. point x position
+     *
+     *  @return the max. point x position
+     */
+    float GetMaxX() const;
+
+    /**
+     *  @brief  Get the min. point z position
+     *
+     *  @return the min. point z position
+     */
+    float GetMinZ() const;
+
+    /**
+     *  @brief  Get the max. point z position
+     *
+     *  @return the max. point z position
+     */
+    float GetMaxZ() const;
+
+    /**
+     *  @brief  Collect the indices of all points lying in the cells neighbouring that of a given position. This includes all points
+     *          closer to the position than the cell size, in no particular order.
+     *
+     *  @param  position the position
+     *  @param  indices to receive the point indices
+     */
+    void GetNeighbourIndices(const pandora::CartesianVector &position, IndexVector &indices) const;
+
+    /**
+     *  @brief  Collect the indices of all points lying in the cells overlapping a box, in no particular order
+     *
+     *  @param  minX the box minimum x
+     *  @param  maxX the box maximum x
+     *  @param  minZ the box minimum z
+     *  @param  maxZ the box maximum z
+     *  @param  indices to receive the point indices
+     */
+    void GetBoxIndices(const float minX, const float maxX, const float minZ, const float maxZ, IndexVector &indices) const;
+
+    /**
+     *  @brief  Collect the indices of all points lying in the cells that could contain points within a given distance of a line segment,
+     *          in no particular order
+     *
+     *  @param  start the segment start position
+     *  @param  end the segment end position
+     *  @param  maxDistance the max. distance between a point and the segment
+     *  @param  indices to receive the point indices
+     */
+    void GetSegmentIndices(
+        const pandora::CartesianVector &start, const pandora::CartesianVector &end, const float maxDistance, IndexVector &indices) const;
+
+    /**
+     *  @brief  Whether the bounding box of the points is separated from that of another grid, in x or z, by at least the cell size
+     *
+     *  @param  other the other grid
+     *
+     *  @return boolean
+     */
+    bool IsSeparatedFrom(const TwoDPointGrid &other) const;
+
+    /**
+     *  @brief  Get the squared distance between a point and a line segment, in the xz plane
+     *
+     *  @param  x the point x
+     *  @param  z the point z
+     *  @param  start the segment start position
+     *  @param  end the segment end position
+     *
+     *  @return the squared distance
+     */
+    static float GetDistanceToSegmentSquared(const float x, const float z, const pandora::CartesianVector &start, const pandora::CartesianVector &end);
+
+private:
+    /**
+     *  @brief  Cell class
+     */
+    class Cell
+    {
+    public:
+        int m_xIndex;          ///< The x grid index
+        int m_zIndex;          ///< The z grid index
+        IndexVector m_indices; ///< The indices of the points in the cell, in the order of addition
+    };
+
+    typedef std::unordered_map<unsigned long long, Cell> CellMap;
+
+    /**
+     *  @brief  Get the grid index for a coordinate
+     *
+     *  @param  coordinate the x or z coordinate
+     *
+     *  @return the grid index
+     */
+    int GetGridIndex(const float coordinate) const;
+
+    /**
+     *  @brief  Get the key of a grid cell
+     *
+     *  @param  xIndex the x grid index
+     *  @param  zIndex the z grid index
+     *
+     *  @return the cell key
+     */
+    unsigned long long GetCellKey(const int xIndex, const int zIndex) const;
+
+    /**
+     *  @brief  Collect the indices of the points in the cells overlapping a box, optionally skipping cells far from a line segment
+     *
+     *  @param  minX the box minimum x
+     *  @param  maxX the box maximum x
+     *  @param  minZ the box minimum z
+     *  @param  maxZ the box maximum z
+     *  @param  pStart address of the segment start position, nullptr to consider all cells in the box
+     *  @param  pEnd address of the segment end position
+     *  @param  maxCellDistance the max. distance between a cell centre and the segment
+     *  @param  indices to receive the point indices
+     */
+    void CollectIndices(const float minX, const float maxX, const float minZ, const float maxZ, const pandora::CartesianVector *const pStart,
+        const pandora::CartesianVector *const pEnd, const float maxCellDistance, IndexVector &indices) const;
+
+    float m_cellSize;  ///< The grid cell size
+    bool m_isEmpty;    ///< Whether the grid is empty
+    float m_minX;      ///< The min. point x position
+    float m_maxX;      ///< The max. point x position
+    float m_minZ;      ///< The min. point z position
+    float m_maxZ;      ///< The max. point z position
+    CellMap m_cellMap; ///< The map from cell key to the cell
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool TwoDPointGrid::IsEmpty() const
+{
+    return m_isEmpty;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float TwoDPointGrid::GetMinX() const
+{
+    return m_minX;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float TwoDPointGrid::GetMaxX() const
+{
+    return m_maxX;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float TwoDPointGrid::GetMinZ() const
+{
+    return m_minZ;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float TwoDPointGrid::GetMaxZ() const
+{
+    return m_maxZ;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_TWO_D_POINT_GRID_H
@@ -12,6 +12,7 @@
 
 #include <cmath>
 #include <map>
+#include <memory_resource>
 #include <vector>
 
 namespace lar_content
@@ -82,6 +83,7 @@ private:
 };
 
 typedef std::map<int, LayerFitResult> LayerFitResultMap;
+typedef std::pmr::map<int, LayerFitResult> PmrLayerFitResultMap;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -156,6 +158,7 @@ private:
 };
 
 typedef std::map<int, LayerFitContribution> LayerFitContributionMap;
+typedef std::pmr::map<int, LayerFitContribution> PmrLayerFitContributionMap;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -225,6 +228,7 @@ private:
 };
 
 typedef std::vector<LayerInterpolation> LayerInterpolationList;
+typedef std::pmr::vector<LayerInterpolation> PmrLayerInterpolationList;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
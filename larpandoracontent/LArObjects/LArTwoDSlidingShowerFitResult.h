@@ -12,6 +12,7 @@
 
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
+#include <memory_resource>
 #include <unordered_map>
 
 namespace lar_content
@@ -160,6 +161,7 @@ private:
 };
 
 typedef std::map<int, ShowerExtent> ShowerPositionMap;
+typedef std::pmr::map<int, ShowerExtent> PmrShowerPositionMap;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
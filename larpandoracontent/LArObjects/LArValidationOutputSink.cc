@@ -0,0 +1,348 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArValidationOutputSink.cc
+ *
+ *  @brief  Implementation of the lar validation output sink classes.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/Pandora.h"
+
+#include "larpandoracontent/LArObjects/LArValidationOutputSink.h"
+
+#ifdef MONITORING
+#include "PandoraMonitoringApi.h"
+#endif
+
+#include <iostream>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+ValidationOutputSink::~ValidationOutputSink()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ValidationOutputSink> ValidationOutputSink::Create(const std::string &formatName, const Pandora &pandora,
+    const std::string &treeName, const std::string &fileName, const unsigned int maxBufferedEntries)
+{
+    if ("root" == formatName)
+        return std::make_unique<RootTreeValidationOutputSink>(pandora, treeName, fileName);
+
+    if ("columnar" == formatName)
+        return std::make_unique<ColumnarValidationOutputSink>(treeName, fileName, maxBufferedEntries);
+
+    std::cout << "ValidationOutputSink: unknown validation output format " << formatName << ", expected root or columnar" << std::endl;
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+RootTreeValidationOutputSink::RootTreeValidationOutputSink(
+    const Pandora &pandora, const std::string &treeName, const std::string &fileName) :
+    m_pandora(pandora),
+    m_treeName(treeName),
+    m_fileName(fileName)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RootTreeValidationOutputSink::SetValue([[maybe_unused]] const char *const columnName, [[maybe_unused]] const int value)
+{
+    PANDORA_MONITORING_API(SetTreeVariable(m_pandora, m_treeName.c_str(), columnName, value));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RootTreeValidationOutputSink::SetValue([[maybe_unused]] const char *const columnName, [[maybe_unused]] const float value)
+{
+    PANDORA_MONITORING_API(SetTreeVariable(m_pandora, m_treeName.c_str(), columnName, value));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RootTreeValidationOutputSink::SetValue([[maybe_unused]] const char *const columnName, [[maybe_unused]] IntVector *const pValues)
+{
+    PANDORA_MONITORING_API(SetTreeVariable(m_pandora, m_treeName.c_str(), columnName, pValues));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RootTreeValidationOutputSink::SetValue([[maybe_unused]] const char *const columnName, [[maybe_unused]] FloatVector *const pValues)
+{
+    PANDORA_MONITORING_API(SetTreeVariable(m_pandora, m_treeName.c_str(), columnName, pValues));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RootTreeValidationOutputSink::Fill()
+{
+    PANDORA_MONITORING_API(FillTree(m_pandora, m_treeName.c_str()));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode RootTreeValidationOutputSink::Close()
+{
+    try
+    {
+        PANDORA_MONITORING_API(SaveTree(m_pandora, m_treeName.c_str(), m_fileName.c_str(), "UPDATE"));
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        return statusCodeException.GetStatusCode();
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ColumnarValidationOutputSink::ColumnarValidationOutputSink(
+    const std::string &treeName, const std::string &fileName, const unsigned int maxBufferedEntries) :
+    m_treeName(treeName),
+    m_fileName(fileName),
+    m_maxBufferedEntries(maxBufferedEntries),
+    m_nextColumnIndex(0),
+    m_isLayoutFixed(false),
+    m_nBufferedEntries(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ColumnarValidationOutputSink::~ColumnarValidationOutputSink()
+{
+    try
+    {
+        this->WriteBufferedEntries();
+    }
+    catch (...)
+    {
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarValidationOutputSink::SetValue(const char *const columnName, const int value)
+{
+    this->GetColumn(columnName, INT_SCALAR).m_intValue = value;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarValidationOutputSink::SetValue(const char *const columnName, const float value)
+{
+    this->GetColumn(columnName, FLOAT_SCALAR).m_floatValue = value;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarValidationOutputSink::SetValue(const char *const columnName, IntVector *const pValues)
+{
+    this->GetColumn(columnName, INT_VECTOR).m_pIntValues = pValues;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarValidationOutputSink::SetValue(const char *const columnName, FloatVector *const pValues)
+{
+    this->GetColumn(columnName, FLOAT_VECTOR).m_pFloatValues = pValues;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarValidationOutputSink::Fill()
+{
+    m_isLayoutFixed = true;
+    m_nextColumnIndex = 0;
+
+    for (Column &column : m_columnVector)
+    {
+        // ATTN Columns record a default value (scalars) or no values (vectors) until first set
+        if (INT_SCALAR == column.m_type)
+        {
+            column.m_bufferedIntValues.push_back(column.m_intValue);
+        }
+        else if (FLOAT_SCALAR == column.m_type)
+        {
+            column.m_bufferedFloatValues.push_back(column.m_floatValue);
+        }
+        else if (INT_VECTOR == column.m_type)
+        {
+            const IntVector emptyValues;
+            const IntVector &values(column.m_pIntValues ? *column.m_pIntValues : emptyValues);
+            column.m_bufferedLengths.push_back(values.size());
+            column.m_bufferedIntValues.insert(column.m_bufferedIntValues.end(), values.begin(), values.end());
+        }
+        else
+        {
+            const FloatVector emptyValues;
+            const FloatVector &values(column.m_pFloatValues ? *column.m_pFloatValues : emptyValues);
+            column.m_bufferedLengths.push_back(values.size());
+            column.m_bufferedFloatValues.insert(column.m_bufferedFloatValues.end(), values.begin(), values.end());
+        }
+    }
+
+    if ((++m_nBufferedEntries >= m_maxBufferedEntries) && (STATUS_CODE_SUCCESS != this->WriteBufferedEntries()))
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ColumnarValidationOutputSink::Close()
+{
+    const StatusCode statusCode(this->WriteBufferedEntries());
+
+    if (m_stream.is_open())
+        m_stream.close();
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ColumnarValidationOutputSink::Column &ColumnarValidationOutputSink::GetColumn(const char *const columnName, const ColumnType type)
+{
+    unsigned int columnIndex(m_nextColumnIndex);
+
+    if ((columnIndex >= m_columnVector.size()) || (m_columnVector[columnIndex].m_name != columnName))
+    {
+        const ColumnIndexMap::const_iterator iter(m_columnIndexMap.find(columnName));
+
+        if (m_columnIndexMap.end() != iter)
+        {
+            columnIndex = iter->second;
+        }
+        else if (!m_isLayoutFixed)
+        {
+            columnIndex = m_columnVector.size();
+            m_columnVector.emplace_back(columnName, type);
+            m_columnIndexMap.emplace(columnName, columnIndex);
+        }
+        else
+        {
+            std::cout << "ColumnarValidationOutputSink: column " << columnName << " was not set before the first entry of " << m_treeName
+                      << std::endl;
+            throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+        }
+    }
+
+    Column &column(m_columnVector[columnIndex]);
+
+    if (type != column.m_type)
+    {
+        std::cout << "ColumnarValidationOutputSink: inconsistent type for column " << columnName << " of " << m_treeName << std::endl;
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    }
+
+    m_nextColumnIndex = columnIndex + 1;
+    return column;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ColumnarValidationOutputSink::WriteBufferedEntries()
+{
+    if (0 == m_nBufferedEntries)
+        return STATUS_CODE_SUCCESS;
+
+    if (!m_stream.is_open())
+    {
+        // Always append to the output file; it may hold several header and data chunk sequences
+        m_stream.open(m_fileName, std::ios_base::app | std::ios_base::binary);
+
+        if (!m_stream.is_open())
+        {
+            std::cout << "ColumnarValidationOutputSink: could not open file for validation output at " << m_fileName << std::endl;
+            return STATUS_CODE_FAILURE;
+        }
+
+        const std::uint32_t formatVersion(1);
+        m_stream.write("HEAD", 4);
+        this->WriteBinaryValue<std::uint32_t>(formatVersion);
+        this->WriteBinaryString(m_treeName);
+        this->WriteBinaryValue<std::uint32_t>(m_columnVector.size());
+
+        for (const Column &column : m_columnVector)
+        {
+            this->WriteBinaryString(column.m_name);
+            this->WriteBinaryValue<std::uint8_t>(column.m_type);
+        }
+    }
+
+    m_stream.write("DATA", 4);
+    this->WriteBinaryValue<std::uint32_t>(m_nBufferedEntries);
+
+    for (Column &column : m_columnVector)
+    {
+        if ((INT_VECTOR == column.m_type) || (FLOAT_VECTOR == column.m_type))
+            this->WriteBinaryValues(column.m_bufferedLengths);
+
+        if ((INT_SCALAR == column.m_type) || (INT_VECTOR == column.m_type))
+            this->WriteBinaryValues(column.m_bufferedIntValues);
+        else
+            this->WriteBinaryValues(column.m_bufferedFloatValues);
+
+        column.m_bufferedLengths.clear();
+        column.m_bufferedIntValues.clear();
+        column.m_bufferedFloatValues.clear();
+    }
+
+    m_nBufferedEntries = 0;
+    m_stream.flush();
+
+    if (!m_stream.good())
+    {
+        std::cout << "ColumnarValidationOutputSink: failed to write validation output to " << m_fileName << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void ColumnarValidationOutputSink::WriteBinaryValue(const T value)
+{
+    m_stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void ColumnarValidationOutputSink::WriteBinaryValues(const std::vector<T> &values)
+{
+    m_stream.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarValidationOutputSink::WriteBinaryString(const std::string &value)
+{
+    this->WriteBinaryValue<std::uint32_t>(value.size());
+    m_stream.write(value.data(), value.size());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ColumnarValidationOutputSink::Column::Column(const std::string &name, const ColumnType type) :
+    m_name(name),
+    m_type(type),
+    m_intValue(0),
+    m_floatValue(0.f),
+    m_pIntValues(nullptr),
+    m_pFloatValues(nullptr)
+{
+}
+
+} // namespace lar_content
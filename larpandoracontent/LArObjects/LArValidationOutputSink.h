@@ -0,0 +1,265 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArValidationOutputSink.h
+ *
+ *  @brief  Header file for the lar validation output sink classes.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_VALIDATION_OUTPUT_SINK_H
+#define LAR_VALIDATION_OUTPUT_SINK_H 1
+
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pandora
+{
+class Pandora;
+} // namespace pandora
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ValidationOutputSink class, the interface for writing validation output as a table of named columns. Column values are set for
+ *          the current entry, and persist until overwritten, so that a value set for an earlier entry is repeated if not set again. Each
+ *          call to Fill records an entry. Vector columns are not copied: the sink holds the caller's vector address and reads the values
+ *          when the entry is recorded, as for a tree branch.
+ */
+class ValidationOutputSink
+{
+public:
+    /**
+     *  @brief  Destructor
+     */
+    virtual ~ValidationOutputSink();
+
+    /**
+     *  @brief  Set the value of a column for the current entry
+     *
+     *  @param  columnName the column name
+     *  @param  value the value
+     */
+    virtual void SetValue(const char *const columnName, const int value) = 0;
+
+    /**
+     *  @brief  Set the value of a column for the current entry
+     *
+     *  @param  columnName the column name
+     *  @param  value the value
+     */
+    virtual void SetValue(const char *const columnName, const float value) = 0;
+
+    /**
+     *  @brief  Set the values of a column for the current entry
+     *
+     *  @param  columnName the column name
+     *  @param  pValues address of the values, which must remain valid and unchanged until the entry is recorded
+     */
+    virtual void SetValue(const char *const columnName, pandora::IntVector *const pValues) = 0;
+
+    /**
+     *  @brief  Set the values of a column for the current entry
+     *
+     *  @param  columnName the column name
+     *  @param  pValues address of the values, which must remain valid and unchanged until the entry is recorded
+     */
+    virtual void SetValue(const char *const columnName, pandora::FloatVector *const pValues) = 0;
+
+    /**
+     *  @brief  Record the current entry
+     */
+    virtual void Fill() = 0;
+
+    /**
+     *  @brief  Write all recorded entries to the output file
+     *
+     *  @return success
+     */
+    virtual pandora::StatusCode Close() = 0;
+
+    /**
+     *  @brief  Create a validation output sink
+     *
+     *  @param  formatName the output format name, "root" (a tree written via the pandora monitoring api) or "columnar"
+     *  @param  pandora the pandora instance
+     *  @param  treeName the name of the output tree
+     *  @param  fileName the name of the output file
+     *  @param  maxBufferedEntries the number of entries buffered before they are written (columnar format)
+     *
+     *  @return the new sink, or nullptr if the format name is not recognised
+     */
+    static std::unique_ptr<ValidationOutputSink> Create(const std::string &formatName, const pandora::Pandora &pandora,
+        const std::string &treeName, const std::string &fileName, const unsigned int maxBufferedEntries);
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  RootTreeValidationOutputSink class, which passes the validation output to a tree managed by the pandora monitoring api. The sink
+ *          does nothing in builds without monitoring.
+ */
+class RootTreeValidationOutputSink : public ValidationOutputSink
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pandora the pandora instance
+     *  @param  treeName the name of the output tree
+     *  @param  fileName the name of the output file
+     */
+    RootTreeValidationOutputSink(const pandora::Pandora &pandora, const std::string &treeName, const std::string &fileName);
+
+    void SetValue(const char *const columnName, const int value) override;
+    void SetValue(const char *const columnName, const float value) override;
+    void SetValue(const char *const columnName, pandora::IntVector *const pValues) override;
+    void SetValue(const char *const columnName, pandora::FloatVector *const pValues) override;
+    void Fill() override;
+    pandora::StatusCode Close() override;
+
+private:
+    const pandora::Pandora &m_pandora; ///< The pandora instance
+    const std::string m_treeName;      ///< The name of the output tree
+    const std::string m_fileName;      ///< The name of the output file
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  ColumnarValidationOutputSink class, which buffers the validation output column by column, writing it in blocks to a binary file
+ *
+ *          The column layout is fixed by the columns set before the first entry is recorded; setting a new column after that point is
+ *          an error. Column lookups first try the column after the one last set, so that the fixed order in which algorithms set their
+ *          columns is found without a map lookup. The file is a sequence of tagged chunks, written in the native byte order: a "HEAD"
+ *          chunk, carrying the format version, tree name and the name and type code of each column, is written when the file is opened
+ *          and each block of entries is written as a "DATA" chunk, carrying the number of entries followed by each column in turn. A
+ *          scalar column holds one value per entry; a vector column holds the length of each entry followed by the concatenated values.
+ *          Type codes are 0 and 1 for int32 and float32 scalars, and 2 and 3 for vectors of the same types.
+ */
+class ColumnarValidationOutputSink : public ValidationOutputSink
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  treeName the name of the output tree, recorded in the file header
+     *  @param  fileName the name of the output file, to which the output is appended
+     *  @param  maxBufferedEntries the number of entries buffered before they are written
+     */
+    ColumnarValidationOutputSink(const std::string &treeName, const std::string &fileName, const unsigned int maxBufferedEntries);
+
+    /**
+     *  @brief  Destructor, writing any buffered entries
+     */
+    ~ColumnarValidationOutputSink();
+
+    void SetValue(const char *const columnName, const int value) override;
+    void SetValue(const char *const columnName, const float value) override;
+    void SetValue(const char *const columnName, pandora::IntVector *const pValues) override;
+    void SetValue(const char *const columnName, pandora::FloatVector *const pValues) override;
+    void Fill() override;
+    pandora::StatusCode Close() override;
+
+private:
+    /**
+     *  @brief  Column type enumeration, values matching the type codes in the file header
+     */
+    enum ColumnType
+    {
+        INT_SCALAR = 0,
+        FLOAT_SCALAR = 1,
+        INT_VECTOR = 2,
+        FLOAT_VECTOR = 3
+    };
+
+    /**
+     *  @brief  Column class
+     */
+    class Column
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  name the column name
+         *  @param  type the column type
+         */
+        Column(const std::string &name, const ColumnType type);
+
+        std::string m_name;                           ///< The column name
+        ColumnType m_type;                            ///< The column type
+        int m_intValue;                               ///< The current int value (int scalar columns)
+        float m_floatValue;                           ///< The current float value (float scalar columns)
+        const pandora::IntVector *m_pIntValues;       ///< Address of the current int values (int vector columns)
+        const pandora::FloatVector *m_pFloatValues;   ///< Address of the current float values (float vector columns)
+        std::vector<std::uint32_t> m_bufferedLengths; ///< The buffered number of values per entry (vector columns)
+        pandora::IntVector m_bufferedIntValues;       ///< The buffered int values
+        pandora::FloatVector m_bufferedFloatValues;   ///< The buffered float values
+    };
+
+    typedef std::vector<Column> ColumnVector;
+    typedef std::map<std::string, unsigned int> ColumnIndexMap;
+
+    /**
+     *  @brief  Get the column with a given name and type, adding it to the layout if the layout is not yet fixed
+     *
+     *  @param  columnName the column name
+     *  @param  type the column type
+     *
+     *  @return the column
+     */
+    Column &GetColumn(const char *const columnName, const ColumnType type);
+
+    /**
+     *  @brief  Write the buffered entries to the output file, opening the file and writing its header if required
+     *
+     *  @return success
+     */
+    pandora::StatusCode WriteBufferedEntries();
+
+    /**
+     *  @brief  Write a value to the output file, in the native byte order
+     *
+     *  @param  value the value
+     */
+    template <typename T>
+    void WriteBinaryValue(const T value);
+
+    /**
+     *  @brief  Write a block of values to the output file, in the native byte order
+     *
+     *  @param  values the values
+     */
+    template <typename T>
+    void WriteBinaryValues(const std::vector<T> &values);
+
+    /**
+     *  @brief  Write a string to the output file, preceded by its length
+     *
+     *  @param  value the string
+     */
+    void WriteBinaryString(const std::string &value);
+
+    const std::string m_treeName;            ///< The name of the output tree
+    const std::string m_fileName;            ///< The name of the output file
+    const unsigned int m_maxBufferedEntries; ///< The number of entries buffered before they are written
+    ColumnVector m_columnVector;             ///< The columns, in layout order
+    ColumnIndexMap m_columnIndexMap;         ///< The map from column name to layout index
+    unsigned int m_nextColumnIndex;          ///< The layout index after that of the column last set
+    bool m_isLayoutFixed;                    ///< Whether the column layout is fixed
+    unsigned int m_nBufferedEntries;         ///< The number of buffered entries
+    std::ofstream m_stream;                  ///< The output file stream
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_VALIDATION_OUTPUT_SINK_H
@@ -15,6 +15,7 @@
 #include "larpandoracontent/LArObjects/LArMCParticle.h"
 
 #include "larpandoracontent/LArPersistency/EventReadingAlgorithm.h"
+#include "larpandoracontent/LArPersistency/LArEventFilePrefetcher.h"
 
 #include <algorithm>
 
@@ -25,11 +26,20 @@ namespace lar_content
 
 EventReadingAlgorithm::EventReadingAlgorithm() :
     m_skipToEvent(0),
+    m_eventStride(1),
+    m_nextEventIndex(0),
+    m_readerEventIndex(0),
+    m_isReaderEventPresent(false),
+    m_interleaveEventFiles(false),
     m_useLArCaloHits(true),
     m_larCaloHitVersion(1),
     m_useLArMCParticles(true),
     m_larMCParticleVersion(2),
-    m_pEventFileReader(nullptr)
+    m_prefetchEventFiles(false),
+    m_nPrefetchFiles(1),
+    m_pEventFileReader(nullptr),
+    m_pEventFilePrefetcher(nullptr),
+    m_interleavedReaderIndex(0)
 {
 }
 
@@ -38,6 +48,10 @@ EventReadingAlgorithm::EventReadingAlgorithm() :
 EventReadingAlgorithm::~EventReadingAlgorithm()
 {
     delete m_pEventFileReader;
+    delete m_pEventFilePrefetcher;
+
+    for (FileReader *const pFileReader : m_interleavedFileReaders)
+        delete pFileReader;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -66,8 +80,41 @@ StatusCode EventReadingAlgorithm::Initialize()
 
     if (!m_eventFileName.empty())
     {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReplaceEventFileReader(m_eventFileName));
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pEventFileReader->GoToEvent(m_skipToEvent));
+        // ATTN Remaining file names are held in reverse order, so that the next file is at the back
+        StringVector orderedFileNameVector(1, m_eventFileName);
+        orderedFileNameVector.insert(orderedFileNameVector.end(), m_eventFileNameVector.rbegin(), m_eventFileNameVector.rend());
+
+        // ATTN Interleaved event files are all open from the start, so there are no upcoming files to stage
+        if (m_prefetchEventFiles && !m_interleaveEventFiles)
+            m_pEventFilePrefetcher = new EventFilePrefetcher(orderedFileNameVector, m_nPrefetchFiles);
+
+        if (m_interleaveEventFiles)
+        {
+            for (const std::string &fileName : orderedFileNameVector)
+            {
+                std::cout << "EventReadingAlgorithm: Interleaving event file: " << fileName << std::endl;
+                FileReader *const pFileReader(this->CreateEventFileReader(fileName));
+
+                if (!pFileReader)
+                    return STATUS_CODE_FAILURE;
+
+                m_interleavedFileReaders.push_back(pFileReader);
+            }
+        }
+        else
+        {
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReplaceEventFileReader(m_eventFileName));
+
+            // The first event to consider when reading every n-th event may lie beyond the first file, so is located on demand
+            if (m_eventStride > 1)
+            {
+                m_nextEventIndex = m_skipToEvent;
+            }
+            else
+            {
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pEventFileReader->GoToEvent(m_skipToEvent));
+            }
+        }
     }
 
     return STATUS_CODE_SUCCESS;
@@ -77,15 +124,27 @@ StatusCode EventReadingAlgorithm::Initialize()
 
 StatusCode EventReadingAlgorithm::Run()
 {
-    if ((nullptr != m_pEventFileReader) && !m_eventFileName.empty())
+    if (!m_interleavedFileReaders.empty())
     {
-        try
+        this->ReadInterleavedEvent();
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RepeatEventPreparation(*this));
+    }
+    else if ((nullptr != m_pEventFileReader) && !m_eventFileName.empty())
+    {
+        if (m_eventStride > 1)
         {
-            m_pEventFileReader->ReadEvent();
+            this->ReadStridedEvent();
         }
-        catch (const StatusCodeException &)
+        else
         {
-            this->MoveToNextEventFile();
+            try
+            {
+                m_pEventFileReader->ReadEvent();
+            }
+            catch (const StatusCodeException &)
+            {
+                this->MoveToNextEventFile();
+            }
         }
 
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RepeatEventPreparation(*this));
@@ -97,22 +156,147 @@ StatusCode EventReadingAlgorithm::Run()
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void EventReadingAlgorithm::MoveToNextEventFile()
+{
+    while (!m_eventFileNameVector.empty())
+    {
+        m_eventFileName = m_eventFileNameVector.back();
+        m_eventFileNameVector.pop_back();
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReplaceEventFileReader(m_eventFileName));
+
+        try
+        {
+            m_pEventFileReader->ReadEvent();
+            return;
+        }
+        catch (const StatusCodeException &)
+        {
+        }
+    }
+
+    throw StopProcessingException("All event files processed");
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::ReadStridedEvent()
+{
+    while (true)
+    {
+        this->GoToNextStridedEvent();
+
+        try
+        {
+            m_pEventFileReader->ReadEvent();
+            break;
+        }
+        catch (const StatusCodeException &)
+        {
+        }
+
+        // ATTN Any event other than the first in a file is reached by a successful move, so only an empty file can fail to read here
+        this->MoveToNextStridedEventFile();
+    }
+
+    // ATTN Reading an event leaves the reader positioned at the following event, which may be absent
+    m_readerEventIndex = m_nextEventIndex + 1;
+    m_isReaderEventPresent = false;
+    m_nextEventIndex += m_eventStride;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::GoToNextStridedEvent()
+{
+    while (m_readerEventIndex < m_nextEventIndex)
+    {
+        if (this->MoveReaderToNextEvent(m_pEventFileReader))
+        {
+            ++m_readerEventIndex;
+            m_isReaderEventPresent = true;
+            continue;
+        }
+
+        // The events skipped in this file are deducted from the offset; the presence of the event at which the reader was positioned is
+        // only unknown if no move has succeeded since the last read, and is then found by a single search with a new reader
+        const bool isReaderEventPresent(m_isReaderEventPresent || this->IsEventPresent(m_eventFileName, m_readerEventIndex));
+        m_nextEventIndex -= (isReaderEventPresent ? m_readerEventIndex + 1 : m_readerEventIndex);
+        this->MoveToNextStridedEventFile();
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::MoveToNextStridedEventFile()
 {
     if (m_eventFileNameVector.empty())
         throw StopProcessingException("All event files processed");
 
     m_eventFileName = m_eventFileNameVector.back();
     m_eventFileNameVector.pop_back();
+    m_readerEventIndex = 0;
+    m_isReaderEventPresent = false;
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReplaceEventFileReader(m_eventFileName));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 
+void EventReadingAlgorithm::ReadInterleavedEvent()
+{
+    // Sharded outputs hold consecutive events in turn, so the first exhausted file marks the end of the merged event sequence
     try
     {
-        m_pEventFileReader->ReadEvent();
+        if (STATUS_CODE_SUCCESS != m_interleavedFileReaders.at(m_interleavedReaderIndex)->ReadEvent())
+            throw StopProcessingException("All interleaved event files processed");
     }
     catch (const StatusCodeException &)
     {
-        this->MoveToNextEventFile();
+        throw StopProcessingException("All interleaved event files processed");
     }
+
+    m_interleavedReaderIndex = (m_interleavedReaderIndex + 1) % m_interleavedFileReaders.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool EventReadingAlgorithm::MoveReaderToEvent(FileReader *const pFileReader, const unsigned int eventIndex) const
+{
+    try
+    {
+        return (STATUS_CODE_SUCCESS == pFileReader->GoToEvent(eventIndex));
+    }
+    catch (const StatusCodeException &)
+    {
+        return false;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool EventReadingAlgorithm::MoveReaderToNextEvent(FileReader *const pFileReader) const
+{
+    try
+    {
+        return (STATUS_CODE_SUCCESS == pFileReader->GoToNextEvent());
+    }
+    catch (const StatusCodeException &)
+    {
+        return false;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool EventReadingAlgorithm::IsEventPresent(const std::string &fileName, const unsigned int eventIndex) const
+{
+    FileReader *const pFileReader(this->CreateEventFileReader(fileName));
+
+    if (!pFileReader)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    const bool isEventPresent(this->MoveReaderToEvent(pFileReader, eventIndex));
+    delete pFileReader;
+
+    return isEventPresent;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -123,28 +307,45 @@ StatusCode EventReadingAlgorithm::ReplaceEventFileReader(const std::string &file
     m_pEventFileReader = nullptr;
 
     std::cout << "EventReadingAlgorithm: Processing event file: " << fileName << std::endl;
+
+    if (m_pEventFilePrefetcher)
+        m_pEventFilePrefetcher->SetCurrentFile(fileName);
+
+    m_pEventFileReader = this->CreateEventFileReader(fileName);
+
+    if (!m_pEventFileReader)
+        return STATUS_CODE_FAILURE;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+FileReader *EventReadingAlgorithm::CreateEventFileReader(const std::string &fileName) const
+{
+    FileReader *pFileReader(nullptr);
     const FileType eventFileType(this->GetFileType(fileName));
 
     if (BINARY == eventFileType)
     {
-        m_pEventFileReader = new BinaryFileReader(this->GetPandora(), fileName);
+        pFileReader = new BinaryFileReader(this->GetPandora(), fileName);
     }
     else if (XML == eventFileType)
     {
-        m_pEventFileReader = new XmlFileReader(this->GetPandora(), fileName);
+        pFileReader = new XmlFileReader(this->GetPandora(), fileName);
     }
     else
     {
-        return STATUS_CODE_FAILURE;
+        return nullptr;
     }
 
     if (m_useLArCaloHits)
-        m_pEventFileReader->SetFactory(new LArCaloHitFactory(m_larCaloHitVersion));
+        pFileReader->SetFactory(new LArCaloHitFactory(m_larCaloHitVersion));
 
     if (m_useLArMCParticles)
-        m_pEventFileReader->SetFactory(new LArMCParticleFactory(m_larMCParticleVersion));
+        pFileReader->SetFactory(new LArMCParticleFactory(m_larMCParticleVersion));
 
-    return STATUS_CODE_SUCCESS;
+    return pFileReader;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -219,6 +420,33 @@ StatusCode EventReadingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
         PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SkipToEvent", m_skipToEvent));
     }
 
+    if (pExternalParameters && pExternalParameters->m_eventStride.IsInitialized())
+    {
+        m_eventStride = pExternalParameters->m_eventStride.Get();
+    }
+    else
+    {
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "EventStride", m_eventStride));
+    }
+
+    if (pExternalParameters && pExternalParameters->m_interleaveEventFiles.IsInitialized())
+    {
+        m_interleaveEventFiles = pExternalParameters->m_interleaveEventFiles.Get();
+    }
+    else
+    {
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+            XmlHelper::ReadValue(xmlHandle, "InterleaveEventFiles", m_interleaveEventFiles));
+    }
+
+    if ((0 == m_eventStride) || (m_interleaveEventFiles && ((m_eventStride > 1) || (m_skipToEvent > 0))))
+    {
+        std::cout << "EventReadingAlgorithm - event stride must be positive, and interleaved event files are read without skip or stride."
+                  << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
     if (m_geometryFileName.empty() && m_eventFileName.empty())
     {
         std::cout << "EventReadingAlgorithm - nothing to do; neither geometry nor event file specified." << std::endl;
@@ -236,6 +464,12 @@ StatusCode EventReadingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseLArMCParticles", m_useLArMCParticles));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "PrefetchEventFiles", m_prefetchEventFiles));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NPrefetchFiles", m_nPrefetchFiles));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -24,8 +24,15 @@ class FileReader;
 namespace lar_content
 {
 
+class EventFilePrefetcher;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  EventReadingAlgorithm class
+ *
+ *          Reading every n-th event lets n pandora instances, each configured with its own skip offset, partition the input events, as
+ *          arranged by the sharded event processing algorithm.
  */
 class EventReadingAlgorithm : public pandora::ExternallyConfiguredAlgorithm
 {
@@ -46,20 +53,84 @@ public:
     class ExternalEventReadingParameters : public pandora::ExternalParameters
     {
     public:
-        std::string m_geometryFileName;   ///< Name of the file containing geometry information
-        std::string m_eventFileNameList;  ///< Colon-separated list of file names to be processed
-        pandora::InputUInt m_skipToEvent; ///< Index of first event to consider in input file
+        std::string m_geometryFileName;            ///< Name of the file containing geometry information
+        std::string m_eventFileNameList;           ///< Colon-separated list of file names to be processed
+        pandora::InputUInt m_skipToEvent;          ///< Index of first event to consider in input file
+        pandora::InputUInt m_eventStride;          ///< Number of events between consecutive events to consider, across all input files
+        pandora::InputBool m_interleaveEventFiles; ///< Whether to read one event from each input file in turn
     };
 
 private:
+    typedef std::vector<pandora::FileReader *> FileReaderVector;
+
     pandora::StatusCode Initialize();
     pandora::StatusCode Run();
 
     /**
-     *  @brief  Proceed to process next event file named in the input list
+     *  @brief  Proceed to process next event file named in the input list, skipping any files from which no event can be read
      */
     void MoveToNextEventFile();
 
+    /**
+     *  @brief  Read the next event to consider when reading every n-th event, proceeding through the event files named in the input
+     *          list as required
+     */
+    void ReadStridedEvent();
+
+    /**
+     *  @brief  Skip the event file reader forward to the next event to consider when reading every n-th event, carrying the remaining
+     *          offset into the following event files as required
+     */
+    void GoToNextStridedEvent();
+
+    /**
+     *  @brief  Proceed to the next event file named in the input list when reading every n-th event
+     */
+    void MoveToNextStridedEventFile();
+
+    /**
+     *  @brief  Read the next event from the interleaved event files, which are read one event from each file in turn
+     */
+    void ReadInterleavedEvent();
+
+    /**
+     *  @brief  Move a file reader to a specified event
+     *
+     *  @param  pFileReader the address of the file reader, which should not be used further if the event is not found
+     *  @param  eventIndex the index of the event in the file
+     *
+     *  @return whether the event was found
+     */
+    bool MoveReaderToEvent(pandora::FileReader *const pFileReader, const unsigned int eventIndex) const;
+
+    /**
+     *  @brief  Move a file reader forward to the next event
+     *
+     *  @param  pFileReader the address of the file reader, which should not be used further if there is no next event
+     *
+     *  @return whether the next event was found
+     */
+    bool MoveReaderToNextEvent(pandora::FileReader *const pFileReader) const;
+
+    /**
+     *  @brief  Whether an event is present in a file
+     *
+     *  @param  fileName the file name
+     *  @param  eventIndex the index of the event in the file
+     *
+     *  @return boolean
+     */
+    bool IsEventPresent(const std::string &fileName, const unsigned int eventIndex) const;
+
+    /**
+     *  @brief  Create a new event file reader for the specified file
+     *
+     *  @param  fileName the file name
+     *
+     *  @return the address of the new file reader, to be deleted by the caller, or nullptr if the file type is not supported
+     */
+    pandora::FileReader *CreateEventFileReader(const std::string &fileName) const;
+
     /**
      *  @brief  Replace the current event file reader with a new reader for the specified file
      *
@@ -83,12 +154,22 @@ private:
     pandora::StringVector m_eventFileNameVector; ///< Vector of file names to be processed
 
     unsigned int m_skipToEvent;          ///< Index of first event to consider in first input file
+    unsigned int m_eventStride;          ///< Number of events between consecutive events to consider, across all input files
+    unsigned int m_nextEventIndex;       ///< Index, in the current file, of the next event to consider when reading every n-th event
+    unsigned int m_readerEventIndex;     ///< Index, in the current file, of the event at which the reader is positioned, if striding
+    bool m_isReaderEventPresent;         ///< Whether the event at which the reader is positioned is known to be present, if striding
+    bool m_interleaveEventFiles;         ///< Whether to read one event from each input file in turn, e.g. to merge sharded outputs
     bool m_useLArCaloHits;               ///< Whether to read lar calo hits, or standard pandora calo hits
     unsigned int m_larCaloHitVersion;    ///< LArCaloHit version for LArCaloHitFactory
     bool m_useLArMCParticles;            ///< Whether to read lar mc particles, or standard pandora mc particles
     unsigned int m_larMCParticleVersion; ///< LArMCParticle version for LArMCParticleFactory
+    bool m_prefetchEventFiles;           ///< Whether to stage upcoming event files in memory on a background thread (not if interleaving)
+    unsigned int m_nPrefetchFiles;       ///< The number of event files beyond the current file to stage
 
-    pandora::FileReader *m_pEventFileReader; ///< Address of the event file reader
+    pandora::FileReader *m_pEventFileReader;     ///< Address of the event file reader
+    EventFilePrefetcher *m_pEventFilePrefetcher; ///< Address of the event file prefetcher, if prefetching
+    FileReaderVector m_interleavedFileReaders;   ///< The event file readers, in input order, if interleaving event files
+    unsigned int m_interleavedReaderIndex;       ///< The index of the interleaved event file reader from which to read the next event
 };
 
 } // namespace lar_content
@@ -38,7 +38,9 @@ EventWritingAlgorithm::EventWritingAlgorithm() :
     m_shouldOverwriteGeometryFile(false),
     m_useLArCaloHits(true),
     m_larCaloHitVersion(1),
+    m_useHalfPrecisionProbabilities(false),
     m_useLArMCParticles(true),
+    m_larMCParticleVersion(2),
     m_shouldFilterByNuanceCode(false),
     m_filterNuanceCode(0),
     m_shouldFilterByMCParticles(false),
@@ -111,10 +113,10 @@ StatusCode EventWritingAlgorithm::Initialize()
         }
 
         if (m_useLArCaloHits)
-            m_pEventFileWriter->SetFactory(new LArCaloHitFactory(m_larCaloHitVersion));
+            m_pEventFileWriter->SetFactory(new LArCaloHitFactory(m_larCaloHitVersion, m_useHalfPrecisionProbabilities));
 
         if (m_useLArMCParticles)
-            m_pEventFileWriter->SetFactory(new LArMCParticleFactory);
+            m_pEventFileWriter->SetFactory(new LArMCParticleFactory(m_larMCParticleVersion));
     }
 
     return STATUS_CODE_SUCCESS;
@@ -288,12 +290,31 @@ StatusCode EventWritingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
         }
     }
 
+    ExternalEventWritingParameters *pExternalParameters(nullptr);
+
+    if (this->ExternalParametersPresent())
+    {
+        pExternalParameters = dynamic_cast<ExternalEventWritingParameters *>(this->GetExternalParameters());
+
+        if (!pExternalParameters)
+            return STATUS_CODE_FAILURE;
+    }
+
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ShouldWriteEvents", m_shouldWriteEvents));
 
-    if (m_shouldWriteEvents)
+    if (pExternalParameters && !pExternalParameters->m_eventFileName.empty())
+    {
+        m_shouldWriteEvents = true;
+        m_eventFileName = pExternalParameters->m_eventFileName;
+    }
+    else if (m_shouldWriteEvents)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "EventFileName", m_eventFileName));
+    }
+
+    if (m_shouldWriteEvents)
+    {
 
         std::string fileExtension(m_eventFileName.substr(m_eventFileName.find_last_of(".")));
         std::transform(fileExtension.begin(), fileExtension.end(), fileExtension.begin(), ::tolower);
@@ -319,8 +340,15 @@ StatusCode EventWritingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "ShouldWriteTrackRelationships", m_shouldWriteTrackRelationships));
 
-    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
-        XmlHelper::ReadValue(xmlHandle, "ShouldOverwriteEventFile", m_shouldOverwriteEventFile));
+    if (pExternalParameters && pExternalParameters->m_shouldOverwriteEventFile.IsInitialized())
+    {
+        m_shouldOverwriteEventFile = pExternalParameters->m_shouldOverwriteEventFile.Get();
+    }
+    else
+    {
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+            XmlHelper::ReadValue(xmlHandle, "ShouldOverwriteEventFile", m_shouldOverwriteEventFile));
+    }
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "ShouldOverwriteGeometryFile", m_shouldOverwriteGeometryFile));
@@ -330,9 +358,15 @@ StatusCode EventWritingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "LArCaloHitVersion", m_larCaloHitVersion));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "UseHalfPrecisionProbabilities", m_useHalfPrecisionProbabilities));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseLArMCParticles", m_useLArMCParticles));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "LArMCParticleVersion", m_larMCParticleVersion));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "ShouldFilterByNuanceCode", m_shouldFilterByNuanceCode));
 
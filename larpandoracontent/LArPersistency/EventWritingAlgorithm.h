@@ -8,7 +8,9 @@
 #ifndef LAR_EVENT_WRITING_ALGORITHM_H
 #define LAR_EVENT_WRITING_ALGORITHM_H 1
 
-#include "Pandora/Algorithm.h"
+#include "Pandora/ExternallyConfiguredAlgorithm.h"
+
+#include "Pandora/PandoraInputTypes.h"
 
 #include "Persistency/PandoraIO.h"
 
@@ -25,7 +27,7 @@ namespace lar_content
 /**
  *  @brief  EventWritingAlgorithm class
  */
-class EventWritingAlgorithm : public pandora::Algorithm
+class EventWritingAlgorithm : public pandora::ExternallyConfiguredAlgorithm
 {
 public:
     /**
@@ -38,6 +40,16 @@ public:
      */
     ~EventWritingAlgorithm();
 
+    /**
+     *  @brief  External event writing parameters class
+     */
+    class ExternalEventWritingParameters : public pandora::ExternalParameters
+    {
+    public:
+        std::string m_eventFileName;                   ///< Name of the output event file, which implies that events should be written
+        pandora::InputBool m_shouldOverwriteEventFile; ///< Whether to overwrite existing event file with specified name, or append
+    };
+
 private:
     pandora::StatusCode Initialize();
     pandora::StatusCode Run();
@@ -84,9 +96,11 @@ private:
     bool m_shouldOverwriteEventFile;    ///< Whether to overwrite existing event file with specified name, or append
     bool m_shouldOverwriteGeometryFile; ///< Whether to overwrite existing geometry file with specified name, or append
 
-    bool m_useLArCaloHits;            ///< Whether to write lar calo hits, or standard pandora calo hits
-    unsigned int m_larCaloHitVersion; ///< LArCaloHit version for LArCaloHitFactory
-    bool m_useLArMCParticles;         ///< Whether to write lar mc particles, or standard pandora mc particles
+    bool m_useLArCaloHits;                ///< Whether to write lar calo hits, or standard pandora calo hits
+    unsigned int m_larCaloHitVersion;     ///< LArCaloHit version for LArCaloHitFactory
+    bool m_useHalfPrecisionProbabilities; ///< Whether LArCaloHit version 3 writes hit probabilities as half precision floats
+    bool m_useLArMCParticles;             ///< Whether to write lar mc particles, or standard pandora mc particles
+    unsigned int m_larMCParticleVersion;  ///< LArMCParticle version for LArMCParticleFactory
 
     bool m_shouldFilterByNuanceCode; ///< Whether to filter output by nuance code
     int m_filterNuanceCode;          ///< The filter nuance code (required if specify filter by nuance code)
@@ -0,0 +1,187 @@
+/**
+ *  @file   larpandoracontent/LArPersistency/LArEventFilePrefetcher.cc
+ *
+ *  @brief  Implementation of the lar event file prefetcher class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArPersistency/LArEventFilePrefetcher.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+EventFilePrefetcher::EventFilePrefetcher(const StringVector &fileNameVector, const unsigned int nFilesAhead) :
+    m_fileNameVector(fileNameVector),
+    m_nFilesAhead(nFilesAhead),
+    m_currentIndex(0),
+    m_isStopRequested(false)
+{
+    m_thread = std::thread(&EventFilePrefetcher::StageFiles, this);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventFilePrefetcher::~EventFilePrefetcher()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopRequested = true;
+    }
+
+    m_condition.notify_one();
+    m_thread.join();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventFilePrefetcher::SetCurrentFile(const std::string &fileName)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const StringVector::const_iterator iter(std::find(m_fileNameVector.begin() + m_currentIndex, m_fileNameVector.end(), fileName));
+
+        if (m_fileNameVector.end() == iter)
+            return;
+
+        m_currentIndex = iter - m_fileNameVector.begin();
+    }
+
+    m_condition.notify_one();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventFilePrefetcher::StageFiles()
+{
+    StagedFileMap stagedFileMap;
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (!m_isStopRequested)
+    {
+        // Release files that processing has moved past; the file readers keep their own handles
+        for (StagedFileMap::iterator iter = stagedFileMap.begin(); iter != stagedFileMap.end();)
+        {
+            if (iter->first >= m_currentIndex)
+                break;
+
+            this->UnmapFile(iter->second);
+            iter = stagedFileMap.erase(iter);
+        }
+
+        const unsigned int endIndex(std::min(static_cast<unsigned int>(m_fileNameVector.size()), m_currentIndex + m_nFilesAhead + 1));
+        bool isWindowStaged(true);
+
+        for (unsigned int index = m_currentIndex; index < endIndex; ++index)
+        {
+            if (stagedFileMap.count(index))
+                continue;
+
+            const std::string &fileName(m_fileNameVector.at(index));
+            lock.unlock();
+
+            StagedFile stagedFile;
+
+            if (this->MapFile(fileName, stagedFile))
+                this->TouchPages(stagedFile);
+
+            lock.lock();
+
+            // ATTN Files that cannot be mapped are recorded too, so that they are not retried; the file reader reports any real problem
+            stagedFileMap.emplace(index, stagedFile);
+            isWindowStaged = false;
+            break;
+        }
+
+        if (isWindowStaged)
+            m_condition.wait(lock);
+    }
+
+    for (const StagedFileMap::value_type &mapEntry : stagedFileMap)
+        this->UnmapFile(mapEntry.second);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool EventFilePrefetcher::MapFile(const std::string &fileName, StagedFile &stagedFile) const
+{
+    const int fileDescriptor(open(fileName.c_str(), O_RDONLY));
+
+    if (fileDescriptor < 0)
+        return false;
+
+    struct stat fileInfo;
+
+    if ((0 != fstat(fileDescriptor, &fileInfo)) || (fileInfo.st_size <= 0))
+    {
+        close(fileDescriptor);
+        return false;
+    }
+
+    const std::size_t size(fileInfo.st_size);
+    void *const pAddress(mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0));
+
+    // The mapping remains valid once the file descriptor is closed
+    close(fileDescriptor);
+
+    if (MAP_FAILED == pAddress)
+    {
+        std::cout << "EventFilePrefetcher: unable to map event file " << fileName << std::endl;
+        return false;
+    }
+
+    posix_madvise(pAddress, size, POSIX_MADV_WILLNEED);
+    stagedFile.m_pAddress = pAddress;
+    stagedFile.m_size = size;
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventFilePrefetcher::TouchPages(const StagedFile &stagedFile) const
+{
+    const long pageSize(sysconf(_SC_PAGESIZE));
+    const std::size_t stride((pageSize > 0) ? pageSize : 4096);
+    const volatile unsigned char *const pBytes(static_cast<const unsigned char *>(stagedFile.m_pAddress));
+    unsigned char checksum(0);
+
+    for (std::size_t offset = 0; offset < stagedFile.m_size; offset += stride)
+    {
+        if (m_isStopRequested)
+            return;
+
+        checksum ^= pBytes[offset];
+    }
+
+    (void)checksum;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventFilePrefetcher::UnmapFile(const StagedFile &stagedFile) const
+{
+    if (stagedFile.m_pAddress)
+        munmap(const_cast<void *>(stagedFile.m_pAddress), stagedFile.m_size);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventFilePrefetcher::StagedFile::StagedFile() :
+    m_pAddress(nullptr),
+    m_size(0)
+{
+}
+
+} // namespace lar_content
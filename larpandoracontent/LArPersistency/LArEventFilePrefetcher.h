@@ -0,0 +1,111 @@
+/**
+ *  @file   larpandoracontent/LArPersistency/LArEventFilePrefetcher.h
+ *
+ *  @brief  Header file for the lar event file prefetcher class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_EVENT_FILE_PREFETCHER_H
+#define LAR_EVENT_FILE_PREFETCHER_H 1
+
+#include "Pandora/PandoraInternal.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  EventFilePrefetcher class, which stages upcoming event files on a background thread, so that the (synchronous) pandora file
+ *          readers find their contents in memory. The current file and a number of files beyond it are memory-mapped and their pages
+ *          are faulted in, in processing order; files are unmapped once processing has moved past them. The prefetcher never touches
+ *          pandora state, so events are still decoded and handed to pandora on demand, by the file reader on the calling thread.
+ */
+class EventFilePrefetcher
+{
+public:
+    /**
+     *  @brief  Constructor, starting the background thread
+     *
+     *  @param  fileNameVector the names of the event files, in processing order
+     *  @param  nFilesAhead the number of files beyond the current file to stage
+     */
+    EventFilePrefetcher(const pandora::StringVector &fileNameVector, const unsigned int nFilesAhead);
+
+    /**
+     *  @brief  Destructor, stopping the background thread and releasing all staged files
+     */
+    ~EventFilePrefetcher();
+
+    /**
+     *  @brief  Set the file currently being processed, moving the staging window forwards
+     *
+     *  @param  fileName the file name, which should be at or beyond the current position in the list of event files
+     */
+    void SetCurrentFile(const std::string &fileName);
+
+private:
+    /**
+     *  @brief  StagedFile class
+     */
+    class StagedFile
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        StagedFile();
+
+        const void *m_pAddress; ///< The address of the file mapping, nullptr if the file could not be mapped
+        std::size_t m_size;     ///< The size of the file mapping
+    };
+
+    typedef std::map<unsigned int, StagedFile> StagedFileMap;
+
+    /**
+     *  @brief  Stage files within the window following the current file until asked to stop, run on the background thread
+     */
+    void StageFiles();
+
+    /**
+     *  @brief  Memory-map a file and advise the kernel that its contents will be needed
+     *
+     *  @param  fileName the file name
+     *  @param  stagedFile to receive the file mapping
+     *
+     *  @return whether the file could be mapped
+     */
+    bool MapFile(const std::string &fileName, StagedFile &stagedFile) const;
+
+    /**
+     *  @brief  Read a byte from each page of a mapped file, so that the file contents are resident, returning early if asked to stop
+     *
+     *  @param  stagedFile the file mapping
+     */
+    void TouchPages(const StagedFile &stagedFile) const;
+
+    /**
+     *  @brief  Unmap a file
+     *
+     *  @param  stagedFile the file mapping
+     */
+    void UnmapFile(const StagedFile &stagedFile) const;
+
+    const pandora::StringVector m_fileNameVector; ///< The names of the event files, in processing order
+    const unsigned int m_nFilesAhead;             ///< The number of files beyond the current file to stage
+    unsigned int m_currentIndex;                  ///< The index of the file currently being processed
+    std::atomic<bool> m_isStopRequested;          ///< Whether the background thread has been asked to stop
+    std::mutex m_mutex;                           ///< The mutex protecting the current index
+    std::condition_variable m_condition;          ///< The condition signalling a change to the current index, or a stop request
+    std::thread m_thread;                         ///< The background thread
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_EVENT_FILE_PREFETCHER_H
@@ -14,6 +14,8 @@
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
+#include "larpandoracontent/LArObjects/LArTwoDHitGrid.h"
+
 #include "larpandoracontent/LArShowerRefinement/ConnectionPathwayFeatureTool.h"
 #include "larpandoracontent/LArShowerRefinement/LArProtoShower.h"
 
@@ -1039,14 +1041,29 @@ bool AmbiguousRegionFeatureTool::GetViewAmbiguousHitVariables(const Algorithm *c
 void AmbiguousRegionFeatureTool::BuildAmbiguousSpines(const Algorithm *const pAlgorithm, const HitType hitType, const ProtoShower &protoShower,
     const CartesianVector &nuVertex2D, std::map<int, CaloHitList> &ambiguousHitSpines, CaloHitList &hitsToExcludeInEnergyCalcs)
 {
-    const CaloHitList *pCaloHitList;
+    // Where the calling algorithm has indexed the configured event hit list, only hits close to the ambiguous directions need be considered
+    const TwoDHitGridProvider *const pHitGridProvider(dynamic_cast<const TwoDHitGridProvider *>(pAlgorithm));
+    const TwoDHitGrid *const pViewHitGrid(pHitGridProvider ? pHitGridProvider->GetHitGrid(this->GetHitListName(hitType)) : nullptr);
 
-    if (this->GetHitListOfType(pAlgorithm, hitType, pCaloHitList) != STATUS_CODE_SUCCESS)
-        return;
+    CaloHitList candidateHitList;
+
+    if (pViewHitGrid)
+    {
+        pViewHitGrid->FindHitsInRays(nuVertex2D, protoShower.GetAmbiguousDirectionVector(), m_maxTransverseDistance, candidateHitList);
+    }
+    else
+    {
+        const CaloHitList *pCaloHitList;
+
+        if (this->GetHitListOfType(pAlgorithm, hitType, pCaloHitList) != STATUS_CODE_SUCCESS)
+            return;
+
+        candidateHitList = *pCaloHitList;
+    }
 
     std::map<int, CaloHitList> ambiguousHitSpinesTemp;
 
-    for (const CaloHit *const pCaloHit : *pCaloHitList)
+    for (const CaloHit *const pCaloHit : candidateHitList)
     {
         if (std::find(protoShower.GetAmbiguousHitList().begin(), protoShower.GetAmbiguousHitList().end(), pCaloHit) !=
             protoShower.GetAmbiguousHitList().end())
@@ -1088,9 +1105,16 @@ void AmbiguousRegionFeatureTool::BuildAmbiguousSpines(const Algorithm *const pAl
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+const std::string &AmbiguousRegionFeatureTool::GetHitListName(const HitType hitType) const
+{
+    return (hitType == TPC_VIEW_U ? m_caloHitListNameU : hitType == TPC_VIEW_V ? m_caloHitListNameV : m_caloHitListNameW);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode AmbiguousRegionFeatureTool::GetHitListOfType(const Algorithm *const pAlgorithm, const HitType hitType, const CaloHitList *&pCaloHitList) const
 {
-    const std::string typeHitListName(hitType == TPC_VIEW_U ? m_caloHitListNameU : hitType == TPC_VIEW_V ? m_caloHitListNameV : m_caloHitListNameW);
+    const std::string &typeHitListName(this->GetHitListName(hitType));
 
     PANDORA_THROW_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=, PandoraContentApi::GetList(*pAlgorithm, typeHitListName, pCaloHitList));
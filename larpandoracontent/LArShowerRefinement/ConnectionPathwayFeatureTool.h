@@ -320,6 +320,15 @@ private:
         const pandora::CartesianVector &nuVertex2D, std::map<int, pandora::CaloHitList> &ambiguousHitSpines,
         pandora::CaloHitList &hitsToExcludeInEnergyCalcs);
 
+    /**
+     *  @brief  Get the configured name of the event hit list of a given view
+     *
+     *  @param  hitType the 2D view
+     *
+     *  @return the hit list name
+     */
+    const std::string &GetHitListName(const pandora::HitType hitType) const;
+
     /**
      *  @brief  Obtain the event hit list of a given view
      *
@@ -15,6 +15,7 @@
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 #include "larpandoracontent/LArShowerRefinement/ElectronInitialRegionRefinementAlgorithm.h"
@@ -36,6 +37,7 @@ ElectronInitialRegionRefinementAlgorithm::ElectronInitialRegionRefinementAlgorit
     m_minSpinePurity(0.7f),
     m_trainingMode(false),
     m_trainingFileName("ConnectionPathwayTrain.txt"),
+    m_trainingOutputFormat("csv"),
     m_unambiguousThreshold(0.5f),
     m_maxConnectionDistance(1.f),
     m_minNConnectedHits(2),
@@ -43,32 +45,88 @@ ElectronInitialRegionRefinementAlgorithm::ElectronInitialRegionRefinementAlgorit
     m_minElectronPurity(0.5f),
     m_maxSeparationFromHit(3.f),
     m_maxProjectionSeparation(5.f),
-    m_maxXSeparation(0.5f)
+    m_maxXSeparation(0.5f),
+    m_nThreads(1),
+    m_hitGridCellSize(2.f),
+    m_hitGridSearchTolerance(0.01f)
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+const TwoDHitGrid *ElectronInitialRegionRefinementAlgorithm::GetViewHitGrid(const HitType hitType) const
+{
+    const ViewHitGridMap::const_iterator iter(m_viewHitGridMap.find(hitType));
+
+    return (iter == m_viewHitGridMap.end()) ? nullptr : &iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const TwoDHitGrid *ElectronInitialRegionRefinementAlgorithm::GetHitGrid(const std::string &caloHitListName) const
+{
+    if (caloHitListName == m_caloHitListNameU)
+        return this->GetViewHitGrid(TPC_VIEW_U);
+
+    if (caloHitListName == m_caloHitListNameV)
+        return this->GetViewHitGrid(TPC_VIEW_V);
+
+    if (caloHitListName == m_caloHitListNameW)
+        return this->GetViewHitGrid(TPC_VIEW_W);
+
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ElectronInitialRegionRefinementAlgorithm::Run()
 {
+    m_viewHitGridMap.clear();
+
     PfoVector showerPfoVector;
     this->FillShowerPfoVector(showerPfoVector);
 
-    if (showerPfoVector.empty())
-        return STATUS_CODE_SUCCESS;
+    // Only consider significant showers
+    PfoVector significantShowerPfoVector;
 
     for (const ParticleFlowObject *const pShowerPfo : showerPfoVector)
     {
-        // Only consider significant showers
         CaloHitList caloHits3D;
         LArPfoHelper::GetCaloHits(pShowerPfo, TPC_3D, caloHits3D);
 
         if (caloHits3D.size() < m_minShowerHits3D)
             continue;
 
-        this->RefineShower(pShowerPfo);
+        significantShowerPfoVector.push_back(pShowerPfo);
     }
 
+    if (significantShowerPfoVector.empty())
+        return STATUS_CODE_SUCCESS;
+
+    CartesianVector nuVertex3D(0.f, 0.f, 0.f);
+
+    if (this->GetNeutrinoVertex(nuVertex3D) != STATUS_CODE_SUCCESS)
+        return STATUS_CODE_SUCCESS;
+
+    // Index the event hits once, then evaluate the showers, concurrently if configured to do so, and record the outcomes serially in the original order
+    this->FillViewHitGridMap();
+
+    std::vector<PathwayFeaturesVector> showerPathwayFeatures(significantShowerPfoVector.size());
+
+    LArParallelHelper::ParallelFor(significantShowerPfoVector.size(), m_nThreads, [&](const unsigned int index) {
+        this->EvaluateShower(significantShowerPfoVector.at(index), nuVertex3D, showerPathwayFeatures.at(index));
+    });
+
+    HitOwnershipMap electronHitMap;
+
+    if (m_trainingMode)
+        this->FillElectronHitMap(electronHitMap);
+
+    for (unsigned int index = 0; index < significantShowerPfoVector.size(); ++index)
+        this->ApplyShowerRefinement(significantShowerPfoVector.at(index), showerPathwayFeatures.at(index), electronHitMap);
+
+    m_viewHitGridMap.clear();
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -94,13 +152,9 @@ void ElectronInitialRegionRefinementAlgorithm::FillShowerPfoVector(PfoVector &sh
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ElectronInitialRegionRefinementAlgorithm::RefineShower(const ParticleFlowObject *const pShowerPfo) const
+void ElectronInitialRegionRefinementAlgorithm::EvaluateShower(
+    const ParticleFlowObject *const pShowerPfo, const CartesianVector &nuVertex3D, PathwayFeaturesVector &pathwayFeaturesVector) const
 {
-    CartesianVector nuVertex3D(0.f, 0.f, 0.f);
-
-    if (this->GetNeutrinoVertex(nuVertex3D) != STATUS_CODE_SUCCESS)
-        return;
-
     // Create the 2D connetion pathways
     ProtoShowerVector protoShowerVectorU, protoShowerVectorV, protoShowerVectorW;
 
@@ -137,25 +191,33 @@ void ElectronInitialRegionRefinementAlgorithm::RefineShower(const ParticleFlowOb
         }
 
         // Fill BDT information
-        StringVector featureOrder;
-        const LArMvaHelper::MvaFeatureMap featureMap(LArMvaHelper::CalculateFeatures(
-            m_algorithmToolNames, m_featureToolMap, featureOrder, this, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D));
+        PathwayFeatures pathwayFeatures;
+        pathwayFeatures.m_featureMap = LArMvaHelper::CalculateFeatures(m_algorithmToolNames, m_featureToolMap, pathwayFeatures.m_featureOrder,
+            this, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D);
 
-        this->SetMetadata(pShowerPfo, featureMap);
+        pathwayFeaturesVector.push_back(pathwayFeatures);
 
+        // Only the first characterised pathway is used for training
         if (m_trainingMode)
-        {
-            // To truth match electrons
-            HitOwnershipMap electronHitMap;
-            this->FillElectronHitMap(electronHitMap);
+            break;
+    }
+}
 
-            if (this->IsElectron(pShowerPfo, electronHitMap))
-            {
-                LArMvaHelper::ProduceTrainingExample(m_trainingFileName, true, featureOrder, featureMap);
-                break;
-            }
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-            LArMvaHelper::ProduceTrainingExample(m_trainingFileName, false, featureOrder, featureMap);
+void ElectronInitialRegionRefinementAlgorithm::ApplyShowerRefinement(
+    const ParticleFlowObject *const pShowerPfo, const PathwayFeaturesVector &pathwayFeaturesVector, const HitOwnershipMap &electronHitMap) const
+{
+    for (const PathwayFeatures &pathwayFeatures : pathwayFeaturesVector)
+    {
+        this->SetMetadata(pShowerPfo, pathwayFeatures.m_featureMap);
+
+        if (m_trainingMode)
+        {
+            // To truth match electrons
+            const bool isElectron(this->IsElectron(pShowerPfo, electronHitMap));
+            LArMvaHelper::ProduceTrainingExample(
+                m_trainingSink, m_trainingFileName, isElectron, pathwayFeatures.m_featureOrder, pathwayFeatures.m_featureMap);
 
             break;
         }
@@ -164,6 +226,21 @@ void ElectronInitialRegionRefinementAlgorithm::RefineShower(const ParticleFlowOb
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ElectronInitialRegionRefinementAlgorithm::FillViewHitGridMap()
+{
+    for (const HitType hitType : {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W})
+    {
+        const CaloHitList *pViewHitList(nullptr);
+
+        if (this->GetHitListOfType(hitType, pViewHitList) != STATUS_CODE_SUCCESS)
+            continue;
+
+        m_viewHitGridMap.emplace(hitType, TwoDHitGrid(pViewHitList, m_hitGridCellSize, m_hitGridSearchTolerance));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ElectronInitialRegionRefinementAlgorithm::GetNeutrinoVertex(CartesianVector &nuVertex3D) const
 {
     const VertexList *pNuVertexList(nullptr);
@@ -191,9 +268,9 @@ StatusCode ElectronInitialRegionRefinementAlgorithm::GetNeutrinoVertex(Cartesian
 void ElectronInitialRegionRefinementAlgorithm::BuildViewProtoShowers(const ParticleFlowObject *const pShowerPfo,
     const CartesianVector &nuVertex3D, HitType hitType, ProtoShowerVector &protoShowerVector) const
 {
-    const CaloHitList *pViewHitList(nullptr);
+    const TwoDHitGrid *const pViewHitGrid(this->GetViewHitGrid(hitType));
 
-    if (this->GetHitListOfType(hitType, pViewHitList) != STATUS_CODE_SUCCESS)
+    if (!pViewHitGrid)
         return;
 
     CartesianVector showerVertexPosition(0.f, 0.f, 0.f);
@@ -208,7 +285,7 @@ void ElectronInitialRegionRefinementAlgorithm::BuildViewProtoShowers(const Parti
 
     // Determine directions of pathways out of neutrino vertex
     CartesianPointVector peakDirectionVector;
-    if (m_pShowerPeakDirectionFinderTool->Run(pShowerPfo, nuVertex3D, pViewHitList, hitType, peakDirectionVector) != STATUS_CODE_SUCCESS)
+    if (m_pShowerPeakDirectionFinderTool->Run(pShowerPfo, nuVertex3D, *pViewHitGrid, hitType, peakDirectionVector) != STATUS_CODE_SUCCESS)
         return;
 
     // Investigate each direction
@@ -217,7 +294,7 @@ void ElectronInitialRegionRefinementAlgorithm::BuildViewProtoShowers(const Parti
     {
         // Collect the hits associated with the pathway (the shower spine)
         CaloHitList showerSpineHitList;
-        if (m_pShowerSpineFinderTool->Run(nuVertex3D, pViewHitList, hitType, peakDirection, unavailableHitList, showerSpineHitList) != STATUS_CODE_SUCCESS)
+        if (m_pShowerSpineFinderTool->Run(nuVertex3D, *pViewHitGrid, hitType, peakDirection, unavailableHitList, showerSpineHitList) != STATUS_CODE_SUCCESS)
             continue;
 
         this->RefineShowerVertex(pShowerPfo, hitType, nuVertex3D, peakDirection, showerVertexPosition);
@@ -402,14 +479,14 @@ bool ElectronInitialRegionRefinementAlgorithm::IsSpineCoincident(const ParticleF
 void ElectronInitialRegionRefinementAlgorithm::BuildViewPathways(const ParticleFlowObject *const pShowerPfo,
     const CaloHitList &protectedHits, const CartesianVector &nuVertex3D, HitType hitType, ConnectionPathwayVector &viewPathways) const
 {
-    const CaloHitList *pViewHitList(nullptr);
+    const TwoDHitGrid *const pViewHitGrid(this->GetViewHitGrid(hitType));
 
-    if (this->GetHitListOfType(hitType, pViewHitList) != STATUS_CODE_SUCCESS)
+    if (!pViewHitGrid)
         return;
 
     // Get the peak direction vector
     CartesianPointVector eventPeakDirectionVector;
-    m_pEventPeakDirectionFinderTool->Run(pShowerPfo, nuVertex3D, pViewHitList, hitType, eventPeakDirectionVector);
+    m_pEventPeakDirectionFinderTool->Run(pShowerPfo, nuVertex3D, *pViewHitGrid, hitType, eventPeakDirectionVector);
 
     CaloHitList unavailableHitList(protectedHits);
     LArPfoHelper::GetCaloHits(pShowerPfo, hitType, unavailableHitList);
@@ -417,7 +494,7 @@ void ElectronInitialRegionRefinementAlgorithm::BuildViewPathways(const ParticleF
     for (CartesianVector &eventPeakDirection : eventPeakDirectionVector)
     {
         CaloHitList pathwayHitList;
-        if (m_pEventPathwayFinderTool->Run(nuVertex3D, pViewHitList, hitType, eventPeakDirection, unavailableHitList, pathwayHitList) != STATUS_CODE_SUCCESS)
+        if (m_pEventPathwayFinderTool->Run(nuVertex3D, *pViewHitGrid, hitType, eventPeakDirection, unavailableHitList, pathwayHitList) != STATUS_CODE_SUCCESS)
             continue;
 
         const CartesianVector nuVertex2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), nuVertex3D, hitType));
@@ -734,6 +811,10 @@ StatusCode ElectronInitialRegionRefinementAlgorithm::ReadSettings(const TiXmlHan
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TrainingFileName", m_trainingFileName));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFormat", m_trainingOutputFormat));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_trainingSink.SetFormat(m_trainingOutputFormat));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UnambiguousThreshold", m_unambiguousThreshold));
 
@@ -757,6 +838,27 @@ StatusCode ElectronInitialRegionRefinementAlgorithm::ReadSettings(const TiXmlHan
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxXSeparation", m_maxXSeparation));
 
+    // ATTN Zero threads requests one per hardware thread
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NThreads", m_nThreads));
+    m_nThreads = LArParallelHelper::GetNThreads(m_nThreads);
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "HitGridCellSize", m_hitGridCellSize));
+
+    if (m_hitGridCellSize < std::numeric_limits<float>::epsilon())
+    {
+        std::cout << "ElectronInitialRegionRefinementAlgorithm: HitGridCellSize must be positive" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "HitGridSearchTolerance", m_hitGridSearchTolerance));
+
+    if (m_hitGridSearchTolerance < 0.f)
+    {
+        std::cout << "ElectronInitialRegionRefinementAlgorithm: HitGridSearchTolerance must not be negative" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
     AlgorithmToolVector algorithmToolVector;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ProcessAlgorithmToolList(*this, xmlHandle, "FeatureTools", algorithmToolVector));
 
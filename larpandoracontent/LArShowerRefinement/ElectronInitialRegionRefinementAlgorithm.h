@@ -10,6 +10,9 @@
 
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArObjects/LArMvaTrainingSink.h"
+#include "larpandoracontent/LArObjects/LArTwoDHitGrid.h"
+
 #include "larpandoracontent/LArShowerRefinement/ConnectionPathwayFeatureTool.h"
 #include "larpandoracontent/LArShowerRefinement/LArProtoShower.h"
 #include "larpandoracontent/LArShowerRefinement/PeakDirectionFinderTool.h"
@@ -23,7 +26,7 @@ namespace lar_content
 /**
  *  @brief  ElectronInitialRegionRefinementAlgorithm class
  */
-class ElectronInitialRegionRefinementAlgorithm : public pandora::Algorithm
+class ElectronInitialRegionRefinementAlgorithm : public pandora::Algorithm, public TwoDHitGridProvider
 {
 public:
     /**
@@ -31,8 +34,39 @@ public:
      */
     ElectronInitialRegionRefinementAlgorithm();
 
+    /**
+     *  @brief  Get the spatial index of the event hits of a given view, only available while the algorithm is running
+     *
+     *  @param  hitType the 2D view
+     *
+     *  @return address of the view hit grid, nullptr if there is no valid hit list for the view
+     */
+    const TwoDHitGrid *GetViewHitGrid(const pandora::HitType hitType) const;
+
+    /**
+     *  @brief  Get the spatial index of a named event hit list, only available while the algorithm is running
+     *
+     *  @param  caloHitListName the name of the hit list
+     *
+     *  @return address of the hit grid, nullptr if the named list is not one of the view hit lists indexed by the algorithm
+     */
+    const TwoDHitGrid *GetHitGrid(const std::string &caloHitListName) const;
+
 private:
     typedef std::map<const pandora::MCParticle *, pandora::CaloHitList> HitOwnershipMap;
+    typedef std::map<pandora::HitType, TwoDHitGrid> ViewHitGridMap;
+
+    /**
+     *  @brief  PathwayFeatures class, holding the characterisation of a matched shower connection pathway
+     */
+    class PathwayFeatures
+    {
+    public:
+        pandora::StringVector m_featureOrder;     ///< The order of the features
+        LArMvaHelper::MvaFeatureMap m_featureMap; ///< The map of [characterisation variable -> value]
+    };
+
+    typedef std::vector<PathwayFeatures> PathwayFeaturesVector;
 
     pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -45,11 +79,29 @@ private:
     void FillShowerPfoVector(pandora::PfoVector &showerPfoVector) const;
 
     /**
-     *  @brief  Find and evaluate shower connection pathway, removing if necessary
+     *  @brief  Find and evaluate the shower connection pathways. This only reads the event, so may be run concurrently for many showers
+     *
+     *  @param  pShowerPfo the input shower pfo
+     *  @param  nuVertex3D the 3D neutrino vertex
+     *  @param  pathwayFeaturesVector the output characterisation of each matched connection pathway with a 3D shower start
+     */
+    void EvaluateShower(const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
+        PathwayFeaturesVector &pathwayFeaturesVector) const;
+
+    /**
+     *  @brief  Record the outcome of the shower connection pathway evaluation in the shower pfo metadata (and in the training file)
      *
      *  @param  pShowerPfo the input shower pfo
+     *  @param  pathwayFeaturesVector the characterisation of each matched connection pathway
+     *  @param  electronHitMap the mapping of [MCParticle leading electrons -> their associated hits], only used in training mode
+     */
+    void ApplyShowerRefinement(const pandora::ParticleFlowObject *const pShowerPfo, const PathwayFeaturesVector &pathwayFeaturesVector,
+        const HitOwnershipMap &electronHitMap) const;
+
+    /**
+     *  @brief  Build the spatial index of the event hits of each view, shared by all of the shower evaluations
      */
-    void RefineShower(const pandora::ParticleFlowObject *const pShowerPfo) const;
+    void FillViewHitGridMap();
 
     /**
      *  @brief  Obtain the reconstructed neutrino vertex
@@ -204,6 +256,8 @@ private:
     float m_minSpinePurity;                     ///< The min. purity of a coincident shower spine downstream of the shower vertex
     bool m_trainingMode;                        ///< Whether to run the algorithm to train the BDT
     std::string m_trainingFileName;             ///< The name of the output training file name
+    std::string m_trainingOutputFormat;         ///< The format of the output training file, csv or binary
+    mutable MvaTrainingSink m_trainingSink;     ///< The sink buffering the training examples
     float m_unambiguousThreshold;     ///< The min. transverse distance of an unambiguous shower hit from another pathway direction
     float m_maxConnectionDistance;    ///< The max. distance between connected hits
     unsigned int m_minNConnectedHits; ///< The number of connected hits needed for a conntected pathway
@@ -212,6 +266,10 @@ private:
     float m_maxSeparationFromHit;     ///< The max. separation between the projected 3D shower start and the closest 2D shower hit
     float m_maxProjectionSeparation;  ///< The max. separation between the projected 3D shower start and the shower start of that view
     float m_maxXSeparation;           ///< The max. drift-coordinate separation between a 3D shower start and a matched 2D shower hit
+    unsigned int m_nThreads;          ///< The number of threads used to evaluate the showers concurrently
+    float m_hitGridCellSize;          ///< The cell size of the view hit grids
+    float m_hitGridSearchTolerance;   ///< The distance by which the view hit grid search regions are widened, to protect their boundaries
+    ViewHitGridMap m_viewHitGridMap;  ///< The map of [view -> event hit grid], filled for the duration of each run
     ConnectionPathwayFeatureTool::FeatureToolMap m_featureToolMap; ///< The feature tool map
     pandora::StringVector m_algorithmToolNames;                    ///< The algorithm tool names
 };
@@ -30,7 +30,7 @@ PeakDirectionFinderTool::PeakDirectionFinderTool() :
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode PeakDirectionFinderTool::Run(const ParticleFlowObject *const pShowerPfo, const CartesianVector &nuVertex3D,
-    const CaloHitList *const pViewHitList, const HitType hitType, CartesianPointVector &peakDirectionVector)
+    const TwoDHitGrid &viewHitGrid, const HitType hitType, CartesianPointVector &peakDirectionVector)
 {
     CaloHitList viewShowerHitList;
     LArPfoHelper::GetCaloHits(pShowerPfo, hitType, viewShowerHitList);
@@ -39,7 +39,7 @@ StatusCode PeakDirectionFinderTool::Run(const ParticleFlowObject *const pShowerP
 
     // Get event hits in region of interest
     CaloHitList viewROIHits;
-    this->CollectHitsWithinROI(viewShowerHitList, pViewHitList, nuVertex2D, viewROIHits);
+    this->CollectHitsWithinROI(viewShowerHitList, viewHitGrid, nuVertex2D, viewROIHits);
 
     if (viewROIHits.empty())
         return STATUS_CODE_NOT_FOUND;
@@ -65,12 +65,16 @@ StatusCode PeakDirectionFinderTool::Run(const ParticleFlowObject *const pShowerP
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void PeakDirectionFinderTool::CollectHitsWithinROI(const CaloHitList &showerHitList, const CaloHitList *const pViewHitList,
+void PeakDirectionFinderTool::CollectHitsWithinROI(const CaloHitList &showerHitList, const TwoDHitGrid &viewHitGrid,
     const CartesianVector &nuVertex2D, CaloHitList &viewROIHits) const
 {
+    // ATTN Only hits within the pathway search region contribute to the angular decomposition (grid tolerance protects the boundary)
+    CaloHitList searchRegionHitList;
+    viewHitGrid.FindHitsInRadius(nuVertex2D, m_pathwaySearchRegion, searchRegionHitList);
+
     if (m_ambiguousParticleMode)
     {
-        for (const CaloHit *const pCaloHit : *pViewHitList)
+        for (const CaloHit *const pCaloHit : searchRegionHitList)
         {
             if (std::find(showerHitList.begin(), showerHitList.end(), pCaloHit) != showerHitList.end())
                 continue;
@@ -83,7 +87,7 @@ void PeakDirectionFinderTool::CollectHitsWithinROI(const CaloHitList &showerHitL
         float lowestTheta(std::numeric_limits<float>::max()), highestTheta((-1.f) * std::numeric_limits<float>::max());
 
         this->GetAngularExtrema(showerHitList, nuVertex2D, lowestTheta, highestTheta);
-        this->CollectHitsWithinExtrema(pViewHitList, nuVertex2D, lowestTheta, highestTheta, viewROIHits);
+        this->CollectHitsWithinExtrema(&searchRegionHitList, nuVertex2D, lowestTheta, highestTheta, viewROIHits);
     }
 }
 
@@ -11,6 +11,8 @@
 #include "Pandora/AlgorithmHeaders.h"
 #include "Pandora/AlgorithmTool.h"
 
+#include "larpandoracontent/LArObjects/LArTwoDHitGrid.h"
+
 namespace lar_content
 {
 
@@ -23,7 +25,7 @@ public:
     PeakDirectionFinderTool();
 
     pandora::StatusCode Run(const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const pandora::CaloHitList *const pViewHitList, const pandora::HitType hitType, pandora::CartesianPointVector &peakDirectionVector);
+        const TwoDHitGrid &viewHitGrid, const pandora::HitType hitType, pandora::CartesianPointVector &peakDirectionVector);
 
 private:
     typedef std::map<int, float> AngularDecompositionMap;
@@ -35,11 +37,11 @@ private:
      *          (m_ambiguousParticleMode ? hits not in the shower : hits within the initial shower cone [originating from the nu vertex])
      *
      *  @param  showerHitList the 2D shower hit list
-     *  @param  pViewHitList the event 2D hits list
+     *  @param  viewHitGrid the spatial index of the event 2D hits
      *  @param  nuVertex2D the 2D neutrino vertex
      *  @param  viewROIHits the region of interest 2D hit list
      */
-    void CollectHitsWithinROI(const pandora::CaloHitList &showerHitList, const pandora::CaloHitList *const pViewHitList,
+    void CollectHitsWithinROI(const pandora::CaloHitList &showerHitList, const TwoDHitGrid &viewHitGrid,
         const pandora::CartesianVector &nuVertex2D, pandora::CaloHitList &viewROIHits) const;
 
     /**
@@ -56,7 +58,7 @@ private:
     /**
      *  @brief  Collect the hits that lie within the initial shower cone (originating from the nu vertex)
      *
-     *  @param  pViewHitList the event 2D hits list
+     *  @param  pViewHitList the candidate 2D hit list
      *  @param  nuVertex2D the 2D neutrino vertex
      *  @param  lowestTheta the lower angle (from the +ve drift-axis) boundary
      *  @param  highestTheta the higher angle (from the +ve drift-axis) boundary
@@ -38,12 +38,12 @@ ShowerSpineFinderTool::ShowerSpineFinderTool() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode ShowerSpineFinderTool::Run(const CartesianVector &nuVertex3D, const CaloHitList *const pViewHitList, const HitType hitType,
+StatusCode ShowerSpineFinderTool::Run(const CartesianVector &nuVertex3D, const TwoDHitGrid &viewHitGrid, const HitType hitType,
     const CartesianVector &peakDirection, CaloHitList &unavailableHitList, CaloHitList &showerSpineHitList)
 {
     const CartesianVector nuVertex2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), nuVertex3D, hitType));
 
-    this->FindShowerSpine(pViewHitList, nuVertex2D, peakDirection, unavailableHitList, showerSpineHitList);
+    this->FindShowerSpine(viewHitGrid, nuVertex2D, peakDirection, unavailableHitList, showerSpineHitList);
 
     // Demand that spine is significant, be lenient here as some have small stubs and a gap
     if (showerSpineHitList.size() < m_hitThresholdForSpine)
@@ -54,14 +54,19 @@ StatusCode ShowerSpineFinderTool::Run(const CartesianVector &nuVertex3D, const C
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ShowerSpineFinderTool::FindShowerSpine(const CaloHitList *const pViewHitList, const CartesianVector &nuVertex2D,
+void ShowerSpineFinderTool::FindShowerSpine(const TwoDHitGrid &viewHitGrid, const CartesianVector &nuVertex2D,
     const CartesianVector &initialDirection, CaloHitList &unavailableHitList, CaloHitList &showerSpineHitList) const
 {
-    // Use initial direction to find seed hits for a starting fit
+    // Use initial direction to find seed hits for a starting fit, which must lie within the initial fit region around the vertex
+    const float seedRegionRadius(std::sqrt(m_growingFitInitialLength * m_growingFitInitialLength + m_initialFitDistanceToLine * m_initialFitDistanceToLine));
+
+    CaloHitList seedRegionHitList;
+    viewHitGrid.FindHitsInRadius(nuVertex2D, seedRegionRadius, seedRegionHitList);
+
     float highestL(0.f);
     CartesianPointVector runningFitPositionVector;
 
-    for (const CaloHit *const pCaloHit : *pViewHitList)
+    for (const CaloHit *const pCaloHit : seedRegionHitList)
     {
         const CartesianVector &hitPosition(pCaloHit->GetPositionVector());
         const CartesianVector &displacementVector(hitPosition - nuVertex2D);
@@ -125,7 +130,7 @@ void ShowerSpineFinderTool::FindShowerSpine(const CaloHitList *const pViewHitLis
             extrapolatedEndPosition = extrapolatedStartPosition + (extrapolatedDirection * m_growingFitSegmentLength);
 
             hitsCollected = this->CollectSubsectionHits(extrapolatedFit, extrapolatedStartPosition, extrapolatedEndPosition,
-                extrapolatedDirection, isEndDownstream, pViewHitList, runningFitPositionVector, unavailableHitList, showerSpineHitList);
+                extrapolatedDirection, isEndDownstream, viewHitGrid, runningFitPositionVector, unavailableHitList, showerSpineHitList);
 
             // If no hits found, as a final effort, reduce the sliding fit window
             if (!hitsCollected)
@@ -140,7 +145,7 @@ void ShowerSpineFinderTool::FindShowerSpine(const CaloHitList *const pViewHitLis
                 extrapolatedEndPosition = extrapolatedStartPosition + (extrapolatedDirection * m_growingFitSegmentLength);
 
                 hitsCollected = this->CollectSubsectionHits(microExtrapolatedFit, extrapolatedStartPosition, extrapolatedEndPosition,
-                    extrapolatedDirection, isEndDownstream, pViewHitList, runningFitPositionVector, unavailableHitList, showerSpineHitList);
+                    extrapolatedDirection, isEndDownstream, viewHitGrid, runningFitPositionVector, unavailableHitList, showerSpineHitList);
             }
         }
         catch (const StatusCodeException &)
@@ -154,7 +159,7 @@ void ShowerSpineFinderTool::FindShowerSpine(const CaloHitList *const pViewHitLis
 
 bool ShowerSpineFinderTool::CollectSubsectionHits(const TwoDSlidingFitResult &extrapolatedFit,
     const CartesianVector &extrapolatedStartPosition, const CartesianVector &extrapolatedEndPosition,
-    const CartesianVector &extrapolatedDirection, const bool isEndDownstream, const CaloHitList *const pViewHitList,
+    const CartesianVector &extrapolatedDirection, const bool isEndDownstream, const TwoDHitGrid &viewHitGrid,
     CartesianPointVector &runningFitPositionVector, CaloHitList &unavailableHitList, CaloHitList &showerSpineHitList) const
 {
     float extrapolatedStartL(0.f), extrapolatedStartT(0.f);
@@ -163,9 +168,29 @@ bool ShowerSpineFinderTool::CollectSubsectionHits(const TwoDSlidingFitResult &ex
     float extrapolatedEndL(0.f), extrapolatedEndT(0.f);
     extrapolatedFit.GetLocalPosition(extrapolatedEndPosition, extrapolatedEndL, extrapolatedEndT);
 
+    // Only hits whose centres lie close to the projection line (allowing for the hit width) within the section boundaries can be collected
+    const float maxDistanceToLine(m_distanceToLine + 0.5f * viewHitGrid.GetMaxHitWidth());
+    const float cosAxisAngle(extrapolatedFit.GetAxisDirection().GetDotProduct(extrapolatedDirection));
+
+    CaloHitList candidateHitList;
+
+    if (std::fabs(cosAxisAngle) < std::numeric_limits<float>::epsilon())
+    {
+        candidateHitList = viewHitGrid.GetCaloHitList();
+    }
+    else
+    {
+        const float minDeltaL(std::min(extrapolatedStartL, extrapolatedEndL) - extrapolatedStartL - maxDistanceToLine);
+        const float maxDeltaL(std::max(extrapolatedStartL, extrapolatedEndL) - extrapolatedStartL + maxDistanceToLine);
+        const float lineParameter1(minDeltaL / cosAxisAngle), lineParameter2(maxDeltaL / cosAxisAngle);
+
+        viewHitGrid.FindHitsInCorridor(extrapolatedStartPosition + (extrapolatedDirection * std::min(lineParameter1, lineParameter2)),
+            extrapolatedStartPosition + (extrapolatedDirection * std::max(lineParameter1, lineParameter2)), maxDistanceToLine, candidateHitList);
+    }
+
     CaloHitList collectedHits;
 
-    for (const CaloHit *const pCaloHit : *pViewHitList)
+    for (const CaloHit *const pCaloHit : candidateHitList)
     {
         if (std::find(showerSpineHitList.begin(), showerSpineHitList.end(), pCaloHit) != showerSpineHitList.end())
             continue;
@@ -11,6 +11,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 #include "Pandora/AlgorithmTool.h"
 
+#include "larpandoracontent/LArObjects/LArTwoDHitGrid.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
 namespace lar_content
@@ -21,7 +22,7 @@ class ShowerSpineFinderTool : public pandora::AlgorithmTool
 public:
     ShowerSpineFinderTool();
 
-    pandora::StatusCode Run(const pandora::CartesianVector &nuVertex3D, const pandora::CaloHitList *const pViewHitList, const pandora::HitType hitType,
+    pandora::StatusCode Run(const pandora::CartesianVector &nuVertex3D, const TwoDHitGrid &viewHitGrid, const pandora::HitType hitType,
         const pandora::CartesianVector &peakDirection, pandora::CaloHitList &unavailableHitList, pandora::CaloHitList &showerSpineHitList);
 
 private:
@@ -30,13 +31,13 @@ private:
     /**
      *  @brief  Perform a running fit to collect the hits of the shower spine
      *
-     *  @param  pViewHitList the 2D event hit list
+     *  @param  viewHitGrid the spatial index of the 2D event hits
      *  @param  nuVertex2D the 2D neutrino vertex
      *  @param  initialDirection the initial direction of the pathway
      *  @param  unavailableHitList protected hits that cannot be collected
      *  @param  showerSpineHitList the output list of shower spine hits
      */
-    void FindShowerSpine(const pandora::CaloHitList *const pViewHitList, const pandora::CartesianVector &nuVertex2D,
+    void FindShowerSpine(const TwoDHitGrid &viewHitGrid, const pandora::CartesianVector &nuVertex2D,
         const pandora::CartesianVector &initialDirection, pandora::CaloHitList &unavailableHitList, pandora::CaloHitList &showerSpineHitList) const;
 
     /**
@@ -47,7 +48,7 @@ private:
      *  @param  extrapolatedEndPosition the shower spine projection end position
      *  @param  extrapolatedDirection the shower spine projection direction
      *  @param  isEndDownstream whether the shower direction is downstream (in Z) of the neutrino vertex
-     *  @param  pViewHitList the 2D event hit list
+     *  @param  viewHitGrid the spatial index of the 2D event hits
      *  @param  runningFitPositionVector the vector of the hitherto collected hit positions
      *  @param  unavailableHitList protected hits that cannot be collected
      *  @param  showerSpineHitList the output list of shower spine hits
@@ -56,7 +57,7 @@ private:
      */
     bool CollectSubsectionHits(const TwoDSlidingFitResult &extrapolatedFit, const pandora::CartesianVector &extrapolatedStartPosition,
         const pandora::CartesianVector &extrapolatedEndPosition, const pandora::CartesianVector &extrapolatedDirection,
-        const bool isEndDownstream, const pandora::CaloHitList *const pViewHitList, pandora::CartesianPointVector &runningFitPositionVector,
+        const bool isEndDownstream, const TwoDHitGrid &viewHitGrid, pandora::CartesianPointVector &runningFitPositionVector,
         pandora::CaloHitList &unavailableHitList, pandora::CaloHitList &showerSpineHitList) const;
 
     /**
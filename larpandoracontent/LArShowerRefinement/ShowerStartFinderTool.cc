@@ -53,12 +53,13 @@ StatusCode ShowerStartFinderTool::Run(const ParticleFlowObject *const pShowerPfo
             &hitPositions, m_spineSlidingFitWindow, LArGeometryHelper::GetWirePitch(this->GetPandora(), hitType));
 
         // First obtain the longitudinal position of spine hits
-        LongitudinalPositionMap longitudinalPositionMap;
-        this->ObtainLongitudinalDecomposition(spineTwoDSlidingFit, showerSpineHitList, longitudinalPositionMap);
+        const CaloHitIndex caloHitIndex(showerSpineHitList);
+        LongitudinalPositionMap longitudinalPositionMap(caloHitIndex);
+        this->ObtainLongitudinalDecomposition(spineTwoDSlidingFit, caloHitIndex, longitudinalPositionMap);
 
         // Obtain spine energy profile
         EnergySpectrumMap energySpectrumMap;
-        this->GetEnergyDistribution(showerSpineHitList, longitudinalPositionMap, energySpectrumMap);
+        this->GetEnergyDistribution(caloHitIndex, longitudinalPositionMap, energySpectrumMap);
 
         // Now find the shower start position/direction
         const bool isEndDownstream(peakDirection.GetZ() > 0.f);
@@ -77,18 +78,18 @@ StatusCode ShowerStartFinderTool::Run(const ParticleFlowObject *const pShowerPfo
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ShowerStartFinderTool::ObtainLongitudinalDecomposition(const TwoDSlidingFitResult &spineTwoDSlidingFit,
-    const CaloHitList &showerSpineHitList, LongitudinalPositionMap &longitudinalPositionMap) const
+    const CaloHitIndex &caloHitIndex, LongitudinalPositionMap &longitudinalPositionMap) const
 {
     // Find hits in each layer
     LayerToHitMap layerToHitMap;
 
-    for (const CaloHit *const pCaloHit : showerSpineHitList)
+    for (unsigned int hitId = 0; hitId < caloHitIndex.GetNCaloHits(); ++hitId)
     {
         float hitL(0.f), hitT(0.f);
-        const CartesianVector hitPosition(pCaloHit->GetPositionVector());
+        const CartesianVector hitPosition(caloHitIndex.GetCaloHit(hitId)->GetPositionVector());
 
         spineTwoDSlidingFit.GetLocalPosition(hitPosition, hitL, hitT);
-        layerToHitMap[spineTwoDSlidingFit.GetLayer(hitL)].push_back(pCaloHit);
+        layerToHitMap[spineTwoDSlidingFit.GetLayer(hitL)].push_back(hitId);
     }
 
     // Walk through layers and store the longitudinal distance of each hit
@@ -117,9 +118,9 @@ void ShowerStartFinderTool::ObtainLongitudinalDecomposition(const TwoDSlidingFit
                                       ? 0.f
                                       : iter == layerToHitMap.begin() ? 0.f : (middleLayerPosition - lowerLayerPosition).GetMagnitude();
 
-        for (const CaloHit *const pCaloHit : iter->second)
+        for (const unsigned int hitId : iter->second)
         {
-            const CartesianVector &hitPosition(pCaloHit->GetPositionVector());
+            const CartesianVector &hitPosition(caloHitIndex.GetCaloHit(hitId)->GetPositionVector());
 
             float hitL(0.f), hitT(0.f);
             spineTwoDSlidingFit.GetLocalPosition(hitPosition, hitL, hitT);
@@ -147,7 +148,7 @@ void ShowerStartFinderTool::ObtainLongitudinalDecomposition(const TwoDSlidingFit
             // If we've passed the central position, we need to add on the layer length
             longitudinalDisplacement += (hitL > layerL ? layerLength : 0.f);
 
-            longitudinalPositionMap[pCaloHit] = longitudinalDisplacement;
+            longitudinalPositionMap.Set(hitId, longitudinalDisplacement);
         }
 
         runningDistance += layerLength;
@@ -156,18 +157,18 @@ void ShowerStartFinderTool::ObtainLongitudinalDecomposition(const TwoDSlidingFit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ShowerStartFinderTool::GetEnergyDistribution(const CaloHitList &showerSpineHitList,
+void ShowerStartFinderTool::GetEnergyDistribution(const CaloHitIndex &caloHitIndex,
     const LongitudinalPositionMap &longitudinalPositionMap, EnergySpectrumMap &energySpectrumMap) const
 {
     float e0(0.f);
 
-    for (const CaloHit *pCaloHit : showerSpineHitList)
+    for (const CaloHit *pCaloHit : caloHitIndex.GetCaloHitVector())
         e0 += pCaloHit->GetElectromagneticEnergy();
 
-    for (const CaloHit *pCaloHit : showerSpineHitList)
+    for (unsigned int hitId = 0; hitId < caloHitIndex.GetNCaloHits(); ++hitId)
     {
-        const float fractionalEnergy(pCaloHit->GetElectromagneticEnergy() / e0);
-        const float projection(longitudinalPositionMap.at(pCaloHit));
+        const float fractionalEnergy(caloHitIndex.GetCaloHit(hitId)->GetElectromagneticEnergy() / e0);
+        const float projection(longitudinalPositionMap.Get(hitId));
         const int longitudinalIndex = std::floor(projection / m_longitudinalCoordinateBinSize);
 
         if (energySpectrumMap.find(longitudinalIndex) == energySpectrumMap.end())
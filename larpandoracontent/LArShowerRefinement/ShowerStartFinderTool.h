@@ -11,6 +11,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 #include "Pandora/AlgorithmTool.h"
 
+#include "larpandoracontent/LArObjects/LArCaloHitIndex.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingShowerFitResult.h"
 
@@ -30,9 +31,9 @@ public:
         pandora::CartesianVector &showerStartDirection);
 
 private:
-    typedef std::map<const pandora::CaloHit *, float> LongitudinalPositionMap;
+    typedef CaloHitIdMap<float> LongitudinalPositionMap;
     typedef std::map<int, float> EnergySpectrumMap;
-    typedef std::map<int, pandora::CaloHitList> LayerToHitMap;
+    typedef std::map<int, CaloHitIdVector> LayerToHitMap;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -40,20 +41,20 @@ private:
      *  @brief  Create the [shower spine hit -> shower spine fit longitudinal projection] map
      *
      *  @param  spineTwoDSlidingFit the shower spine fit
-     *  @param  showerSpineHitList the shower spine hit list
+     *  @param  caloHitIndex the index of the shower spine hits
      *  @param  longitudinalPositionMap the output shower spine longitudinal projection map
      */
-    void ObtainLongitudinalDecomposition(const TwoDSlidingFitResult &spineTwoDSlidingFit, const pandora::CaloHitList &showerSpineHitList,
+    void ObtainLongitudinalDecomposition(const TwoDSlidingFitResult &spineTwoDSlidingFit, const CaloHitIndex &caloHitIndex,
         LongitudinalPositionMap &longitudinalPositionMap) const;
 
     /**
      *  @brief  Create the longituidnal energy distribution
      *
-     *  @param  showerSpineHitList the shower spine hit list
+     *  @param  caloHitIndex the index of the shower spine hits
      *  @param  longitudinalPositionMap the shower spine longitudinal projection map
      *  @param  energySpectrumMap the output [longitudial projection bin -> contained energy] map
      */
-    void GetEnergyDistribution(const pandora::CaloHitList &showerSpineHitList, const LongitudinalPositionMap &longitudinalPositionMap,
+    void GetEnergyDistribution(const CaloHitIndex &caloHitIndex, const LongitudinalPositionMap &longitudinalPositionMap,
         EnergySpectrumMap &energySpectrumMap) const;
 
     /**
@@ -57,16 +57,15 @@ StatusCode CosmicRayVertexBuildingAlgorithm::Run()
 
 void CosmicRayVertexBuildingAlgorithm::GetCosmicPfos(const PfoList *const pPfoList, PfoVector &pfoVector) const
 {
-    PfoList outputList;
-
     for (PfoList::const_iterator pIter = pPfoList->begin(), pIterEnd = pPfoList->end(); pIter != pIterEnd; ++pIter)
     {
         if (!LArPfoHelper::IsFinalState(*pIter))
             throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
-
-        LArPfoHelper::GetAllDownstreamPfos(*pIter, outputList);
     }
 
+    PfoList outputList;
+    LArPfoHelper::GetAllDownstreamPfos(*pPfoList, outputList);
+
     for (PfoList::const_iterator pIter = outputList.begin(), pIterEnd = outputList.end(); pIter != pIterEnd; ++pIter)
     {
         ClusterList clusterList;
@@ -20,7 +20,7 @@ using namespace pandora;
 namespace lar_content
 {
 
-DeltaRayMatchingContainers::DeltaRayMatchingContainers() : m_searchRegion1D(3.f)
+DeltaRayMatchingContainers::DeltaRayMatchingContainers() : m_searchRegion1D(3.f), m_maxStaleHitFraction(0.1f)
 {
 }
 
@@ -54,12 +54,33 @@ void DeltaRayMatchingContainers::AddToClusterMap(const Cluster *const pCluster)
 {
     const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
     HitToClusterMap &hitToClusterMap((hitType == TPC_VIEW_U) ? m_hitToClusterMapU : (hitType == TPC_VIEW_V) ? m_hitToClusterMapV : m_hitToClusterMapW);
+    ViewHitIndex &hitIndex((hitType == TPC_VIEW_U) ? m_hitIndexU : (hitType == TPC_VIEW_V) ? m_hitIndexV : m_hitIndexW);
 
     CaloHitList caloHitList;
     pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
 
     for (const CaloHit *const pCaloHit : caloHitList)
-        hitToClusterMap[pCaloHit] = pCluster;
+    {
+        const auto insertResult(hitToClusterMap.insert(HitToClusterMap::value_type(pCaloHit, pCluster)));
+
+        if (!insertResult.second)
+        {
+            insertResult.first->second = pCluster;
+            continue;
+        }
+
+        // Revive a tombstone, or queue the hit for the next KD tree build
+        if ((hitIndex.m_indexedHits.count(pCaloHit) > 0) || (hitIndex.m_pendingHitSet.count(pCaloHit) > 0))
+        {
+            if (hitIndex.m_nTombstones > 0)
+                --hitIndex.m_nTombstones;
+        }
+        else
+        {
+            hitIndex.m_pendingHits.push_back(pCaloHit);
+            hitIndex.m_pendingHitSet.insert(pCaloHit);
+        }
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -82,17 +103,68 @@ void DeltaRayMatchingContainers::FillClusterProximityMap(const ClusterList &inpu
 void DeltaRayMatchingContainers::BuildKDTree(const HitType hitType)
 {
     const HitToClusterMap &hitToClusterMap((hitType == TPC_VIEW_U) ? m_hitToClusterMapU : (hitType == TPC_VIEW_V) ? m_hitToClusterMapV : m_hitToClusterMapW);
-    HitKDTree2D &kdTree((hitType == TPC_VIEW_U) ? m_kdTreeU : (hitType == TPC_VIEW_V) ? m_kdTreeV : m_kdTreeW);
+    ViewHitIndex &hitIndex((hitType == TPC_VIEW_U) ? m_hitIndexU : (hitType == TPC_VIEW_V) ? m_hitIndexV : m_hitIndexW);
+
+    hitIndex.Clear();
 
     CaloHitList allCaloHits;
 
     for (auto &entry : hitToClusterMap)
+    {
         allCaloHits.push_back(entry.first);
+        hitIndex.m_indexedHits.insert(entry.first);
+    }
 
     HitKDNode2DList hitKDNode2DList;
     KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(allCaloHits, hitKDNode2DList));
 
-    kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+    hitIndex.m_kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DeltaRayMatchingContainers::UpdateKDTree(const HitType hitType)
+{
+    const ViewHitIndex &hitIndex((hitType == TPC_VIEW_U) ? m_hitIndexU : (hitType == TPC_VIEW_V) ? m_hitIndexV : m_hitIndexW);
+    const unsigned int nStaleHits(hitIndex.m_pendingHits.size() + hitIndex.m_nTombstones);
+    const unsigned int nHits(hitIndex.m_indexedHits.size() + hitIndex.m_pendingHits.size());
+
+    if ((nStaleHits > 0) && (static_cast<float>(nStaleHits) > m_maxStaleHitFraction * static_cast<float>(nHits)))
+        this->BuildKDTree(hitType);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DeltaRayMatchingContainers::FindNearbyHits(const CaloHit *const pCaloHit, CaloHitVector &nearbyHits)
+{
+    const HitType hitType(pCaloHit->GetHitType());
+    const HitToClusterMap &hitToClusterMap((hitType == TPC_VIEW_U) ? m_hitToClusterMapU : (hitType == TPC_VIEW_V) ? m_hitToClusterMapV : m_hitToClusterMapW);
+    ViewHitIndex &hitIndex((hitType == TPC_VIEW_U) ? m_hitIndexU : (hitType == TPC_VIEW_V) ? m_hitIndexV : m_hitIndexW);
+
+    HitKDNode2DList found;
+    const KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D));
+
+    hitIndex.m_kdTree.search(searchRegionHits, found);
+
+    for (const HitKDNode2D &hit : found)
+    {
+        if (hitToClusterMap.find(hit.data) != hitToClusterMap.end())
+            nearbyHits.push_back(hit.data);
+    }
+
+    for (const CaloHit *const pPendingHit : hitIndex.m_pendingHits)
+    {
+        const CartesianVector &position(pPendingHit->GetPositionVector());
+
+        if ((position.GetX() < searchRegionHits.dimmin[0]) || (position.GetX() > searchRegionHits.dimmax[0]) ||
+            (position.GetZ() < searchRegionHits.dimmin[1]) || (position.GetZ() > searchRegionHits.dimmax[1]))
+        {
+            continue;
+        }
+
+        if (hitToClusterMap.find(pPendingHit) != hitToClusterMap.end())
+            nearbyHits.push_back(pPendingHit);
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -101,25 +173,27 @@ void DeltaRayMatchingContainers::AddToClusterProximityMap(const Cluster *const p
 {
     const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
     const HitToClusterMap &hitToClusterMap((hitType == TPC_VIEW_U) ? m_hitToClusterMapU : (hitType == TPC_VIEW_V) ? m_hitToClusterMapV : m_hitToClusterMapW);
-    HitKDTree2D &kdTree((hitType == TPC_VIEW_U) ? m_kdTreeU : (hitType == TPC_VIEW_V) ? m_kdTreeV : m_kdTreeW);
     ClusterProximityMap &clusterProximityMap(
         (hitType == TPC_VIEW_U) ? m_clusterProximityMapU : (hitType == TPC_VIEW_V) ? m_clusterProximityMapV : m_clusterProximityMapW);
 
+    this->UpdateKDTree(hitType);
+
     CaloHitList caloHitList;
     pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
 
+    // ATTN Once a nearby cluster has been recorded, in both directions, later sightings need not search the proximity lists again
+    std::unordered_set<const Cluster *> recordedClusters;
+
     for (const CaloHit *const pCaloHit : caloHitList)
     {
-        HitKDNode2DList found;
-        KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D));
-
-        kdTree.search(searchRegionHits, found);
+        CaloHitVector nearbyHits;
+        this->FindNearbyHits(pCaloHit, nearbyHits);
 
-        for (const auto &hit : found)
+        for (const CaloHit *const pNearbyHit : nearbyHits)
         {
-            const Cluster *const pNearbyCluster(hitToClusterMap.at(hit.data));
+            const Cluster *const pNearbyCluster(hitToClusterMap.at(pNearbyHit));
 
-            if (pNearbyCluster == pCluster)
+            if ((pNearbyCluster == pCluster) || !recordedClusters.insert(pNearbyCluster).second)
                 continue;
 
             ClusterList &nearbyClusterList(clusterProximityMap[pCluster]);
@@ -196,6 +270,8 @@ void DeltaRayMatchingContainers::RemoveClusterFromContainers(const Cluster *cons
     CaloHitList caloHitList;
     pDeletedCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
 
+    ViewHitIndex &hitIndex((hitType == TPC_VIEW_U) ? m_hitIndexU : (hitType == TPC_VIEW_V) ? m_hitIndexV : m_hitIndexW);
+
     for (const CaloHit *const pCaloHit : caloHitList)
     {
         const HitToClusterMap::const_iterator iter(hitToClusterMap.find(pCaloHit));
@@ -204,6 +280,9 @@ void DeltaRayMatchingContainers::RemoveClusterFromContainers(const Cluster *cons
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
         hitToClusterMap.erase(iter);
+
+        // ATTN The hit is left in the spatial index as a tombstone, until it is revived or the KD tree is rebuilt
+        ++hitIndex.m_nTombstones;
     }
 
     const ClusterProximityMap::const_iterator clusterProximityIter(clusterProximityMap.find(pDeletedCluster));
@@ -242,9 +321,9 @@ void DeltaRayMatchingContainers::ClearContainers()
     m_hitToClusterMapV.clear();
     m_hitToClusterMapW.clear();
 
-    m_kdTreeU.clear();
-    m_kdTreeV.clear();
-    m_kdTreeW.clear();
+    m_hitIndexU.Clear();
+    m_hitIndexV.Clear();
+    m_hitIndexW.Clear();
 
     m_clusterProximityMapU.clear();
     m_clusterProximityMapV.clear();
@@ -255,4 +334,22 @@ void DeltaRayMatchingContainers::ClearContainers()
     m_clusterToPfoMapW.clear();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+DeltaRayMatchingContainers::ViewHitIndex::ViewHitIndex() : m_nTombstones(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DeltaRayMatchingContainers::ViewHitIndex::Clear()
+{
+    m_kdTree.clear();
+    m_indexedHits.clear();
+    m_pendingHits.clear();
+    m_pendingHitSet.clear();
+    m_nTombstones = 0;
+}
+
 } // namespace lar_content
@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
+#include <unordered_set>
+
 namespace lar_content
 {
 
@@ -82,13 +84,42 @@ public:
      */
     void ClearContainers();
 
-    float m_searchRegion1D; ///< Search region, applied to each dimension, for look-up from kd-tree
+    float m_searchRegion1D;       ///< Search region, applied to each dimension, for look-up from kd-tree
+    float m_maxStaleHitFraction;  ///< The max. fraction of stale (deleted or not yet indexed) hits in a view before its kd-tree is rebuilt
 
 private:
     typedef std::map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
     typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
     typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
     typedef std::vector<HitKDNode2D> HitKDNode2DList;
+    typedef std::unordered_set<const pandora::CaloHit *> CaloHitSet;
+
+    /**
+     *  @brief  ViewHitIndex class, the incrementally updated spatial index of the hits of a view
+     *
+     *          Hits removed from the hit to cluster map are left in the kd-tree as tombstones, and skipped on look-up, while hits that
+     *          were not in the kd-tree when it was built are held in a pending list that is searched directly. The kd-tree is only
+     *          rebuilt, on the next look-up, once the stale hits make up a significant fraction of the view.
+     */
+    class ViewHitIndex
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        ViewHitIndex();
+
+        /**
+         *  @brief  Empty the index
+         */
+        void Clear();
+
+        HitKDTree2D m_kdTree;                  ///< The KD tree
+        CaloHitSet m_indexedHits;              ///< The hits held in the KD tree
+        pandora::CaloHitVector m_pendingHits;  ///< The hits added since the KD tree was built, in the order of addition
+        CaloHitSet m_pendingHitSet;            ///< The hits added since the KD tree was built, for fast look-up
+        unsigned int m_nTombstones;            ///< The number of indexed or pending hits no longer in the hit to cluster map
+    };
 
     /**
      *  @brief  Populate the hit to cluster map from a list of clusters
@@ -98,7 +129,7 @@ private:
     void FillHitToClusterMap(const pandora::ClusterList &inputClusterList);
 
     /**
-     *  @brief  Add the hits of a given cluster to the hit to cluster map
+     *  @brief  Add the hits of a given cluster to the hit to cluster map, and register any hits missing from the view hit index
      *
      *  @param  pCluster the address of the input cluster
      */
@@ -119,12 +150,27 @@ private:
     void FillClusterProximityMap(const pandora::ClusterList &inputClusterList);
 
     /**
-     *  @brief  Build the KD tree
+     *  @brief  Build the KD tree from the current contents of the hit to cluster map
      *
      *  @param  hitType the hit type of the KD tree to build
      */
     void BuildKDTree(const pandora::HitType hitType);
 
+    /**
+     *  @brief  Rebuild the KD tree if it has been outdated by the cluster insertions and deletions
+     *
+     *  @param  hitType the hit type of the KD tree to check
+     */
+    void UpdateKDTree(const pandora::HitType hitType);
+
+    /**
+     *  @brief  Find the hits, still in the hit to cluster map, that lie within the search region around a given hit
+     *
+     *  @param  pCaloHit the address of the given hit
+     *  @param  nearbyHits the output vector of nearby hits
+     */
+    void FindNearbyHits(const pandora::CaloHit *const pCaloHit, pandora::CaloHitVector &nearbyHits);
+
     /**
      *  @brief  Add a cluster to the cluster proximity map
      *
@@ -135,9 +181,9 @@ private:
     HitToClusterMap m_hitToClusterMapU;         ///< The mapping of hits to the clusters to which they belong (in the U view)
     HitToClusterMap m_hitToClusterMapV;         ///< The mapping of hits to the clusters to which they belong (in the V view)
     HitToClusterMap m_hitToClusterMapW;         ///< The mapping of hits to the clusters to which they belong (in the W view)
-    HitKDTree2D m_kdTreeU;                      ///< The KD tree (in the U view)
-    HitKDTree2D m_kdTreeV;                      ///< The KD tree (in the V view)
-    HitKDTree2D m_kdTreeW;                      ///< The KD tree (in the W view)
+    ViewHitIndex m_hitIndexU;                   ///< The hit spatial index (in the U view)
+    ViewHitIndex m_hitIndexV;                   ///< The hit spatial index (in the V view)
+    ViewHitIndex m_hitIndexW;                   ///< The hit spatial index (in the W view)
     ClusterProximityMap m_clusterProximityMapU; ///< The mapping of clusters to their neighbouring clusters (in the U view)
     ClusterProximityMap m_clusterProximityMapV; ///< The mapping of clusters to their neighbouring clusters (in the V view)
     ClusterProximityMap m_clusterProximityMapW; ///< The mapping of clusters to their neighbouring clusters (in the W view)
@@ -52,16 +52,15 @@ StatusCode NeutrinoDaughterVerticesAlgorithm::Run()
 
 void NeutrinoDaughterVerticesAlgorithm::GetDaughterPfos(const PfoList *const pPfoList, PfoVector &pfoVector) const
 {
-    PfoList outputList;
-
     for (PfoList::const_iterator pIter = pPfoList->begin(), pIterEnd = pPfoList->end(); pIter != pIterEnd; ++pIter)
     {
         if (!LArPfoHelper::IsNeutrino(*pIter) && (*pIter)->GetVertexList().size() != 1)
             throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
-
-        LArPfoHelper::GetAllDownstreamPfos(*pIter, outputList);
     }
 
+    PfoList outputList;
+    LArPfoHelper::GetAllDownstreamPfos(*pPfoList, outputList);
+
     for (PfoList::const_iterator pIter = outputList.begin(), pIterEnd = outputList.end(); pIter != pIterEnd; ++pIter)
     {
         ClusterList clusterList;
@@ -10,8 +10,11 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArInstrumentationHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArProcessingBudgetHelper.h"
 
+#include "larpandoracontent/LArObjects/LArCaloHitIndex.h"
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/HitCreationBaseTool.h"
@@ -49,6 +52,8 @@ void ThreeDHitCreationAlgorithm::FilterCaloHitsByType(const CaloHitVector &input
 
 StatusCode ThreeDHitCreationAlgorithm::Run()
 {
+    const LArInstrumentationHelper::ScopedTimer timer(*this, "Run");
+
     const PfoList *pPfoList(nullptr);
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=, PandoraContentApi::GetList(*this, m_inputPfoListName, pPfoList));
@@ -66,22 +71,34 @@ StatusCode ThreeDHitCreationAlgorithm::Run()
     PfoVector pfoVector(pPfoList->begin(), pPfoList->end());
     std::sort(pfoVector.begin(), pfoVector.end(), LArPfoHelper::SortByNHits);
 
+    LArProcessingBudgetHelper::Checkpoint budgetCheckpoint(this->GetPandora());
+
     for (const ParticleFlowObject *const pPfo : pfoVector)
     {
+        // ATTN Once the processing budget is exhausted, remaining pfos skip the later hit creation tools and the iterative refinement,
+        // so that every pfo still receives 3D hits at reduced cost
+        const bool isBudgetExhausted(budgetCheckpoint.IsExhausted(LArPfoHelper::GetNumberOfTwoDHits(pPfo)));
         ProtoHitVector protoHitVector;
 
         for (HitCreationBaseTool *const pHitCreationTool : m_algorithmToolVector)
         {
+            if (isBudgetExhausted && !protoHitVector.empty())
+                break;
+
             CaloHitVector remainingTwoDHits;
             this->SeparateTwoDHits(pPfo, protoHitVector, remainingTwoDHits);
 
             if (remainingTwoDHits.empty())
                 break;
 
+            const LArInstrumentationHelper::ScopedTimer toolTimer(*pHitCreationTool, "Run");
             pHitCreationTool->Run(this, pPfo, remainingTwoDHits, protoHitVector);
         }
 
-        if ((m_iterateTrackHits && LArPfoHelper::IsTrack(pPfo)) || (m_iterateShowerHits && LArPfoHelper::IsShower(pPfo)))
+        const bool shouldIterate(
+            (m_iterateTrackHits && LArPfoHelper::IsTrack(pPfo)) || (m_iterateShowerHits && LArPfoHelper::IsShower(pPfo)));
+
+        if (shouldIterate && !isBudgetExhausted)
             this->IterativeTreatment(protoHitVector);
 
         if (protoHitVector.empty())
@@ -94,6 +111,9 @@ StatusCode ThreeDHitCreationAlgorithm::Run()
         allNewThreeDHits.insert(allNewThreeDHits.end(), newThreeDHits.begin(), newThreeDHits.end());
     }
 
+    LArInstrumentationHelper::AddToCounter(*this, "nInputPfos", static_cast<double>(pfoVector.size()));
+    LArInstrumentationHelper::AddToCounter(*this, "nThreeDHitsCreated", static_cast<double>(allNewThreeDHits.size()));
+
     if (!allNewThreeDHits.empty())
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList(*this, allNewThreeDHits, m_outputCaloHitListName));
 
@@ -117,19 +137,23 @@ void ThreeDHitCreationAlgorithm::SeparateTwoDHits(
         pCluster->GetOrderedCaloHitList().FillCaloHitList(remainingHitList);
     }
 
-    CaloHitSet remainingHitSet(remainingHitList.begin(), remainingHitList.end());
+    const CaloHitIndex caloHitIndex(remainingHitList);
+    CaloHitIdSet usedHitIds(caloHitIndex);
 
     for (const ProtoHit &protoHit : protoHitVector)
     {
-        CaloHitSet::iterator eraseIter = remainingHitSet.find(protoHit.GetParentCaloHit2D());
+        const CaloHit *const pCaloHit2D(protoHit.GetParentCaloHit2D());
 
-        if (remainingHitSet.end() == eraseIter)
+        if (!caloHitIndex.Contains(pCaloHit2D) || !usedHitIds.Insert(caloHitIndex.GetId(pCaloHit2D)))
             throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
 
-        remainingHitSet.erase(eraseIter);
+    for (unsigned int hitId = 0; hitId < caloHitIndex.GetNCaloHits(); ++hitId)
+    {
+        if (!usedHitIds.Contains(hitId))
+            remainingHitVector.push_back(caloHitIndex.GetCaloHit(hitId));
     }
 
-    remainingHitVector.insert(remainingHitVector.end(), remainingHitSet.begin(), remainingHitSet.end());
     std::sort(remainingHitVector.begin(), remainingHitVector.end(), LArClusterHelper::SortHitsByPosition);
 }
 
@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArInstrumentationHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/MatchingBaseAlgorithm.h"
 
@@ -134,6 +135,8 @@ void MatchingBaseAlgorithm::SetPfoParticleId(PandoraContentApi::ParticleFlowObje
 
 StatusCode MatchingBaseAlgorithm::Run()
 {
+    const LArInstrumentationHelper::ScopedTimer timer(*this, "Run");
+
     try
     {
         this->SelectAllInputClusters();
@@ -9,6 +9,8 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArInstrumentationHelper.h"
+#include "larpandoracontent/LArHelpers/LArProcessingBudgetHelper.h"
 
 #include "larpandoracontent/LArObjects/LArShowerOverlapResult.h"
 #include "larpandoracontent/LArObjects/LArTrackOverlapResult.h"
@@ -218,6 +220,8 @@ void ThreeViewMatchingControl<T>::TidyUp()
 template <typename T>
 void ThreeViewMatchingControl<T>::PerformMainLoop()
 {
+    const LArInstrumentationHelper::ScopedTimer timer(*m_pAlgorithm, "MainLoop");
+
     ClusterVector clusterVectorU(m_clusterListU.begin(), m_clusterListU.end());
     ClusterVector clusterVectorV(m_clusterListV.begin(), m_clusterListV.end());
     ClusterVector clusterVectorW(m_clusterListW.begin(), m_clusterListW.end());
@@ -225,14 +229,27 @@ void ThreeViewMatchingControl<T>::PerformMainLoop()
     std::sort(clusterVectorV.begin(), clusterVectorV.end(), LArClusterHelper::SortByNHits);
     std::sort(clusterVectorW.begin(), clusterVectorW.end(), LArClusterHelper::SortByNHits);
 
+    const unsigned int nTriplesPerClusterU(clusterVectorV.size() * clusterVectorW.size());
+    LArProcessingBudgetHelper::Checkpoint budgetCheckpoint(m_pAlgorithm->GetPandora());
+    unsigned int nClustersUEvaluated(0);
+
     for (const Cluster *const pClusterU : clusterVectorU)
     {
+        // ATTN Once the processing budget is exhausted, no further triples are evaluated; the overlap results found are examined as usual
+        if (budgetCheckpoint.IsExhausted(nTriplesPerClusterU))
+            break;
+
         for (const Cluster *const pClusterV : clusterVectorV)
         {
             for (const Cluster *const pClusterW : clusterVectorW)
                 m_pAlgorithm->CalculateOverlapResult(pClusterU, pClusterV, pClusterW);
         }
+
+        ++nClustersUEvaluated;
     }
+
+    LArInstrumentationHelper::AddToCounter(
+        *m_pAlgorithm, "nTriplesEvaluated", static_cast<double>(nClustersUEvaluated) * static_cast<double>(nTriplesPerClusterU));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -9,6 +9,8 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArInstrumentationHelper.h"
+#include "larpandoracontent/LArHelpers/LArProcessingBudgetHelper.h"
 
 #include "larpandoracontent/LArObjects/LArTrackTwoViewOverlapResult.h"
 
@@ -214,16 +216,30 @@ void TwoViewMatchingControl<T>::TidyUp()
 template <typename T>
 void TwoViewMatchingControl<T>::PerformMainLoop()
 {
+    const LArInstrumentationHelper::ScopedTimer timer(*m_pAlgorithm, "MainLoop");
+
     ClusterVector clusterVector1(m_clusterList1.begin(), m_clusterList1.end());
     ClusterVector clusterVector2(m_clusterList2.begin(), m_clusterList2.end());
     std::sort(clusterVector1.begin(), clusterVector1.end(), LArClusterHelper::SortByNHits);
     std::sort(clusterVector2.begin(), clusterVector2.end(), LArClusterHelper::SortByNHits);
 
+    LArProcessingBudgetHelper::Checkpoint budgetCheckpoint(m_pAlgorithm->GetPandora());
+    unsigned int nClusters1Evaluated(0);
+
     for (const Cluster *const pCluster1 : clusterVector1)
     {
+        // ATTN Once the processing budget is exhausted, no further pairs are evaluated; the overlap results found are examined as usual
+        if (budgetCheckpoint.IsExhausted(clusterVector2.size()))
+            break;
+
         for (const Cluster *const pCluster2 : clusterVector2)
             m_pAlgorithm->CalculateOverlapResult(pCluster1, pCluster2);
+
+        ++nClusters1Evaluated;
     }
+
+    LArInstrumentationHelper::AddToCounter(
+        *m_pAlgorithm, "nPairsEvaluated", static_cast<double>(nClusters1Evaluated) * static_cast<double>(clusterVector2.size()));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -37,6 +37,7 @@ MvaPfoCharacterisationAlgorithm<T>::MvaPfoCharacterisationAlgorithm() :
     m_fiducialMinZ(-std::numeric_limits<float>::max()),
     m_fiducialMaxZ(std::numeric_limits<float>::max()),
     m_applyReconstructabilityChecks(false),
+    m_trainingOutputFormat("csv"),
     m_filePathEnvironmentVariable("FW_SEARCH_PATH")
 {
 }
@@ -49,8 +50,7 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const Cluster *const pClus
     if (pCluster->GetNCaloHits() < m_minCaloHitsCut)
         return false;
 
-    StringVector featureOrder;
-    const LArMvaHelper::MvaFeatureMap featureMap(LArMvaHelper::CalculateFeatures(m_algorithmToolNames, m_featureToolMap, featureOrder, this, pCluster));
+    const LArMvaHelper::MvaFeatureVector &featureVector(m_featurePipeline.CalculateFeatures(this, pCluster));
 
     if (m_trainingSetMode)
     {
@@ -65,17 +65,17 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const Cluster *const pClus
         {
         }
 
-        LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, isTrueTrack, featureOrder, featureMap);
+        LArMvaHelper::ProduceTrainingExample(m_trainingSink, m_trainingOutputFile, isTrueTrack, featureVector, m_featurePipeline.GetFeatureOrder());
         return isTrueTrack;
     }
 
     if (!m_enableProbability)
     {
-        return LArMvaHelper::Classify(m_mva, featureOrder, featureMap);
+        return LArMvaHelper::Classify(m_mva, featureVector);
     }
     else
     {
-        return (LArMvaHelper::CalculateProbability(m_mva, featureOrder, featureMap) > m_minProbabilityCut);
+        return (LArMvaHelper::CalculateProbability(m_mva, featureVector) > m_minProbabilityCut);
     }
 }
 
@@ -99,16 +99,11 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
     ClusterList wClusterList;
     LArPfoHelper::GetClusters(pPfo, TPC_VIEW_W, wClusterList);
 
-    const PfoCharacterisationFeatureTool::FeatureToolMap &chosenFeatureToolMap(wClusterList.empty() ? m_featureToolMapNoChargeInfo : m_featureToolMapThreeD);
-    const StringVector chosenFeatureToolOrder(wClusterList.empty() ? m_algorithmToolNamesNoChargeInfo : m_algorithmToolNames);
-    StringVector featureOrder;
-    const LArMvaHelper::MvaFeatureMap featureMap(
-        LArMvaHelper::CalculateFeatures(chosenFeatureToolOrder, chosenFeatureToolMap, featureOrder, this, pPfo));
+    PfoCharacterisationFeatureTool::FeaturePipeline &chosenFeaturePipeline(wClusterList.empty() ? m_featurePipelineNoChargeInfo : m_featurePipelineThreeD);
+    const LArMvaHelper::MvaFeatureVector &featureVector(chosenFeaturePipeline.CalculateFeatures(this, pPfo));
 
-    for (auto const &[featureKey, featureValue] : featureMap)
+    for (const LArMvaHelper::MvaFeature &featureValue : featureVector)
     {
-        (void)featureKey;
-
         if (!featureValue.IsInitialized())
         {
             if (m_enableProbability)
@@ -231,7 +226,7 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
                 std::string outputFile(m_trainingOutputFile);
                 const std::string end = ((wClusterList.empty()) ? "noChargeInfo.txt" : ".txt");
                 outputFile.append(end);
-                LArMvaHelper::ProduceTrainingExample(outputFile, isTrueTrack, featureOrder, featureMap);
+                LArMvaHelper::ProduceTrainingExample(m_trainingSink, outputFile, isTrueTrack, featureVector, chosenFeaturePipeline.GetFeatureOrder());
             }
         }
 
@@ -256,7 +251,7 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
         {
             std::string outputFile(m_trainingOutputFile);
             outputFile.append(wClusterList.empty() ? "noChargeInfo.txt" : ".txt");
-            LArMvaHelper::ProduceTrainingExample(outputFile, isTrueTrack, featureOrder, featureMap);
+            LArMvaHelper::ProduceTrainingExample(m_trainingSink, outputFile, isTrueTrack, featureVector, chosenFeaturePipeline.GetFeatureOrder());
         }
 
         return isTrueTrack;
@@ -265,18 +260,20 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
     // If no failures, proceed with MvaPfoCharacterisationAlgorithm classification
     if (!m_enableProbability)
     {
-        return LArMvaHelper::Classify((wClusterList.empty() ? m_mvaNoChargeInfo : m_mva), featureOrder, featureMap);
+        return LArMvaHelper::Classify((wClusterList.empty() ? m_mvaNoChargeInfo : m_mva), featureVector);
     }
     else
     {
-        const double score(LArMvaHelper::CalculateProbability((wClusterList.empty() ? m_mvaNoChargeInfo : m_mva), featureOrder, featureMap));
+        const double score(LArMvaHelper::CalculateProbability((wClusterList.empty() ? m_mvaNoChargeInfo : m_mva), featureVector));
         object_creation::ParticleFlowObject::Metadata metadata;
         metadata.m_propertiesToAdd["TrackScore"] = score;
         if (m_persistFeatures)
         {
-            for (auto const &[name, value] : featureMap)
+            const StringVector &featureOrder(chosenFeaturePipeline.GetFeatureOrder());
+
+            for (unsigned int iFeature = 0; iFeature < featureVector.size(); ++iFeature)
             {
-                metadata.m_propertiesToAdd[name] = value.Get();
+                metadata.m_propertiesToAdd[featureOrder.at(iFeature)] = featureVector.at(iFeature).Get();
             }
         }
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
@@ -359,6 +356,9 @@ StatusCode MvaPfoCharacterisationAlgorithm<T>::ReadSettings(const TiXmlHandle xm
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "CaloHitListName", m_caloHitListName));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "MCParticleListName", m_mcParticleListName));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFileName", m_trainingOutputFile));
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFormat", m_trainingOutputFormat));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_trainingSink.SetFormat(m_trainingOutputFormat));
         PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TestBeamMode", m_testBeamMode));
         PANDORA_RETURN_RESULT_IF_AND_IF(
             STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ApplyFiducialCut", m_applyFiducialCut));
@@ -417,11 +417,17 @@ StatusCode MvaPfoCharacterisationAlgorithm<T>::ReadSettings(const TiXmlHandle xm
         for (auto const &[pAlgorithmToolName, pAlgorithmTool] : algorithmToolMapNoChargeInfo)
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
                 LArMvaHelper::AddFeatureToolToMap(pAlgorithmTool, pAlgorithmToolName, m_featureToolMapNoChargeInfo));
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_featurePipelineThreeD.Initialize(m_algorithmToolNames, m_featureToolMapThreeD));
+        PANDORA_RETURN_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, m_featurePipelineNoChargeInfo.Initialize(m_algorithmToolNamesNoChargeInfo, m_featureToolMapNoChargeInfo));
     }
     else
     {
         for (auto const &[pAlgorithmToolName, pAlgorithmTool] : algorithmToolMap)
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArMvaHelper::AddFeatureToolToMap(pAlgorithmTool, pAlgorithmToolName, m_featureToolMap));
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_featurePipeline.Initialize(m_algorithmToolNames, m_featureToolMap));
     }
 
     return PfoCharacterisationBaseAlgorithm::ReadSettings(xmlHandle);
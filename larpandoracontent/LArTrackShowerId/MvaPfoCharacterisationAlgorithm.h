@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 
 #include "larpandoracontent/LArObjects/LArAdaBoostDecisionTree.h"
+#include "larpandoracontent/LArObjects/LArMvaTrainingSink.h"
 #include "larpandoracontent/LArObjects/LArSupportVectorMachine.h"
 
 #include "larpandoracontent/LArTrackShowerId/PfoCharacterisationBaseAlgorithm.h"
@@ -46,6 +47,12 @@ protected:
     pandora::StringVector m_algorithmToolNames; ///< Vector of strings saving feature tool order for use in feature calculation
     pandora::StringVector m_algorithmToolNamesNoChargeInfo; ///< Vector of strings saving feature tool order for use in feature calculation (missing W view)
 
+    mutable ClusterCharacterisationFeatureTool::FeaturePipeline m_featurePipeline;           ///< The resolved cluster feature tools
+    mutable PfoCharacterisationFeatureTool::FeaturePipeline m_featurePipelineThreeD;       ///< The resolved pfo feature tools for 3D info
+    mutable PfoCharacterisationFeatureTool::FeaturePipeline m_featurePipelineNoChargeInfo; ///< The resolved pfo feature tools for missing W view
+
+    mutable MvaTrainingSink m_trainingSink; ///< The sink buffering the training examples
+
     T m_mva;             ///< The mva
     T m_mvaNoChargeInfo; ///< The mva for missing W view
 
@@ -69,6 +76,7 @@ protected:
     std::string m_mcParticleListName; ///< Name of input MC particle list
 
     std::string m_trainingOutputFile;          ///< The training output file
+    std::string m_trainingOutputFormat;        ///< The training output format, csv or binary
     std::string m_filePathEnvironmentVariable; ///< The environment variable providing a list of paths to mva files
     std::string m_mvaFileName;                 ///< The mva input file
     std::string m_mvaName;                     ///< The name of the mva to find
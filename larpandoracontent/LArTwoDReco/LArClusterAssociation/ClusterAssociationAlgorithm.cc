@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArInstrumentationHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterAssociationAlgorithm.h"
 
@@ -17,7 +18,7 @@ using namespace pandora;
 namespace lar_content
 {
 
-ClusterAssociationAlgorithm::ClusterAssociationAlgorithm() : m_mergeMade(false), m_resolveAmbiguousAssociations(true)
+ClusterAssociationAlgorithm::ClusterAssociationAlgorithm() : m_mergeMade(false), m_resolveAmbiguousAssociations(true), m_useWorklist(false)
 {
 }
 
@@ -35,6 +36,9 @@ StatusCode ClusterAssociationAlgorithm::Run()
     this->PopulateClusterAssociationMap(clusterVector, clusterAssociationMap);
 
     m_mergeMade = true;
+    m_deletedClusters.clear();
+    m_modifiedClusters.clear();
+    m_modifiedClusters.insert(clusterVector.begin(), clusterVector.end());
 
     while (m_mergeMade)
     {
@@ -42,16 +46,29 @@ StatusCode ClusterAssociationAlgorithm::Run()
         while (m_mergeMade)
         {
             m_mergeMade = false;
+            unsigned int nEvaluatedClusters(0), nSkippedClusters(0);
 
             for (const Cluster *const pCluster : clusterVector)
             {
                 // ATTN The clusterVector may end up with dangling pointers; only protected by this check against managed cluster list
-                if (pClusterList->end() == std::find(pClusterList->begin(), pClusterList->end(), pCluster))
+                if (m_useWorklist ? (m_deletedClusters.count(pCluster) > 0)
+                                  : (pClusterList->end() == std::find(pClusterList->begin(), pClusterList->end(), pCluster)))
                     continue;
 
+                // ATTN Propagation from a cluster can only change if its associations, or those of its associated clusters, have changed
+                if (m_useWorklist && (0 == m_modifiedClusters.erase(pCluster)))
+                {
+                    ++nSkippedClusters;
+                    continue;
+                }
+
+                ++nEvaluatedClusters;
                 this->UnambiguousPropagation(pCluster, true, clusterAssociationMap);
                 this->UnambiguousPropagation(pCluster, false, clusterAssociationMap);
             }
+
+            LArInstrumentationHelper::AddToCounter(*this, "nClustersEvaluated", static_cast<double>(nEvaluatedClusters));
+            LArInstrumentationHelper::AddToCounter(*this, "nClustersSkipped", static_cast<double>(nSkippedClusters));
         }
 
         if (!m_resolveAmbiguousAssociations)
@@ -111,6 +128,7 @@ void ClusterAssociationAlgorithm::UnambiguousPropagation(const Cluster *const pC
     this->UpdateForUnambiguousMerge(pClusterToEnlarge, pClusterToDelete, isForward, clusterAssociationMap);
 
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pClusterToEnlarge, pClusterToDelete));
+    (void)m_deletedClusters.insert(pClusterToDelete);
     m_mergeMade = true;
 
     this->UnambiguousPropagation(pClusterToEnlarge, isForward, clusterAssociationMap);
@@ -154,6 +172,7 @@ void ClusterAssociationAlgorithm::AmbiguousPropagation(const Cluster *const pClu
         this->UpdateForAmbiguousMerge(*dIter, clusterAssociationMap);
 
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pCluster, *dIter));
+        (void)m_deletedClusters.insert(*dIter);
         m_mergeMade = true;
         *dIter = NULL;
     }
@@ -177,6 +196,9 @@ void ClusterAssociationAlgorithm::UpdateForUnambiguousMerge(const Cluster *const
     clusterSetToReplace = clusterSetToMove;
     clusterAssociationMap.erase(iterDelete);
 
+    ClusterSet changedClusters;
+    (void)changedClusters.insert(pClusterToEnlarge);
+
     for (ClusterAssociationMap::iterator iter = clusterAssociationMap.begin(), iterEnd = clusterAssociationMap.end(); iter != iterEnd; ++iter)
     {
         ClusterSet &forwardClusters = iter->second.m_forwardAssociations;
@@ -189,14 +211,19 @@ void ClusterAssociationAlgorithm::UpdateForUnambiguousMerge(const Cluster *const
         {
             forwardClusters.erase(forwardIter);
             forwardClusters.insert(pClusterToEnlarge);
+            (void)changedClusters.insert(iter->first);
         }
 
         if (backwardClusters.end() != backwardIter)
         {
             backwardClusters.erase(backwardIter);
             backwardClusters.insert(pClusterToEnlarge);
+            (void)changedClusters.insert(iter->first);
         }
     }
+
+    if (m_useWorklist)
+        this->FlagModifiedClusters(changedClusters, clusterAssociationMap);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -208,6 +235,8 @@ void ClusterAssociationAlgorithm::UpdateForAmbiguousMerge(const Cluster *const p
     if (clusterAssociationMap.end() == cIter)
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
+    ClusterSet changedClusters;
+
     for (ClusterAssociationMap::iterator mIter = clusterAssociationMap.begin(), mIterEnd = clusterAssociationMap.end(); mIter != mIterEnd; ++mIter)
     {
         ClusterSet &forwardClusters = mIter->second.m_forwardAssociations;
@@ -217,13 +246,22 @@ void ClusterAssociationAlgorithm::UpdateForAmbiguousMerge(const Cluster *const p
         ClusterSet::iterator bIter = backwardClusters.find(pCluster);
 
         if (forwardClusters.end() != fIter)
+        {
             forwardClusters.erase(fIter);
+            (void)changedClusters.insert(mIter->first);
+        }
 
         if (backwardClusters.end() != bIter)
+        {
             backwardClusters.erase(bIter);
+            (void)changedClusters.insert(mIter->first);
+        }
     }
 
     clusterAssociationMap.erase(pCluster);
+
+    if (m_useWorklist)
+        this->FlagModifiedClusters(changedClusters, clusterAssociationMap);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -251,11 +289,44 @@ void ClusterAssociationAlgorithm::NavigateAlongAssociations(const ClusterAssocia
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ClusterAssociationAlgorithm::FlagModifiedClusters(
+    const ClusterSet &changedClusters, const ClusterAssociationMap &clusterAssociationMap) const
+{
+    if (changedClusters.empty())
+        return;
+
+    m_modifiedClusters.insert(changedClusters.begin(), changedClusters.end());
+
+    // Propagation from a cluster also depends on the associations of the clusters with which it is associated
+    for (const ClusterAssociationMap::value_type &mapEntry : clusterAssociationMap)
+    {
+        if (m_modifiedClusters.count(mapEntry.first))
+            continue;
+
+        for (const ClusterSet *const pClusterSet : {&mapEntry.second.m_forwardAssociations, &mapEntry.second.m_backwardAssociations})
+        {
+            for (const Cluster *const pAssociatedCluster : *pClusterSet)
+            {
+                if (changedClusters.count(pAssociatedCluster))
+                {
+                    (void)m_modifiedClusters.insert(mapEntry.first);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterAssociationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "ResolveAmbiguousAssociations", m_resolveAmbiguousAssociations));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseWorklist", m_useWorklist));
+
     return STATUS_CODE_SUCCESS;
 }
 
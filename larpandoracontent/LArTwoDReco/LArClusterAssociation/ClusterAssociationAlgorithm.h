@@ -120,9 +120,20 @@ private:
     void NavigateAlongAssociations(const ClusterAssociationMap &clusterAssociationMap, const pandora::Cluster *const pCluster,
         const bool isForward, const pandora::Cluster *&pExtremalCluster, pandora::ClusterSet &clusterSet) const;
 
+    /**
+     *  @brief  Flag the clusters whose unambiguous propagation may have changed, following changes to the associations of some clusters
+     *
+     *  @param  changedClusters the clusters whose associations have changed
+     *  @param  clusterAssociationMap the cluster association map
+     */
+    void FlagModifiedClusters(const pandora::ClusterSet &changedClusters, const ClusterAssociationMap &clusterAssociationMap) const;
+
     mutable bool m_mergeMade;
+    mutable pandora::ClusterSet m_modifiedClusters; ///< The clusters to revisit in the next unambiguous propagation pass (worklist mode)
+    mutable pandora::ClusterSet m_deletedClusters;  ///< The clusters deleted by merges in the current run (worklist mode)
 
     bool m_resolveAmbiguousAssociations; ///< Whether to resolve ambiguous associations
+    bool m_useWorklist;                  ///< Whether to revisit only clusters whose unambiguous propagation may have changed
 };
 
 } // namespace lar_content
@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArInstrumentationHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterMergingAlgorithm.h"
 
@@ -17,6 +18,12 @@ using namespace pandora;
 namespace lar_content
 {
 
+ClusterMergingAlgorithm::ClusterMergingAlgorithm() : m_useWorklist(false), m_worklistNeighbourDistance(50.f)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterMergingAlgorithm::Run()
 {
     const ClusterList *pClusterList = NULL;
@@ -39,19 +46,54 @@ StatusCode ClusterMergingAlgorithm::Run()
         return STATUS_CODE_SUCCESS;
     }
 
+    bool isFirstIteration(true);
+    ClusterSet touchedClusters;
+    ClusterBoundingBoxMap boundingBoxMap;
+
     while (true)
     {
         ClusterVector unsortedVector, clusterVector;
         this->GetListOfCleanClusters(pClusterList, unsortedVector);
         this->GetSortedListOfCleanClusters(unsortedVector, clusterVector);
 
+        ClusterVector activeClusterVector;
+
+        if (!m_useWorklist || isFirstIteration)
+        {
+            activeClusterVector = clusterVector;
+        }
+        else
+        {
+            this->GetWorklistClusters(clusterVector, touchedClusters, boundingBoxMap, activeClusterVector);
+        }
+
+        isFirstIteration = false;
+
+        LArInstrumentationHelper::AddToCounter(*this, "nClustersEvaluated", static_cast<double>(activeClusterVector.size()));
+        LArInstrumentationHelper::AddToCounter(
+            *this, "nClustersSkipped", static_cast<double>(clusterVector.size() - activeClusterVector.size()));
+
         ClusterMergeMap clusterMergeMap;
-        this->PopulateClusterMergeMap(clusterVector, clusterMergeMap);
+        this->PopulateClusterMergeMap(activeClusterVector, clusterMergeMap);
 
         if (clusterMergeMap.empty())
             break;
 
-        this->MergeClusters(clusterVector, clusterMergeMap);
+        if (m_useWorklist)
+        {
+            touchedClusters.clear();
+
+            for (const ClusterMergeMap::value_type &mapEntry : clusterMergeMap)
+            {
+                (void)touchedClusters.insert(mapEntry.first);
+                touchedClusters.insert(mapEntry.second.begin(), mapEntry.second.end());
+            }
+
+            for (const Cluster *const pTouchedCluster : touchedClusters)
+                (void)boundingBoxMap.erase(pTouchedCluster);
+        }
+
+        this->MergeClusters(activeClusterVector, clusterMergeMap);
     }
 
     return STATUS_CODE_SUCCESS;
@@ -159,11 +201,76 @@ void ClusterMergingAlgorithm::GetSortedListOfCleanClusters(const ClusterVector &
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ClusterMergingAlgorithm::GetWorklistClusters(const ClusterVector &clusterVector, const ClusterSet &touchedClusters,
+    ClusterBoundingBoxMap &boundingBoxMap, ClusterVector &activeClusterVector) const
+{
+    // ATTN Touched clusters deleted by the last merges are absent from the clean cluster vector; their hits now lie in a touched cluster
+    ClusterVector touchedClusterVector;
+
+    for (const Cluster *const pCluster : clusterVector)
+    {
+        if (touchedClusters.count(pCluster))
+            touchedClusterVector.push_back(pCluster);
+    }
+
+    for (const Cluster *const pCluster : clusterVector)
+    {
+        if (touchedClusters.count(pCluster))
+        {
+            activeClusterVector.push_back(pCluster);
+            continue;
+        }
+
+        const BoundingBox &boundingBox(this->GetBoundingBox(pCluster, boundingBoxMap));
+
+        for (const Cluster *const pTouchedCluster : touchedClusterVector)
+        {
+            const BoundingBox &touchedBoundingBox(this->GetBoundingBox(pTouchedCluster, boundingBoxMap));
+
+            const float deltaX(std::max(0.f, std::max(boundingBox.first.GetX() - touchedBoundingBox.second.GetX(),
+                                                  touchedBoundingBox.first.GetX() - boundingBox.second.GetX())));
+            const float deltaZ(std::max(0.f, std::max(boundingBox.first.GetZ() - touchedBoundingBox.second.GetZ(),
+                                                  touchedBoundingBox.first.GetZ() - boundingBox.second.GetZ())));
+
+            if ((deltaX < m_worklistNeighbourDistance) && (deltaZ < m_worklistNeighbourDistance))
+            {
+                activeClusterVector.push_back(pCluster);
+                break;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const ClusterMergingAlgorithm::BoundingBox &ClusterMergingAlgorithm::GetBoundingBox(
+    const Cluster *const pCluster, ClusterBoundingBoxMap &boundingBoxMap) const
+{
+    ClusterBoundingBoxMap::const_iterator iter(boundingBoxMap.find(pCluster));
+
+    if (boundingBoxMap.end() != iter)
+        return iter->second;
+
+    CartesianVector minimumCoordinate(0.f, 0.f, 0.f), maximumCoordinate(0.f, 0.f, 0.f);
+    LArClusterHelper::GetClusterBoundingBox(pCluster, minimumCoordinate, maximumCoordinate);
+
+    const BoundingBox boundingBox(minimumCoordinate, maximumCoordinate);
+    return boundingBoxMap.insert(ClusterBoundingBoxMap::value_type(pCluster, boundingBox)).first->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterMergingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListName", m_inputClusterListName));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseWorklist", m_useWorklist));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "WorklistNeighbourDistance", m_worklistNeighbourDistance));
+
     return STATUS_CODE_SUCCESS;
 }
 
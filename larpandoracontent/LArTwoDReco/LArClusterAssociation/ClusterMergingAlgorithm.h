@@ -11,6 +11,7 @@
 #include "Pandora/Algorithm.h"
 
 #include <unordered_map>
+#include <utility>
 
 namespace lar_content
 {
@@ -20,6 +21,12 @@ namespace lar_content
  */
 class ClusterMergingAlgorithm : public pandora::Algorithm
 {
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    ClusterMergingAlgorithm();
+
 protected:
     virtual pandora::StatusCode Run();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -81,6 +88,34 @@ protected:
     void GetSortedListOfCleanClusters(const pandora::ClusterVector &inputClusters, pandora::ClusterVector &outputClusters) const;
 
     std::string m_inputClusterListName; ///< The name of the input cluster list. If not specified, will access current list.
+
+private:
+    typedef std::pair<pandora::CartesianVector, pandora::CartesianVector> BoundingBox;
+    typedef std::unordered_map<const pandora::Cluster *, BoundingBox> ClusterBoundingBoxMap;
+
+    /**
+     *  @brief  Select the clean clusters to re-evaluate, i.e. those touched by the last merges and their spatial neighbours
+     *
+     *  @param  clusterVector the sorted vector of clean clusters
+     *  @param  touchedClusters the clusters touched by the last merges
+     *  @param  boundingBoxMap the cache of bounding boxes for unchanged clusters
+     *  @param  activeClusterVector to receive the clusters to re-evaluate, in the order of the input vector
+     */
+    void GetWorklistClusters(const pandora::ClusterVector &clusterVector, const pandora::ClusterSet &touchedClusters,
+        ClusterBoundingBoxMap &boundingBoxMap, pandora::ClusterVector &activeClusterVector) const;
+
+    /**
+     *  @brief  Get the bounding box of a cluster, using the cache where possible
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  boundingBoxMap the cache of bounding boxes for unchanged clusters
+     *
+     *  @return the minimum and maximum coordinates of the bounding box
+     */
+    const BoundingBox &GetBoundingBox(const pandora::Cluster *const pCluster, ClusterBoundingBoxMap &boundingBoxMap) const;
+
+    bool m_useWorklist;                ///< Whether to re-evaluate only clusters touched by the last merges, and their neighbours
+    float m_worklistNeighbourDistance; ///< The max. bounding box separation for a cluster to neighbour a touched cluster
 };
 
 } // namespace lar_content
@@ -36,19 +36,24 @@ StatusCode TrackClusterCreationAlgorithm::Run()
     OrderedCaloHitList selectedCaloHitList, rejectedCaloHitList;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->FilterCaloHits(pCaloHitList, selectedCaloHitList, rejectedCaloHitList));
 
-    HitAssociationMap forwardHitAssociationMap, backwardHitAssociationMap;
-    this->MakePrimaryAssociations(selectedCaloHitList, forwardHitAssociationMap, backwardHitAssociationMap);
-    this->MakeSecondaryAssociations(selectedCaloHitList, forwardHitAssociationMap, backwardHitAssociationMap);
+    // All hit bookkeeping below is keyed by dense hit ids, so that lookups are array accesses rather than pointer hash lookups
+    const CaloHitIndex caloHitIndex(*pCaloHitList);
+    const HitAssociation noHitAssociation(0, std::numeric_limits<float>::max());
 
-    HitJoinMap hitJoinMap;
-    HitToClusterMap hitToClusterMap;
-    this->IdentifyJoins(selectedCaloHitList, forwardHitAssociationMap, backwardHitAssociationMap, hitJoinMap);
-    this->CreateClusters(selectedCaloHitList, hitJoinMap, hitToClusterMap);
+    HitAssociationMap forwardHitAssociationMap(caloHitIndex, noHitAssociation), backwardHitAssociationMap(caloHitIndex, noHitAssociation);
+    this->MakePrimaryAssociations(caloHitIndex, selectedCaloHitList, forwardHitAssociationMap, backwardHitAssociationMap);
+    this->MakeSecondaryAssociations(caloHitIndex, selectedCaloHitList, forwardHitAssociationMap, backwardHitAssociationMap);
+
+    HitJoinMap hitJoinMap(caloHitIndex);
+    HitToClusterMap hitToClusterMap(caloHitIndex, nullptr);
+    this->IdentifyJoins(caloHitIndex, selectedCaloHitList, forwardHitAssociationMap, backwardHitAssociationMap, hitJoinMap);
+    this->CreateClusters(caloHitIndex, selectedCaloHitList, hitJoinMap, hitToClusterMap);
 
     if (!m_mergeBackFilteredHits)
-        this->CreateClusters(rejectedCaloHitList, hitJoinMap, hitToClusterMap);
+        this->CreateClusters(caloHitIndex, rejectedCaloHitList, hitJoinMap, hitToClusterMap);
 
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->AddFilteredCaloHits(selectedCaloHitList, rejectedCaloHitList, hitToClusterMap));
+    PANDORA_RETURN_RESULT_IF(
+        STATUS_CODE_SUCCESS, !=, this->AddFilteredCaloHits(caloHitIndex, selectedCaloHitList, rejectedCaloHitList, hitToClusterMap));
 
     return STATUS_CODE_SUCCESS;
 }
@@ -104,42 +109,47 @@ StatusCode TrackClusterCreationAlgorithm::FilterCaloHits(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(
+StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(const CaloHitIndex &caloHitIndex,
     const OrderedCaloHitList &selectedCaloHitList, const OrderedCaloHitList &rejectedCaloHitList, HitToClusterMap &hitToClusterMap) const
 {
+    // ATTN Each hit lies in a single layer, so one set of unavailable hits can serve all layers
+    CaloHitIdSet unavailableHitIds(caloHitIndex);
+
     for (OrderedCaloHitList::const_iterator iter = rejectedCaloHitList.begin(), iterEnd = rejectedCaloHitList.end(); iter != iterEnd; ++iter)
     {
         CaloHitList *pCaloHitList = NULL;
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, selectedCaloHitList.GetCaloHitsInPseudoLayer(iter->first, pCaloHitList));
 
-        CaloHitSet unavailableHits;
+        CaloHitIdVector inputAvailableHitIds;
+        this->GetSortedCaloHitIds(caloHitIndex, *iter->second, inputAvailableHitIds);
 
-        CaloHitVector inputAvailableHits(iter->second->begin(), iter->second->end());
-        std::sort(inputAvailableHits.begin(), inputAvailableHits.end(), LArClusterHelper::SortHitsByPosition);
-
-        CaloHitVector clusteredHits(pCaloHitList->begin(), pCaloHitList->end());
-        std::sort(clusteredHits.begin(), clusteredHits.end(), LArClusterHelper::SortHitsByPosition);
+        CaloHitIdVector clusteredHitIds;
+        this->GetSortedCaloHitIds(caloHitIndex, *pCaloHitList, clusteredHitIds);
 
         bool carryOn(true);
 
         while (carryOn)
         {
             carryOn = false;
-            CaloHitVector newClusteredHits;
+            CaloHitIdVector newClusteredHitIds;
 
-            for (const CaloHit *const pCaloHitI : inputAvailableHits)
+            for (const unsigned int hitIdI : inputAvailableHitIds)
             {
-                if (unavailableHits.count(pCaloHitI))
+                if (unavailableHitIds.Contains(hitIdI))
                     continue;
 
-                if (hitToClusterMap.end() != hitToClusterMap.find(pCaloHitI))
+                if (hitToClusterMap.Contains(hitIdI))
                     continue;
 
-                const CaloHit *pClosestHit = NULL;
+                const CaloHit *const pCaloHitI(caloHitIndex.GetCaloHit(hitIdI));
+                bool foundClosestHit(false);
+                unsigned int closestHitId(0);
                 float closestSeparationSquared(m_minCaloHitSeparationSquared);
 
-                for (const CaloHit *const pCaloHitJ : clusteredHits)
+                for (const unsigned int hitIdJ : clusteredHitIds)
                 {
+                    const CaloHit *const pCaloHitJ(caloHitIndex.GetCaloHit(hitIdJ));
+
                     if (pCaloHitI->GetMipEquivalentEnergy() > pCaloHitJ->GetMipEquivalentEnergy())
                         continue;
 
@@ -148,30 +158,29 @@ StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(
                     if (separationSquared < closestSeparationSquared)
                     {
                         closestSeparationSquared = separationSquared;
-                        pClosestHit = pCaloHitJ;
+                        closestHitId = hitIdJ;
+                        foundClosestHit = true;
                     }
                 }
 
-                if (!pClosestHit)
+                if (!foundClosestHit)
                     continue;
 
-                HitToClusterMap::const_iterator mapIter = hitToClusterMap.find(pClosestHit);
-
-                if (hitToClusterMap.end() == mapIter)
+                if (!hitToClusterMap.Contains(closestHitId))
                     throw StatusCodeException(STATUS_CODE_FAILURE);
 
-                const Cluster *const pCluster = mapIter->second;
+                const Cluster *const pCluster = hitToClusterMap.Get(closestHitId);
                 PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::AddToCluster(*this, pCluster, pCaloHitI));
-                (void)hitToClusterMap.insert(HitToClusterMap::value_type(pCaloHitI, pCluster));
+                hitToClusterMap.Set(hitIdI, pCluster);
 
-                newClusteredHits.push_back(pCaloHitI);
+                newClusteredHitIds.push_back(hitIdI);
                 carryOn = true;
             }
 
-            for (const CaloHit *const pCaloHit : newClusteredHits)
+            for (const unsigned int hitId : newClusteredHitIds)
             {
-                clusteredHits.push_back(pCaloHit);
-                unavailableHits.insert(pCaloHit);
+                clusteredHitIds.push_back(hitId);
+                unavailableHitIds.Insert(hitId);
             }
         }
     }
@@ -181,15 +190,15 @@ StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const OrderedCaloHitList &orderedCaloHitList,
+void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const CaloHitIndex &caloHitIndex, const OrderedCaloHitList &orderedCaloHitList,
     HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const
 {
     for (OrderedCaloHitList::const_iterator iterI = orderedCaloHitList.begin(), iterIEnd = orderedCaloHitList.end(); iterI != iterIEnd; ++iterI)
     {
         unsigned int nLayersConsidered(0);
 
-        CaloHitVector caloHitsI(iterI->second->begin(), iterI->second->end());
-        std::sort(caloHitsI.begin(), caloHitsI.end(), LArClusterHelper::SortHitsByPosition);
+        CaloHitIdVector caloHitIdsI;
+        this->GetSortedCaloHitIds(caloHitIndex, *iterI->second, caloHitIdsI);
 
         for (OrderedCaloHitList::const_iterator iterJ = iterI, iterJEnd = orderedCaloHitList.end();
              (nLayersConsidered++ <= m_maxGapLayers + 1) && (iterJ != iterJEnd); ++iterJ)
@@ -197,13 +206,13 @@ void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const OrderedCaloHit
             if (iterJ->first == iterI->first || iterJ->first > iterI->first + m_maxGapLayers + 1)
                 continue;
 
-            CaloHitVector caloHitsJ(iterJ->second->begin(), iterJ->second->end());
-            std::sort(caloHitsJ.begin(), caloHitsJ.end(), LArClusterHelper::SortHitsByPosition);
+            CaloHitIdVector caloHitIdsJ;
+            this->GetSortedCaloHitIds(caloHitIndex, *iterJ->second, caloHitIdsJ);
 
-            for (const CaloHit *const pCaloHitI : caloHitsI)
+            for (const unsigned int hitIdI : caloHitIdsI)
             {
-                for (const CaloHit *const pCaloHitJ : caloHitsJ)
-                    this->CreatePrimaryAssociation(pCaloHitI, pCaloHitJ, forwardHitAssociationMap, backwardHitAssociationMap);
+                for (const unsigned int hitIdJ : caloHitIdsJ)
+                    this->CreatePrimaryAssociation(caloHitIndex, hitIdI, hitIdJ, forwardHitAssociationMap, backwardHitAssociationMap);
             }
         }
     }
@@ -211,229 +220,238 @@ void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const OrderedCaloHit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TrackClusterCreationAlgorithm::MakeSecondaryAssociations(const OrderedCaloHitList &orderedCaloHitList,
-    HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const
+void TrackClusterCreationAlgorithm::MakeSecondaryAssociations(const CaloHitIndex &caloHitIndex,
+    const OrderedCaloHitList &orderedCaloHitList, HitAssociationMap &forwardHitAssociationMap,
+    HitAssociationMap &backwardHitAssociationMap) const
 {
     for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
     {
-        CaloHitVector caloHits(iter->second->begin(), iter->second->end());
-        std::sort(caloHits.begin(), caloHits.end(), LArClusterHelper::SortHitsByPosition);
+        CaloHitIdVector caloHitIds;
+        this->GetSortedCaloHitIds(caloHitIndex, *iter->second, caloHitIds);
 
-        for (const CaloHit *const pCaloHit : caloHits)
+        for (const unsigned int hitId : caloHitIds)
         {
-            HitAssociationMap::const_iterator fwdIter = forwardHitAssociationMap.find(pCaloHit);
-            const CaloHit *const pForwardHit((forwardHitAssociationMap.end() == fwdIter) ? NULL : fwdIter->second.GetPrimaryTarget());
-
-            HitAssociationMap::const_iterator fwdCheckIter = backwardHitAssociationMap.find(pForwardHit);
-            const CaloHit *const pForwardHitCheck((backwardHitAssociationMap.end() == fwdCheckIter) ? NULL : fwdCheckIter->second.GetPrimaryTarget());
-
-            if ((NULL != pForwardHit) && (pForwardHitCheck != pCaloHit))
-                this->CreateSecondaryAssociation(pCaloHit, pForwardHit, forwardHitAssociationMap, backwardHitAssociationMap);
+            if (forwardHitAssociationMap.Contains(hitId))
+            {
+                const unsigned int forwardHitId(forwardHitAssociationMap.Get(hitId).GetPrimaryTargetId());
+                const bool isForwardHitChecked(backwardHitAssociationMap.Contains(forwardHitId) &&
+                    (backwardHitAssociationMap.Get(forwardHitId).GetPrimaryTargetId() == hitId));
 
-            HitAssociationMap::const_iterator bwdIter = backwardHitAssociationMap.find(pCaloHit);
-            const CaloHit *const pBackwardHit((backwardHitAssociationMap.end() == bwdIter) ? NULL : bwdIter->second.GetPrimaryTarget());
+                if (!isForwardHitChecked)
+                    this->CreateSecondaryAssociation(hitId, forwardHitId, forwardHitAssociationMap, backwardHitAssociationMap);
+            }
 
-            HitAssociationMap::const_iterator bwdCheckIter = forwardHitAssociationMap.find(pBackwardHit);
-            const CaloHit *const pBackwardHitCheck((forwardHitAssociationMap.end() == bwdCheckIter) ? NULL : bwdCheckIter->second.GetPrimaryTarget());
+            if (backwardHitAssociationMap.Contains(hitId))
+            {
+                const unsigned int backwardHitId(backwardHitAssociationMap.Get(hitId).GetPrimaryTargetId());
+                const bool isBackwardHitChecked(forwardHitAssociationMap.Contains(backwardHitId) &&
+                    (forwardHitAssociationMap.Get(backwardHitId).GetPrimaryTargetId() == hitId));
 
-            if ((NULL != pBackwardHit) && (pBackwardHitCheck != pCaloHit))
-                this->CreateSecondaryAssociation(pBackwardHit, pCaloHit, forwardHitAssociationMap, backwardHitAssociationMap);
+                if (!isBackwardHitChecked)
+                    this->CreateSecondaryAssociation(backwardHitId, hitId, forwardHitAssociationMap, backwardHitAssociationMap);
+            }
         }
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TrackClusterCreationAlgorithm::IdentifyJoins(const OrderedCaloHitList &orderedCaloHitList,
+void TrackClusterCreationAlgorithm::IdentifyJoins(const CaloHitIndex &caloHitIndex, const OrderedCaloHitList &orderedCaloHitList,
     const HitAssociationMap &forwardHitAssociationMap, const HitAssociationMap &backwardHitAssociationMap, HitJoinMap &hitJoinMap) const
 {
     for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
     {
-        CaloHitVector caloHits(iter->second->begin(), iter->second->end());
-        std::sort(caloHits.begin(), caloHits.end(), LArClusterHelper::SortHitsByPosition);
+        CaloHitIdVector caloHitIds;
+        this->GetSortedCaloHitIds(caloHitIndex, *iter->second, caloHitIds);
 
-        for (const CaloHit *const pCaloHit : caloHits)
+        for (const unsigned int hitId : caloHitIds)
         {
-            const CaloHit *const pForwardJoinHit = this->GetJoinHit(pCaloHit, forwardHitAssociationMap, backwardHitAssociationMap);
-            const CaloHit *const pBackwardJoinHit = this->GetJoinHit(pForwardJoinHit, backwardHitAssociationMap, forwardHitAssociationMap);
+            unsigned int forwardJoinHitId(0), backwardJoinHitId(0);
 
-            if ((NULL == pForwardJoinHit) || (NULL == pBackwardJoinHit) || (pBackwardJoinHit != pCaloHit))
+            if (!this->GetJoinHit(hitId, forwardHitAssociationMap, backwardHitAssociationMap, forwardJoinHitId) ||
+                !this->GetJoinHit(forwardJoinHitId, backwardHitAssociationMap, forwardHitAssociationMap, backwardJoinHitId) ||
+                (backwardJoinHitId != hitId))
+            {
                 continue;
+            }
 
-            HitJoinMap::const_iterator joinIter = hitJoinMap.find(pCaloHit);
-
-            if (hitJoinMap.end() == joinIter)
-                hitJoinMap.insert(HitJoinMap::value_type(pCaloHit, pForwardJoinHit));
-
-            if ((hitJoinMap.end() != joinIter) && (joinIter->second != pForwardJoinHit))
+            if (!hitJoinMap.Contains(hitId))
+            {
+                hitJoinMap.Set(hitId, forwardJoinHitId);
+            }
+            else if (hitJoinMap.Get(hitId) != forwardJoinHitId)
+            {
                 throw StatusCodeException(STATUS_CODE_FAILURE);
+            }
         }
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TrackClusterCreationAlgorithm::CreateClusters(
-    const OrderedCaloHitList &orderedCaloHitList, const HitJoinMap &hitJoinMap, HitToClusterMap &hitToClusterMap) const
+void TrackClusterCreationAlgorithm::CreateClusters(const CaloHitIndex &caloHitIndex, const OrderedCaloHitList &orderedCaloHitList,
+    const HitJoinMap &hitJoinMap, HitToClusterMap &hitToClusterMap) const
 {
     for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
     {
-        CaloHitVector caloHits(iter->second->begin(), iter->second->end());
-        std::sort(caloHits.begin(), caloHits.end(), LArClusterHelper::SortHitsByPosition);
+        CaloHitIdVector caloHitIds;
+        this->GetSortedCaloHitIds(caloHitIndex, *iter->second, caloHitIds);
 
-        for (const CaloHit *const pCaloHit : caloHits)
+        for (const unsigned int hitId : caloHitIds)
         {
             const Cluster *pCluster = NULL;
 
-            HitToClusterMap::const_iterator mapIter = hitToClusterMap.find(pCaloHit);
-
-            if (hitToClusterMap.end() == mapIter)
+            if (!hitToClusterMap.Contains(hitId))
             {
                 PandoraContentApi::Cluster::Parameters parameters;
-                parameters.m_caloHitList.push_back(pCaloHit);
+                parameters.m_caloHitList.push_back(caloHitIndex.GetCaloHit(hitId));
                 PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(*this, parameters, pCluster));
-                hitToClusterMap.insert(HitToClusterMap::value_type(pCaloHit, pCluster));
+                hitToClusterMap.Set(hitId, pCluster);
             }
             else
             {
-                pCluster = mapIter->second;
+                pCluster = hitToClusterMap.Get(hitId);
             }
 
-            HitJoinMap::const_iterator joinIter = hitJoinMap.find(pCaloHit);
-
-            if (hitJoinMap.end() == joinIter)
+            if (!hitJoinMap.Contains(hitId))
                 continue;
 
-            if (hitToClusterMap.end() != hitToClusterMap.find(joinIter->second))
+            const unsigned int joinHitId(hitJoinMap.Get(hitId));
+
+            if (hitToClusterMap.Contains(joinHitId))
                 throw StatusCodeException(STATUS_CODE_FAILURE);
 
-            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::AddToCluster(*this, pCluster, joinIter->second));
-            hitToClusterMap.insert(HitToClusterMap::value_type(joinIter->second, pCluster));
+            PANDORA_THROW_RESULT_IF(
+                STATUS_CODE_SUCCESS, !=, PandoraContentApi::AddToCluster(*this, pCluster, caloHitIndex.GetCaloHit(joinHitId)));
+            hitToClusterMap.Set(joinHitId, pCluster);
         }
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TrackClusterCreationAlgorithm::CreatePrimaryAssociation(const CaloHit *const pCaloHitI, const CaloHit *const pCaloHitJ,
-    HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const
+void TrackClusterCreationAlgorithm::CreatePrimaryAssociation(const CaloHitIndex &caloHitIndex, const unsigned int hitIdI,
+    const unsigned int hitIdJ, HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const
 {
-    const float distanceSquared((pCaloHitJ->GetPositionVector() - pCaloHitI->GetPositionVector()).GetMagnitudeSquared());
+    const CartesianVector &positionI(caloHitIndex.GetCaloHit(hitIdI)->GetPositionVector());
+    const CartesianVector &positionJ(caloHitIndex.GetCaloHit(hitIdJ)->GetPositionVector());
+    const float distanceSquared((positionJ - positionI).GetMagnitudeSquared());
 
     if (distanceSquared > m_maxCaloHitSeparationSquared)
         return;
 
-    HitAssociationMap::iterator forwardIter = forwardHitAssociationMap.find(pCaloHitI);
+    if (!forwardHitAssociationMap.Contains(hitIdI) || (distanceSquared < forwardHitAssociationMap.Get(hitIdI).GetPrimaryDistanceSquared()))
+        forwardHitAssociationMap.Set(hitIdI, HitAssociation(hitIdJ, distanceSquared));
 
-    if (forwardHitAssociationMap.end() == forwardIter)
+    if (!backwardHitAssociationMap.Contains(hitIdJ) ||
+        (distanceSquared < backwardHitAssociationMap.Get(hitIdJ).GetPrimaryDistanceSquared()))
     {
-        forwardHitAssociationMap.insert(HitAssociationMap::value_type(pCaloHitI, HitAssociation(pCaloHitJ, distanceSquared)));
-    }
-    else if (distanceSquared < forwardIter->second.GetPrimaryDistanceSquared())
-    {
-        forwardIter->second = HitAssociation(pCaloHitJ, distanceSquared);
-    }
-
-    HitAssociationMap::iterator backwardIter = backwardHitAssociationMap.find(pCaloHitJ);
-
-    if (backwardHitAssociationMap.end() == backwardIter)
-    {
-        backwardHitAssociationMap.insert(HitAssociationMap::value_type(pCaloHitJ, HitAssociation(pCaloHitI, distanceSquared)));
-    }
-    else if (distanceSquared < backwardIter->second.GetPrimaryDistanceSquared())
-    {
-        backwardIter->second = HitAssociation(pCaloHitI, distanceSquared);
+        backwardHitAssociationMap.Set(hitIdJ, HitAssociation(hitIdI, distanceSquared));
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TrackClusterCreationAlgorithm::CreateSecondaryAssociation(const CaloHit *const pCaloHitI, const CaloHit *const pCaloHitJ,
+void TrackClusterCreationAlgorithm::CreateSecondaryAssociation(const unsigned int hitIdI, const unsigned int hitIdJ,
     HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const
 {
-    HitAssociationMap::iterator forwardIter = forwardHitAssociationMap.find(pCaloHitI);
-    HitAssociationMap::iterator backwardIter = backwardHitAssociationMap.find(pCaloHitJ);
-
-    if ((forwardHitAssociationMap.end() == forwardIter) || (backwardHitAssociationMap.end() == backwardIter))
+    if (!forwardHitAssociationMap.Contains(hitIdI) || !backwardHitAssociationMap.Contains(hitIdJ))
         return;
 
-    HitAssociation &forwardAssociation(forwardIter->second);
-    HitAssociation &backwardAssociation(backwardIter->second);
+    HitAssociation &forwardAssociation(forwardHitAssociationMap.Get(hitIdI));
+    HitAssociation &backwardAssociation(backwardHitAssociationMap.Get(hitIdJ));
 
-    if ((forwardAssociation.GetPrimaryTarget() != pCaloHitJ) && (backwardAssociation.GetPrimaryTarget() == pCaloHitI))
+    if ((forwardAssociation.GetPrimaryTargetId() != hitIdJ) && (backwardAssociation.GetPrimaryTargetId() == hitIdI))
     {
         if ((backwardAssociation.GetPrimaryDistanceSquared() < forwardAssociation.GetSecondaryDistanceSquared()) &&
             (backwardAssociation.GetPrimaryDistanceSquared() < m_closeSeparationSquared))
         {
-            forwardAssociation.SetSecondaryTarget(pCaloHitJ, backwardAssociation.GetPrimaryDistanceSquared());
+            forwardAssociation.SetSecondaryTarget(hitIdJ, backwardAssociation.GetPrimaryDistanceSquared());
         }
     }
 
-    if ((backwardAssociation.GetPrimaryTarget() != pCaloHitI) && (forwardAssociation.GetPrimaryTarget() == pCaloHitJ))
+    if ((backwardAssociation.GetPrimaryTargetId() != hitIdI) && (forwardAssociation.GetPrimaryTargetId() == hitIdJ))
     {
         if ((forwardAssociation.GetPrimaryDistanceSquared() < backwardAssociation.GetSecondaryDistanceSquared()) &&
             (forwardAssociation.GetPrimaryDistanceSquared() < m_closeSeparationSquared))
         {
-            backwardAssociation.SetSecondaryTarget(pCaloHitI, forwardAssociation.GetPrimaryDistanceSquared());
+            backwardAssociation.SetSecondaryTarget(hitIdI, forwardAssociation.GetPrimaryDistanceSquared());
         }
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-const CaloHit *TrackClusterCreationAlgorithm::GetJoinHit(
-    const CaloHit *const pCaloHit, const HitAssociationMap &hitAssociationMapI, const HitAssociationMap &hitAssociationMapJ) const
+bool TrackClusterCreationAlgorithm::GetJoinHit(const unsigned int hitId, const HitAssociationMap &hitAssociationMapI,
+    const HitAssociationMap &hitAssociationMapJ, unsigned int &joinHitId) const
 {
-    HitAssociationMap::const_iterator iterI = hitAssociationMapI.find(pCaloHit);
+    if (!hitAssociationMapI.Contains(hitId))
+        return false;
 
-    if (hitAssociationMapI.end() == iterI)
-        return NULL;
+    const HitAssociation &hitAssociation(hitAssociationMapI.Get(hitId));
+    const unsigned int primaryTargetId(hitAssociation.GetPrimaryTargetId());
 
-    const CaloHit *const pPrimaryTarget = iterI->second.GetPrimaryTarget();
-    const CaloHit *const pSecondaryTarget = iterI->second.GetSecondaryTarget();
-
-    if (NULL == pSecondaryTarget)
-        return pPrimaryTarget;
+    if (!hitAssociation.HasSecondaryTarget())
+    {
+        joinHitId = primaryTargetId;
+        return true;
+    }
 
     unsigned int primaryNSteps(0), secondaryNSteps(0);
-    const CaloHit *const pPrimaryTrace = this->TraceHitAssociation(pPrimaryTarget, hitAssociationMapI, hitAssociationMapJ, primaryNSteps);
-    const CaloHit *const pSecondaryTrace = this->TraceHitAssociation(pSecondaryTarget, hitAssociationMapI, hitAssociationMapJ, secondaryNSteps);
+    const unsigned int primaryTraceId(this->TraceHitAssociation(primaryTargetId, hitAssociationMapI, hitAssociationMapJ, primaryNSteps));
+    const unsigned int secondaryTraceId(
+        this->TraceHitAssociation(hitAssociation.GetSecondaryTargetId(), hitAssociationMapI, hitAssociationMapJ, secondaryNSteps));
 
-    if ((pPrimaryTrace == pSecondaryTrace) || (secondaryNSteps < 5))
-        return pPrimaryTarget;
+    if ((primaryTraceId == secondaryTraceId) || (secondaryNSteps < 5))
+    {
+        joinHitId = primaryTargetId;
+        return true;
+    }
 
-    return NULL;
+    return false;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-const CaloHit *TrackClusterCreationAlgorithm::TraceHitAssociation(const CaloHit *const pCaloHit,
-    const HitAssociationMap &hitAssociationMapI, const HitAssociationMap &hitAssociationMapJ, unsigned int &nSteps) const
+unsigned int TrackClusterCreationAlgorithm::TraceHitAssociation(const unsigned int hitId, const HitAssociationMap &hitAssociationMapI,
+    const HitAssociationMap &hitAssociationMapJ, unsigned int &nSteps) const
 {
     nSteps = 0;
-    const CaloHit *pThisHit = pCaloHit;
-    const CaloHit *pLastHit = pCaloHit;
+    unsigned int thisHitId(hitId);
+    unsigned int lastHitId(hitId);
 
     while (true)
     {
         ++nSteps;
-        pThisHit = pLastHit;
-        HitAssociationMap::const_iterator iterI = hitAssociationMapI.find(pThisHit);
+        thisHitId = lastHitId;
 
-        if (hitAssociationMapI.end() == iterI)
+        if (!hitAssociationMapI.Contains(thisHitId))
             break;
 
-        pLastHit = iterI->second.GetPrimaryTarget();
-        HitAssociationMap::const_iterator iterJ = hitAssociationMapJ.find(pLastHit);
+        lastHitId = hitAssociationMapI.Get(thisHitId).GetPrimaryTargetId();
 
-        if (hitAssociationMapJ.end() == iterJ)
+        if (!hitAssociationMapJ.Contains(lastHitId))
             break;
 
-        if (iterJ->second.GetPrimaryTarget() != pThisHit)
+        if (hitAssociationMapJ.Get(lastHitId).GetPrimaryTargetId() != thisHitId)
             break;
     }
 
-    return pThisHit;
+    return thisHitId;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackClusterCreationAlgorithm::GetSortedCaloHitIds(
+    const CaloHitIndex &caloHitIndex, const CaloHitList &caloHitList, CaloHitIdVector &caloHitIds) const
+{
+    CaloHitVector caloHits(caloHitList.begin(), caloHitList.end());
+    std::sort(caloHits.begin(), caloHits.end(), LArClusterHelper::SortHitsByPosition);
+
+    caloHitIds.reserve(caloHitIds.size() + caloHits.size());
+
+    for (const CaloHit *const pCaloHit : caloHits)
+        caloHitIds.push_back(caloHitIndex.GetId(pCaloHit));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -10,7 +10,7 @@
 
 #include "Pandora/Algorithm.h"
 
-#include <unordered_map>
+#include "larpandoracontent/LArObjects/LArCaloHitIndex.h"
 
 namespace lar_content
 {
@@ -36,32 +36,39 @@ private:
         /**
          *  @brief  Constructor
          *
-         *  @param  pPrimaryTarget address of the primary target hit
+         *  @param  primaryTargetId id of the primary target hit
          *  @param  primaryDistanceSquared distance to the primary target hit squared
          */
-        HitAssociation(const pandora::CaloHit *const pPrimaryTarget, const float primaryDistanceSquared);
+        HitAssociation(const unsigned int primaryTargetId, const float primaryDistanceSquared);
 
         /**
          *  @brief  Set secondary target
          *
-         *  @param  pSecondaryTarget address of the secondary target hit
+         *  @param  secondaryTargetId id of the secondary target hit
          *  @param  secondaryDistanceSquared distance to the primary target hit squared
          */
-        void SetSecondaryTarget(const pandora::CaloHit *const pSecondaryTarget, const float secondaryDistanceSquared);
+        void SetSecondaryTarget(const unsigned int secondaryTargetId, const float secondaryDistanceSquared);
 
         /**
-         *  @brief  Get the primary target
+         *  @brief  Get the primary target id
          *
-         *  @return the target distance
+         *  @return the primary target id
          */
-        const pandora::CaloHit *GetPrimaryTarget() const;
+        unsigned int GetPrimaryTargetId() const;
 
         /**
-         *  @brief  Get the secondary target
+         *  @brief  Whether a secondary target has been set
          *
-         *  @return the secondary target
+         *  @return boolean
          */
-        const pandora::CaloHit *GetSecondaryTarget() const;
+        bool HasSecondaryTarget() const;
+
+        /**
+         *  @brief  Get the secondary target id
+         *
+         *  @return the secondary target id
+         */
+        unsigned int GetSecondaryTargetId() const;
 
         /**
          *  @brief  Get the primary distance squared
@@ -78,15 +85,16 @@ private:
         float GetSecondaryDistanceSquared() const;
 
     private:
-        const pandora::CaloHit *m_pPrimaryTarget;   ///< the primary target
-        const pandora::CaloHit *m_pSecondaryTarget; ///< the secondary target
-        float m_primaryDistanceSquared;             ///< the primary distance squared
-        float m_secondaryDistanceSquared;           ///< the secondary distance squared
+        unsigned int m_primaryTargetId;   ///< the primary target id
+        unsigned int m_secondaryTargetId; ///< the secondary target id
+        bool m_hasSecondaryTarget;        ///< whether a secondary target has been set
+        float m_primaryDistanceSquared;   ///< the primary distance squared
+        float m_secondaryDistanceSquared; ///< the secondary distance squared
     };
 
-    typedef std::unordered_map<const pandora::CaloHit *, HitAssociation> HitAssociationMap;
-    typedef std::unordered_map<const pandora::CaloHit *, const pandora::CaloHit *> HitJoinMap;
-    typedef std::unordered_map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
+    typedef CaloHitIdMap<HitAssociation> HitAssociationMap;
+    typedef CaloHitIdMap<unsigned int> HitJoinMap;
+    typedef CaloHitIdMap<const pandora::Cluster *> HitToClusterMap;
 
     pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -104,100 +112,118 @@ private:
     /**
      *  @brief  Merge previously filtered hits back into their associated clusters
      *
+     *  @param  caloHitIndex the index of the input hits
      *  @param  selectedCaloHitList the ordered list of selected hits
      *  @param  rejectedCaloHitList the ordered list of rejected hits
      *  @param  hitToClusterMap the mapping between hits and their clusters
      */
-    pandora::StatusCode AddFilteredCaloHits(const pandora::OrderedCaloHitList &selectedCaloHitList,
+    pandora::StatusCode AddFilteredCaloHits(const CaloHitIndex &caloHitIndex, const pandora::OrderedCaloHitList &selectedCaloHitList,
         const pandora::OrderedCaloHitList &rejectedCaloHitList, HitToClusterMap &hitToClusterMap) const;
 
     /**
      *  @brief  Control primary association formation
      *
+     *  @param  caloHitIndex the index of the input hits
      *  @param  orderedCaloHitList the ordered calo hit list
      *  @param  forwardHitAssociationMap the forward hit association map
      *  @param  backwardHitAssociationMap the backward hit association map
      */
-    void MakePrimaryAssociations(const pandora::OrderedCaloHitList &orderedCaloHitList, HitAssociationMap &forwardHitAssociationMap,
-        HitAssociationMap &backwardHitAssociationMap) const;
+    void MakePrimaryAssociations(const CaloHitIndex &caloHitIndex, const pandora::OrderedCaloHitList &orderedCaloHitList,
+        HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const;
 
     /**
      *  @brief  Control secondary association formation
      *
+     *  @param  caloHitIndex the index of the input hits
      *  @param  orderedCaloHitList the ordered calo hit list
      *  @param  forwardHitAssociationMap the forward hit association map
      *  @param  backwardHitAssociationMap the backward hit association map
      */
-    void MakeSecondaryAssociations(const pandora::OrderedCaloHitList &orderedCaloHitList, HitAssociationMap &forwardHitAssociationMap,
-        HitAssociationMap &backwardHitAssociationMap) const;
+    void MakeSecondaryAssociations(const CaloHitIndex &caloHitIndex, const pandora::OrderedCaloHitList &orderedCaloHitList,
+        HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const;
 
     /**
      *  @brief  Identify final hit joins for use in cluster formation
      *
+     *  @param  caloHitIndex the index of the input hits
      *  @param  orderedCaloHitList the ordered calo hit list
      *  @param  forwardHitAssociationMap the forward hit association map
      *  @param  backwardHitAssociationMap the backward hit association map
      *  @param  hitJoinMap to receive the hit join map
      */
-    void IdentifyJoins(const pandora::OrderedCaloHitList &orderedCaloHitList, const HitAssociationMap &forwardHitAssociationMap,
-        const HitAssociationMap &backwardHitAssociationMap, HitJoinMap &hitJoinMap) const;
+    void IdentifyJoins(const CaloHitIndex &caloHitIndex, const pandora::OrderedCaloHitList &orderedCaloHitList,
+        const HitAssociationMap &forwardHitAssociationMap, const HitAssociationMap &backwardHitAssociationMap,
+        HitJoinMap &hitJoinMap) const;
 
     /**
      *  @brief  Final cluster formation
      *
+     *  @param  caloHitIndex the index of the input hits
      *  @param  orderedCaloHitList the ordered calo hit list
      *  @param  hitJoinMap the hit join map
      *  @param  hitToClusterMap the mapping between hits and their clusters
      */
-    void CreateClusters(const pandora::OrderedCaloHitList &orderedCaloHitList, const HitJoinMap &hitJoinMap, HitToClusterMap &hitToClusterMap) const;
+    void CreateClusters(const CaloHitIndex &caloHitIndex, const pandora::OrderedCaloHitList &orderedCaloHitList,
+        const HitJoinMap &hitJoinMap, HitToClusterMap &hitToClusterMap) const;
 
     /**
      *  @brief  Create primary association if appropriate, hitI<->hitJ
      *
-     *  @param  pCaloHitI address of calo hit I
-     *  @param  pCaloHitJ address of calo hit J
+     *  @param  caloHitIndex the index of the input hits
+     *  @param  hitIdI id of calo hit I
+     *  @param  hitIdJ id of calo hit J
      *  @param  forwardHitAssociationMap the forward hit association map
      *  @param  backwardHitAssociationMap the backward hit association map
      */
-    void CreatePrimaryAssociation(const pandora::CaloHit *const pCaloHitI, const pandora::CaloHit *const pCaloHitJ,
+    void CreatePrimaryAssociation(const CaloHitIndex &caloHitIndex, const unsigned int hitIdI, const unsigned int hitIdJ,
         HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const;
 
     /**
      *  @brief  Create secondary association if appropriate, hitI<->hitJ
      *
-     *  @param  pCaloHitI address of calo hit I
-     *  @param  pCaloHitJ address of calo hit J
+     *  @param  hitIdI id of calo hit I
+     *  @param  hitIdJ id of calo hit J
      *  @param  forwardHitAssociationMap the forward hit association map
      *  @param  backwardHitAssociationMap the backward hit association map
      */
-    void CreateSecondaryAssociation(const pandora::CaloHit *const pCaloHitI, const pandora::CaloHit *const pCaloHitJ,
-        HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const;
+    void CreateSecondaryAssociation(const unsigned int hitIdI, const unsigned int hitIdJ, HitAssociationMap &forwardHitAssociationMap,
+        HitAssociationMap &backwardHitAssociationMap) const;
 
     /**
      *  @brief  Get hit to join by tracing associations via map I, checking via map J
      *
-     *  @param  pCaloHit the initial calo hit
+     *  @param  hitId the id of the initial calo hit
      *  @param  hitAssociationMapI hit association map I
      *  @param  hitAssociationMapJ hit association map J
+     *  @param  joinHitId to receive the id of the hit to join
      *
-     *  @return the hit to join
+     *  @return whether a hit to join was found
      */
-    const pandora::CaloHit *GetJoinHit(const pandora::CaloHit *const pCaloHit, const HitAssociationMap &hitAssociationMapI,
-        const HitAssociationMap &hitAssociationMapJ) const;
+    bool GetJoinHit(const unsigned int hitId, const HitAssociationMap &hitAssociationMapI, const HitAssociationMap &hitAssociationMapJ,
+        unsigned int &joinHitId) const;
 
     /**
      *  @brief  Get last hit obtained by tracing associations via map I, checking via map J
      *
-     *  @param  pCaloHit the initial calo hit
+     *  @param  hitId the id of the initial calo hit
      *  @param  hitAssociationMapI hit association map I
      *  @param  hitAssociationMapJ hit association map J
      *  @param  nSteps to receive the number of association steps
      *
-     *  @return the last hit obtained in the chain of associations
+     *  @return the id of the last hit obtained in the chain of associations
      */
-    const pandora::CaloHit *TraceHitAssociation(const pandora::CaloHit *const pCaloHit, const HitAssociationMap &hitAssociationMapI,
+    unsigned int TraceHitAssociation(const unsigned int hitId, const HitAssociationMap &hitAssociationMapI,
         const HitAssociationMap &hitAssociationMapJ, unsigned int &nSteps) const;
 
+    /**
+     *  @brief  Get the ids of the hits in a list, sorted by hit position
+     *
+     *  @param  caloHitIndex the index of the input hits
+     *  @param  caloHitList the calo hit list
+     *  @param  caloHitIds to receive the sorted hit ids
+     */
+    void GetSortedCaloHitIds(const CaloHitIndex &caloHitIndex, const pandora::CaloHitList &caloHitList, CaloHitIdVector &caloHitIds) const;
+
     bool m_mergeBackFilteredHits;        ///< Merge rejected hits into their associated clusters
     unsigned int m_maxGapLayers;         ///< Maximum number of layers for a gap
     float m_maxCaloHitSeparationSquared; ///< Square of maximum calo hit separation
@@ -207,9 +233,10 @@ private:
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline TrackClusterCreationAlgorithm::HitAssociation::HitAssociation(const pandora::CaloHit *const pPrimaryTarget, const float primaryDistanceSquared) :
-    m_pPrimaryTarget(pPrimaryTarget),
-    m_pSecondaryTarget(NULL),
+inline TrackClusterCreationAlgorithm::HitAssociation::HitAssociation(const unsigned int primaryTargetId, const float primaryDistanceSquared) :
+    m_primaryTargetId(primaryTargetId),
+    m_secondaryTargetId(primaryTargetId),
+    m_hasSecondaryTarget(false),
     m_primaryDistanceSquared(primaryDistanceSquared),
     m_secondaryDistanceSquared(std::numeric_limits<float>::max())
 {
@@ -217,24 +244,32 @@ inline TrackClusterCreationAlgorithm::HitAssociation::HitAssociation(const pando
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline void TrackClusterCreationAlgorithm::HitAssociation::SetSecondaryTarget(const pandora::CaloHit *const pSecondaryTarget, const float secondaryDistanceSquared)
+inline void TrackClusterCreationAlgorithm::HitAssociation::SetSecondaryTarget(const unsigned int secondaryTargetId, const float secondaryDistanceSquared)
 {
-    m_pSecondaryTarget = pSecondaryTarget;
+    m_secondaryTargetId = secondaryTargetId;
+    m_hasSecondaryTarget = true;
     m_secondaryDistanceSquared = secondaryDistanceSquared;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline const pandora::CaloHit *TrackClusterCreationAlgorithm::HitAssociation::GetPrimaryTarget() const
+inline unsigned int TrackClusterCreationAlgorithm::HitAssociation::GetPrimaryTargetId() const
+{
+    return m_primaryTargetId;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool TrackClusterCreationAlgorithm::HitAssociation::HasSecondaryTarget() const
 {
-    return m_pPrimaryTarget;
+    return m_hasSecondaryTarget;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline const pandora::CaloHit *TrackClusterCreationAlgorithm::HitAssociation::GetSecondaryTarget() const
+inline unsigned int TrackClusterCreationAlgorithm::HitAssociation::GetSecondaryTargetId() const
 {
-    return m_pSecondaryTarget;
+    return m_secondaryTargetId;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
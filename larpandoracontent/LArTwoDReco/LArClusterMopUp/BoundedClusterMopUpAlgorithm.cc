@@ -9,7 +9,6 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
-#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterMopUp/BoundedClusterMopUpAlgorithm.h"
 
@@ -30,7 +29,6 @@ BoundedClusterMopUpAlgorithm::BoundedClusterMopUpAlgorithm() :
 void BoundedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters, const ClusterList &remnantClusters) const
 {
     ClusterAssociationMap clusterAssociationMap;
-    const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
     ClusterVector sortedPfoClusters(pfoClusters.begin(), pfoClusters.end());
     std::sort(sortedPfoClusters.begin(), sortedPfoClusters.end(), LArClusterHelper::SortByNHits);
@@ -38,6 +36,16 @@ void BoundedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters,
     ClusterVector sortedRemnantClusters(remnantClusters.begin(), remnantClusters.end());
     std::sort(sortedRemnantClusters.begin(), sortedRemnantClusters.end(), LArClusterHelper::SortByNHits);
 
+    CartesianPointVector remnantMinPositions, remnantMaxPositions;
+
+    for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
+    {
+        CartesianVector minPosition(0.f, 0.f, 0.f), maxPosition(0.f, 0.f, 0.f);
+        LArClusterHelper::GetClusterBoundingBox(pRemnantCluster, minPosition, maxPosition);
+        remnantMinPositions.push_back(minPosition);
+        remnantMaxPositions.push_back(maxPosition);
+    }
+
     for (const Cluster *const pPfoCluster : sortedPfoClusters)
     {
         CaloHitList clusterHitList;
@@ -46,14 +54,24 @@ void BoundedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters,
             continue;
         try
         {
-            const TwoDSlidingShowerFitResult fitResult(pPfoCluster, m_slidingFitWindow, slidingFitPitch, m_showerEdgeMultiplier);
+            const TwoDSlidingShowerFitResult &fitResult(this->GetShowerFitResult(pPfoCluster, m_slidingFitWindow, m_showerEdgeMultiplier));
 
-            ShowerPositionMap showerPositionMap;
             const XSampling xSampling(fitResult.GetShowerFitResult());
-            this->GetShowerPositionMap(fitResult, xSampling, showerPositionMap);
-            for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
+            ShowerEnvelope showerEnvelope(xSampling);
+            this->GetShowerEnvelope(fitResult, xSampling, showerEnvelope);
+
+            for (unsigned int iRemnant = 0; iRemnant < sortedRemnantClusters.size(); ++iRemnant)
             {
-                const float boundedFraction(this->GetBoundedFraction(pRemnantCluster, xSampling, showerPositionMap));
+                const Cluster *const pRemnantCluster(sortedRemnantClusters.at(iRemnant));
+
+                // ATTN Remnants outside the shower envelope have no bounded hits, so can be skipped whenever a zero fraction is rejected
+                if ((m_minBoundedFraction > 0.f) && (pRemnantCluster->GetNCaloHits() > 0) &&
+                    !showerEnvelope.IsOverlapping(remnantMinPositions.at(iRemnant), remnantMaxPositions.at(iRemnant)))
+                {
+                    continue;
+                }
+
+                const float boundedFraction(this->GetBoundedFraction(pRemnantCluster, xSampling, showerEnvelope));
 
                 if (boundedFraction < m_minBoundedFraction)
                     continue;
@@ -76,8 +94,8 @@ void BoundedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters,
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void BoundedClusterMopUpAlgorithm::GetShowerPositionMap(
-    const TwoDSlidingShowerFitResult &fitResult, const XSampling &xSampling, ShowerPositionMap &showerPositionMap) const
+void BoundedClusterMopUpAlgorithm::GetShowerEnvelope(
+    const TwoDSlidingShowerFitResult &fitResult, const XSampling &xSampling, ShowerEnvelope &showerEnvelope) const
 {
     for (int n = 0; n <= xSampling.m_nPoints; ++n)
     {
@@ -94,7 +112,7 @@ void BoundedClusterMopUpAlgorithm::GetShowerPositionMap(
         try
         {
             const int xBin(xSampling.GetBin(x));
-            showerPositionMap.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, edgePositions.front(), edgePositions.back())));
+            showerEnvelope.AddShowerExtent(xBin, ShowerExtent(x, edgePositions.front(), edgePositions.back()));
         }
         catch (StatusCodeException &)
         {
@@ -105,7 +123,7 @@ void BoundedClusterMopUpAlgorithm::GetShowerPositionMap(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float BoundedClusterMopUpAlgorithm::GetBoundedFraction(
-    const Cluster *const pCluster, const XSampling &xSampling, const ShowerPositionMap &showerPositionMap) const
+    const Cluster *const pCluster, const XSampling &xSampling, const ShowerEnvelope &showerEnvelope) const
 {
     if (((xSampling.m_maxX - xSampling.m_minX) < std::numeric_limits<float>::epsilon()) || (0 >= xSampling.m_nPoints) || (0 == pCluster->GetNCaloHits()))
     {
@@ -127,9 +145,7 @@ float BoundedClusterMopUpAlgorithm::GetBoundedFraction(
             {
                 const int xBin(xSampling.GetBin(x));
 
-                ShowerPositionMap::const_iterator positionIter = showerPositionMap.find(xBin);
-
-                if ((showerPositionMap.end() != positionIter) && (z > positionIter->second.GetLowEdgeZ()) && (z < positionIter->second.GetHighEdgeZ()))
+                if (showerEnvelope.IsBounded(xBin, z))
                     ++nMatchedHits;
             }
             catch (StatusCodeException &)
@@ -167,6 +183,58 @@ int BoundedClusterMopUpAlgorithm::XSampling::GetBin(const float x) const
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+BoundedClusterMopUpAlgorithm::ShowerEnvelope::ShowerEnvelope(const XSampling &xSampling) :
+    m_xSampling(xSampling),
+    m_hasExtent(xSampling.m_nPoints + 1, false),
+    m_lowEdgeZ(xSampling.m_nPoints + 1, 0.f),
+    m_highEdgeZ(xSampling.m_nPoints + 1, 0.f),
+    m_minZ(std::numeric_limits<float>::max()),
+    m_maxZ(-std::numeric_limits<float>::max())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BoundedClusterMopUpAlgorithm::ShowerEnvelope::AddShowerExtent(const int xBin, const ShowerExtent &showerExtent)
+{
+    if ((xBin < 0) || (xBin >= static_cast<int>(m_hasExtent.size())) || m_hasExtent.at(xBin))
+        return;
+
+    m_hasExtent.at(xBin) = true;
+    m_lowEdgeZ.at(xBin) = showerExtent.GetLowEdgeZ();
+    m_highEdgeZ.at(xBin) = showerExtent.GetHighEdgeZ();
+    m_minZ = std::min(m_minZ, showerExtent.GetLowEdgeZ());
+    m_maxZ = std::max(m_maxZ, showerExtent.GetHighEdgeZ());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool BoundedClusterMopUpAlgorithm::ShowerEnvelope::IsBounded(const int xBin, const float z) const
+{
+    if ((xBin < 0) || (xBin >= static_cast<int>(m_hasExtent.size())) || !m_hasExtent.at(xBin))
+        return false;
+
+    return ((z > m_lowEdgeZ.at(xBin)) && (z < m_highEdgeZ.at(xBin)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool BoundedClusterMopUpAlgorithm::ShowerEnvelope::IsOverlapping(
+    const CartesianVector &minPosition, const CartesianVector &maxPosition) const
+{
+    // ATTN Mirror the x sampling acceptance and strict z edge tests, so no box passing a bounded hit is ever rejected
+    if (((maxPosition.GetX() - m_xSampling.m_minX) < -std::numeric_limits<float>::epsilon()) ||
+        ((minPosition.GetX() - m_xSampling.m_maxX) > +std::numeric_limits<float>::epsilon()))
+    {
+        return false;
+    }
+
+    return ((maxPosition.GetZ() > m_minZ) && (minPosition.GetZ() < m_maxZ));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode BoundedClusterMopUpAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(
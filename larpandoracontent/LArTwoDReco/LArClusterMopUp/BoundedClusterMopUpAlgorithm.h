@@ -55,27 +55,78 @@ private:
         int m_nPoints; ///< The number of sampling points to be used
     };
 
+    /**
+     *  @brief  ShowerEnvelope class, holding the shower high and low edge z positions in a lookup table indexed by x sampling bin
+     */
+    class ShowerEnvelope
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  xSampling the x sampling details
+         */
+        ShowerEnvelope(const XSampling &xSampling);
+
+        /**
+         *  @brief  Add the shower extent for an x sampling bin, unless the bin already has an extent
+         *
+         *  @param  xBin the x sampling bin
+         *  @param  showerExtent the shower extent
+         */
+        void AddShowerExtent(const int xBin, const ShowerExtent &showerExtent);
+
+        /**
+         *  @brief  Whether a z coordinate lies strictly between the shower edges in a given x sampling bin
+         *
+         *  @param  xBin the x sampling bin
+         *  @param  z the z coordinate
+         *
+         *  @return boolean
+         */
+        bool IsBounded(const int xBin, const float z) const;
+
+        /**
+         *  @brief  Whether any hit within a given bounding box could be bounded by the shower envelope
+         *
+         *  @param  minPosition the minimum position of the bounding box
+         *  @param  maxPosition the maximum position of the bounding box
+         *
+         *  @return boolean
+         */
+        bool IsOverlapping(const pandora::CartesianVector &minPosition, const pandora::CartesianVector &maxPosition) const;
+
+    private:
+        XSampling m_xSampling;            ///< The x sampling details
+        std::vector<bool> m_hasExtent;    ///< Whether each x sampling bin has a shower extent
+        pandora::FloatVector m_lowEdgeZ;  ///< The shower low edge z position in each x sampling bin
+        pandora::FloatVector m_highEdgeZ; ///< The shower high edge z position in each x sampling bin
+        float m_minZ;                     ///< The min shower low edge z position
+        float m_maxZ;                     ///< The max shower high edge z position
+    };
+
     void ClusterMopUp(const pandora::ClusterList &pfoClusters, const pandora::ClusterList &remnantClusters) const;
 
     /**
-     *  @brief  Get the shower position map containing high and low edge z positions in bins of x
+     *  @brief  Get the shower envelope containing high and low edge z positions in bins of x
      *
      *  @param  fitResult the sliding shower fit result
      *  @param  xSampling the x sampling details
-     *  @param  showerPositionMap to receive the shower position map
+     *  @param  showerEnvelope to receive the shower envelope
      */
-    void GetShowerPositionMap(const TwoDSlidingShowerFitResult &fitResult, const XSampling &xSampling, ShowerPositionMap &showerPositionMap) const;
+    void GetShowerEnvelope(const TwoDSlidingShowerFitResult &fitResult, const XSampling &xSampling, ShowerEnvelope &showerEnvelope) const;
 
     /**
-     *  @brief  Get the fraction of hits in a cluster bounded by a specified shower position map
+     *  @brief  Get the fraction of hits in a cluster bounded by a specified shower envelope
      *
      *  @param  pCluster address of the cluster
      *  @param  xSampling the x sampling details
-     *  @param  showerPositionMap the shower position map
+     *  @param  showerEnvelope the shower envelope
      *
      *  @return the fraction of bounded hits
      */
-    float GetBoundedFraction(const pandora::Cluster *const pCluster, const XSampling &xSampling, const ShowerPositionMap &showerPositionMap) const;
+    float GetBoundedFraction(
+        const pandora::Cluster *const pCluster, const XSampling &xSampling, const ShowerEnvelope &showerEnvelope) const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
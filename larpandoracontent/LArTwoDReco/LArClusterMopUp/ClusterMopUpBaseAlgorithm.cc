@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterMopUp/ClusterMopUpBaseAlgorithm.h"
@@ -32,6 +33,11 @@ StatusCode ClusterMopUpBaseAlgorithm::Run()
     ClusterList daughterClusterListU, daughterClusterListV, daughterClusterListW;
     this->GetDaughterClusterLists(daughterClusterListU, daughterClusterListV, daughterClusterListW);
 
+    ClusterList pfoClusterList(pfoClusterListU);
+    pfoClusterList.insert(pfoClusterList.end(), pfoClusterListV.begin(), pfoClusterListV.end());
+    pfoClusterList.insert(pfoClusterList.end(), pfoClusterListW.begin(), pfoClusterListW.end());
+    this->PruneShowerFitCache(pfoClusterList);
+
     this->ClusterMopUp(pfoClusterListU, daughterClusterListU);
     this->ClusterMopUp(pfoClusterListV, daughterClusterListV);
     this->ClusterMopUp(pfoClusterListW, daughterClusterListW);
@@ -140,6 +146,105 @@ void ClusterMopUpBaseAlgorithm::MakeClusterMerges(const ClusterAssociationMap &c
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+const TwoDSlidingShowerFitResult &ClusterMopUpBaseAlgorithm::GetShowerFitResult(
+    const Cluster *const pCluster, const unsigned int slidingFitWindow, const float showerEdgeMultiplier) const
+{
+    const ShowerFitCacheKey cacheKey(&this->GetPandora(), pCluster, slidingFitWindow, showerEdgeMultiplier);
+
+    FloatVector hitSignature;
+    ClusterMopUpBaseAlgorithm::GetHitSignature(pCluster, hitSignature);
+
+    ShowerFitCache &showerFitCache(ClusterMopUpBaseAlgorithm::GetShowerFitCache());
+
+    {
+        std::lock_guard<std::mutex> lock(showerFitCache.m_mutex);
+        ShowerFitCacheMap::const_iterator iter(showerFitCache.m_showerFitCacheMap.find(cacheKey));
+
+        if ((showerFitCache.m_showerFitCacheMap.end() != iter) && (iter->second.m_hitSignature == hitSignature))
+            return iter->second.m_showerFitResult;
+    }
+
+    // ATTN Fit outside the lock; a failed fit throws here, exactly as a direct fit would, and is not cached
+    const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+    const TwoDSlidingShowerFitResult showerFitResult(pCluster, slidingFitWindow, slidingFitPitch, showerEdgeMultiplier);
+
+    std::lock_guard<std::mutex> lock(showerFitCache.m_mutex);
+    showerFitCache.m_showerFitCacheMap.erase(cacheKey);
+
+    const auto insertResult(showerFitCache.m_showerFitCacheMap.emplace(cacheKey, ShowerFitCacheEntry(hitSignature, showerFitResult)));
+
+    return insertResult.first->second.m_showerFitResult;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ClusterMopUpBaseAlgorithm::ShowerFitCache &ClusterMopUpBaseAlgorithm::GetShowerFitCache()
+{
+    static ShowerFitCache showerFitCache;
+    return showerFitCache;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterMopUpBaseAlgorithm::PruneShowerFitCache(const ClusterList &clusterList) const
+{
+    const ClusterSet clusterSet(clusterList.begin(), clusterList.end());
+    ShowerFitCache &showerFitCache(ClusterMopUpBaseAlgorithm::GetShowerFitCache());
+
+    std::lock_guard<std::mutex> lock(showerFitCache.m_mutex);
+
+    for (ShowerFitCacheMap::iterator iter = showerFitCache.m_showerFitCacheMap.begin(); iter != showerFitCache.m_showerFitCacheMap.end();)
+    {
+        if ((&this->GetPandora() == std::get<0>(iter->first)) && !clusterSet.count(std::get<1>(iter->first)))
+        {
+            iter = showerFitCache.m_showerFitCacheMap.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterMopUpBaseAlgorithm::ReleaseShowerFitCache(const Pandora &pandora)
+{
+    ShowerFitCache &showerFitCache(ClusterMopUpBaseAlgorithm::GetShowerFitCache());
+
+    std::lock_guard<std::mutex> lock(showerFitCache.m_mutex);
+
+    for (ShowerFitCacheMap::iterator iter = showerFitCache.m_showerFitCacheMap.begin(); iter != showerFitCache.m_showerFitCacheMap.end();)
+    {
+        if (&pandora == std::get<0>(iter->first))
+        {
+            iter = showerFitCache.m_showerFitCacheMap.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterMopUpBaseAlgorithm::GetHitSignature(const Cluster *const pCluster, FloatVector &hitSignature)
+{
+    hitSignature.reserve(4 * pCluster->GetNCaloHits());
+
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+        {
+            const CartesianVector &position(pCaloHit->GetPositionVector());
+            hitSignature.insert(hitSignature.end(), {position.GetX(), position.GetY(), position.GetZ(), pCaloHit->GetCellSize1()});
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterMopUpBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadVectorOfValues(xmlHandle, "PfoListNames", m_pfoListNames));
@@ -150,4 +255,14 @@ StatusCode ClusterMopUpBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     return MopUpBaseAlgorithm::ReadSettings(xmlHandle);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ClusterMopUpBaseAlgorithm::ShowerFitCacheEntry::ShowerFitCacheEntry(
+    const FloatVector &hitSignature, const TwoDSlidingShowerFitResult &showerFitResult) :
+    m_hitSignature(hitSignature),
+    m_showerFitResult(showerFitResult)
+{
+}
+
 } // namespace lar_content
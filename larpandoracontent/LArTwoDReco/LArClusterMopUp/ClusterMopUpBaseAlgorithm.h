@@ -8,8 +8,13 @@
 #ifndef LAR_CLUSTER_MOP_UP_BASE_ALGORITHM_H
 #define LAR_CLUSTER_MOP_UP_BASE_ALGORITHM_H 1
 
+#include "larpandoracontent/LArObjects/LArTwoDSlidingShowerFitResult.h"
+
 #include "larpandoracontent/LArUtility/MopUpBaseAlgorithm.h"
 
+#include <map>
+#include <mutex>
+#include <tuple>
 #include <unordered_map>
 
 namespace lar_content
@@ -27,6 +32,13 @@ public:
      */
     ClusterMopUpBaseAlgorithm();
 
+    /**
+     *  @brief  Release the cached shower fits for a pandora instance, which must be called before the instance is deleted
+     *
+     *  @param  pandora the associated pandora instance
+     */
+    static void ReleaseShowerFitCache(const pandora::Pandora &pandora);
+
 protected:
     virtual pandora::StatusCode Run();
 
@@ -78,10 +90,78 @@ protected:
      */
     virtual void MakeClusterMerges(const ClusterAssociationMap &clusterAssociationMap) const;
 
+    /**
+     *  @brief  Get the sliding shower fit result for a cluster. Fits are cached and shared by all cluster mop up algorithms of the pandora
+     *          instance; a cached fit is reused only if it was made with the same parameters and the cluster hits are unchanged.
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  slidingFitWindow the layer window for the sliding linear fits
+     *  @param  showerEdgeMultiplier the shower edge multiplier
+     *
+     *  @return the sliding shower fit result, which remains valid until the next cluster mop up algorithm runs
+     */
+    const TwoDSlidingShowerFitResult &GetShowerFitResult(
+        const pandora::Cluster *const pCluster, const unsigned int slidingFitWindow, const float showerEdgeMultiplier) const;
+
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     pandora::StringVector m_pfoListNames; ///< The list of pfo list names
     bool m_excludePfosContainingTracks;   ///< Whether to exclude any pfos containing clusters flagged as fixed tracks
+
+private:
+    /**
+     *  @brief  ShowerFitCacheEntry class
+     */
+    class ShowerFitCacheEntry
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  hitSignature the signature of the cluster hits used in the fit
+         *  @param  showerFitResult the sliding shower fit result
+         */
+        ShowerFitCacheEntry(const pandora::FloatVector &hitSignature, const TwoDSlidingShowerFitResult &showerFitResult);
+
+        pandora::FloatVector m_hitSignature;          ///< The signature of the cluster hits used in the fit
+        TwoDSlidingShowerFitResult m_showerFitResult; ///< The sliding shower fit result
+    };
+
+    typedef std::tuple<const pandora::Pandora *, const pandora::Cluster *, unsigned int, float> ShowerFitCacheKey;
+    typedef std::map<ShowerFitCacheKey, ShowerFitCacheEntry> ShowerFitCacheMap;
+
+    /**
+     *  @brief  ShowerFitCache class, shared by all cluster mop up algorithms
+     */
+    class ShowerFitCache
+    {
+    public:
+        ShowerFitCacheMap m_showerFitCacheMap; ///< The map from pandora instance, cluster and fit parameters to cached fit
+        std::mutex m_mutex;                    ///< The mutex serialising access to the cache
+    };
+
+    /**
+     *  @brief  Get the shower fit cache shared by all cluster mop up algorithms
+     *
+     *  @return the shower fit cache
+     */
+    static ShowerFitCache &GetShowerFitCache();
+
+    /**
+     *  @brief  Remove the cached fits for this pandora instance, other than those for a specified list of (pfo) clusters
+     *
+     *  @param  clusterList the list of clusters whose cached fits may be kept
+     */
+    void PruneShowerFitCache(const pandora::ClusterList &clusterList) const;
+
+    /**
+     *  @brief  Get the signature of the hits in a cluster: the position and width of each hit, in ordered calo hit list order. Identical
+     *          signatures give identical sliding shower fits.
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  hitSignature to receive the hit signature
+     */
+    static void GetHitSignature(const pandora::Cluster *const pCluster, pandora::FloatVector &hitSignature);
 };
 
 } // namespace lar_content
@@ -25,7 +25,8 @@ ConeClusterMopUpAlgorithm::ConeClusterMopUpAlgorithm() :
     m_showerEdgeMultiplier(1.5f),
     m_coneAngleCentile(0.85f),
     m_maxConeLengthMultiplier(1.5f),
-    m_minBoundedFraction(0.5f)
+    m_minBoundedFraction(0.5f),
+    m_boundingBoxTolerance(1.f)
 {
 }
 
@@ -34,7 +35,6 @@ ConeClusterMopUpAlgorithm::ConeClusterMopUpAlgorithm() :
 void ConeClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters, const ClusterList &remnantClusters) const
 {
     ClusterAssociationMap clusterAssociationMap;
-    const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
     const VertexList *pVertexList(NULL);
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pVertexList));
@@ -50,11 +50,22 @@ void ConeClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters, con
     ClusterVector sortedRemnantClusters(remnantClusters.begin(), remnantClusters.end());
     std::sort(sortedRemnantClusters.begin(), sortedRemnantClusters.end(), LArClusterHelper::SortByNHits);
 
+    CartesianPointVector remnantMinPositions, remnantMaxPositions;
+
+    for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
+    {
+        CartesianVector minPosition(0.f, 0.f, 0.f), maxPosition(0.f, 0.f, 0.f);
+        LArClusterHelper::GetClusterBoundingBox(pRemnantCluster, minPosition, maxPosition);
+        remnantMinPositions.push_back(minPosition);
+        remnantMaxPositions.push_back(maxPosition);
+    }
+
     for (const Cluster *const pPfoCluster : sortedPfoClusters)
     {
         try
         {
-            const TwoDSlidingShowerFitResult showerFitResult(pPfoCluster, m_slidingFitWindow, slidingFitPitch, m_showerEdgeMultiplier);
+            const TwoDSlidingShowerFitResult &showerFitResult(
+                this->GetShowerFitResult(pPfoCluster, m_slidingFitWindow, m_showerEdgeMultiplier));
 
             const LayerFitResultMap &layerFitResultMapS(showerFitResult.GetShowerFitResult().GetLayerFitResultMap());
             const LayerFitResultMap &layerFitResultMapP(showerFitResult.GetPositiveEdgeFitResult().GetLayerFitResultMap());
@@ -114,11 +125,42 @@ void ConeClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters, con
                 continue;
             }
 
+            // Cone bounding box, from the cone corners in local coordinates, as the cone edges are linear in the longitudinal coordinate
+            CartesianVector coneMinPosition(std::numeric_limits<float>::max(), 0.f, std::numeric_limits<float>::max());
+            CartesianVector coneMaxPosition(-std::numeric_limits<float>::max(), 0.f, -std::numeric_limits<float>::max());
+
+            for (const float rL : {minL, maxL})
+            {
+                const float rTP(minP.second + (rL - minP.first) * ((maxP.second - minP.second) / (maxP.first - minP.first)));
+                const float rTN(minN.second + (rL - minN.first) * ((maxN.second - minN.second) / (maxN.first - minN.first)));
+
+                for (const float rT : {rTP, rTN})
+                {
+                    CartesianVector cornerPosition(0.f, 0.f, 0.f);
+                    showerFitResult.GetShowerFitResult().GetGlobalPosition(rL, rT, cornerPosition);
+                    coneMinPosition.SetValues(std::min(coneMinPosition.GetX(), cornerPosition.GetX()), 0.f,
+                        std::min(coneMinPosition.GetZ(), cornerPosition.GetZ()));
+                    coneMaxPosition.SetValues(std::max(coneMaxPosition.GetX(), cornerPosition.GetX()), 0.f,
+                        std::max(coneMaxPosition.GetZ(), cornerPosition.GetZ()));
+                }
+            }
+
             // Bounded fraction calculation
-            for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
+            for (unsigned int iRemnant = 0; iRemnant < sortedRemnantClusters.size(); ++iRemnant)
             {
+                const Cluster *const pRemnantCluster(sortedRemnantClusters.at(iRemnant));
                 const unsigned int nHits(pRemnantCluster->GetNCaloHits());
 
+                // ATTN Remnants clear of the padded cone bounding box have no bounded hits, so are skipped if a zero fraction is rejected
+                if ((m_minBoundedFraction > 0.f) && (nHits > 0) &&
+                    ((remnantMaxPositions.at(iRemnant).GetX() < coneMinPosition.GetX() - m_boundingBoxTolerance) ||
+                        (remnantMinPositions.at(iRemnant).GetX() > coneMaxPosition.GetX() + m_boundingBoxTolerance) ||
+                        (remnantMaxPositions.at(iRemnant).GetZ() < coneMinPosition.GetZ() - m_boundingBoxTolerance) ||
+                        (remnantMinPositions.at(iRemnant).GetZ() > coneMaxPosition.GetZ() + m_boundingBoxTolerance)))
+                {
+                    continue;
+                }
+
                 unsigned int nMatchedHits(0);
                 const OrderedCaloHitList &orderedCaloHitList(pRemnantCluster->GetOrderedCaloHitList());
 
@@ -189,6 +231,9 @@ StatusCode ConeClusterMopUpAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MinBoundedFraction", m_minBoundedFraction));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "BoundingBoxTolerance", m_boundingBoxTolerance));
+
     return ClusterMopUpBaseAlgorithm::ReadSettings(xmlHandle);
 }
 
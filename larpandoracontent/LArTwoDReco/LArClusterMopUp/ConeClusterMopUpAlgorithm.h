@@ -49,6 +49,7 @@ private:
     float m_coneAngleCentile;        ///< Cluster cone angle is defined using specified centile of distribution of hit half angles
     float m_maxConeLengthMultiplier; ///< Consider hits as bound if inside cone, with projected distance less than N times cone length
     float m_minBoundedFraction;      ///< The minimum cluster bounded fraction for merging
+    float m_boundingBoxTolerance;    ///< The padding of the cone bounding box used to skip distant remnant clusters, units cm
 };
 
 } // namespace lar_content
@@ -10,6 +10,8 @@
 
 #include "KDTreeLinkerToolsT.h"
 
+#include <memory>
+#include <memory_resource>
 #include <vector>
 
 namespace lar_content
@@ -27,6 +29,13 @@ public:
      */
     KDTreeLinkerAlgo();
 
+    /**
+     *  @brief  Constructor, allocating the node pool from a given memory resource (e.g. an event arena) rather than with new and delete
+     *
+     *  @param  pMemoryResource the address of the memory resource, which must outlive the tree
+     */
+    KDTreeLinkerAlgo(std::pmr::memory_resource *const pMemoryResource);
+
     /**
      *  @brief  Destructor calls clear
      */
@@ -42,12 +51,13 @@ public:
 
     /**
      *  @brief  Search in the KDTree for all points that would be contained in the given searchbox
-     *          The founded points are stored in resRecHitList
+     *          The founded points are stored in resRecHitList. The search does not modify the tree, so concurrent searches are safe
+     *          provided that each uses its own result list.
      *
      *  @param  searchBox
      *  @param  resRecHitList
      */
-    void search(const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList);
+    void search(const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const;
 
     /**
      *  @brief  findNearestNeighbour
@@ -109,8 +119,10 @@ private:
      *
      *  @param  current
      *  @param  trackBox
+     *  @param  recHits
      */
-    void recSearch(const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox);
+    void recSearch(
+        const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const;
 
     /**
      *  @brief  Recursive nearest neighbour search. Is called by findNearestNeighbour()
@@ -128,8 +140,9 @@ private:
      *  @brief  Add all elements of an subtree to the closest elements. Used during the recSearch().
      *
      *  @param  current
+     *  @param  recHits
      */
-    void addSubtree(const KDTreeNodeT<DATA, DIM> *current);
+    void addSubtree(const KDTreeNodeT<DATA, DIM> *current, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const;
 
     /**
      *  @brief  dist2
@@ -146,13 +159,13 @@ private:
      */
     void clearTree();
 
-    KDTreeNodeT<DATA, DIM> *root_;     ///< The KDTree root
-    KDTreeNodeT<DATA, DIM> *nodePool_; ///< Node pool allows us to do just 1 call to new for each tree building
-    int nodePoolSize_;                 ///< The node pool size
-    int nodePoolPos_;                  ///< The node pool position
+    KDTreeNodeT<DATA, DIM> *root_;               ///< The KDTree root
+    KDTreeNodeT<DATA, DIM> *nodePool_;           ///< Node pool allows us to do just 1 call to new for each tree building
+    std::pmr::memory_resource *pMemoryResource_; ///< The memory resource for the node pool, nullptr to use new and delete
+    int nodePoolSize_;                           ///< The node pool size
+    int nodePoolPos_;                            ///< The node pool position
 
-    std::vector<KDTreeNodeInfoT<DATA, DIM>> *closestNeighbour; ///< The closest neighbour
-    std::vector<KDTreeNodeInfoT<DATA, DIM>> *initialEltList;   ///< The initial element list
+    std::vector<KDTreeNodeInfoT<DATA, DIM>> *initialEltList; ///< The initial element list
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -162,9 +175,22 @@ template <typename DATA, unsigned DIM>
 inline KDTreeLinkerAlgo<DATA, DIM>::KDTreeLinkerAlgo() :
     root_(nullptr),
     nodePool_(nullptr),
+    pMemoryResource_(nullptr),
+    nodePoolSize_(-1),
+    nodePoolPos_(-1),
+    initialEltList(nullptr)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline KDTreeLinkerAlgo<DATA, DIM>::KDTreeLinkerAlgo(std::pmr::memory_resource *const pMemoryResource) :
+    root_(nullptr),
+    nodePool_(nullptr),
+    pMemoryResource_(pMemoryResource),
     nodePoolSize_(-1),
     nodePoolPos_(-1),
-    closestNeighbour(nullptr),
     initialEltList(nullptr)
 {
 }
@@ -188,7 +214,17 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::build(std::vector<KDTreeNodeInfoT<DATA,
         const size_t mysize = initialEltList->size();
 
         nodePoolSize_ = mysize * 2 - 1;
-        nodePool_ = new KDTreeNodeT<DATA, DIM>[nodePoolSize_];
+
+        if (pMemoryResource_)
+        {
+            nodePool_ = static_cast<KDTreeNodeT<DATA, DIM> *>(
+                pMemoryResource_->allocate(nodePoolSize_ * sizeof(KDTreeNodeT<DATA, DIM>), alignof(KDTreeNodeT<DATA, DIM>)));
+            std::uninitialized_value_construct_n(nodePool_, nodePoolSize_);
+        }
+        else
+        {
+            nodePool_ = new KDTreeNodeT<DATA, DIM>[nodePoolSize_];
+        }
 
         // Here we build the KDTree
         root_ = this->recBuild(0, mysize, 0, region);
@@ -246,20 +282,17 @@ inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(int low, int high, int tree
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::search(const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits)
+inline void KDTreeLinkerAlgo<DATA, DIM>::search(const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
 {
     if (root_)
-    {
-        closestNeighbour = &recHits;
-        this->recSearch(root_, trackBox);
-        closestNeighbour = nullptr;
-    }
+        this->recSearch(root_, trackBox, recHits);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox)
+inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(
+    const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
 {
     // By construction, current can't be null
     //assert(current != 0);
@@ -279,7 +312,7 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM>
         }
 
         if (isInside)
-            closestNeighbour->push_back(current->info);
+            recHits.push_back(current->info);
     }
     else
     {
@@ -298,11 +331,11 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM>
 
         if (isFullyContained)
         {
-            this->addSubtree(current->left);
+            this->addSubtree(current->left, recHits);
         }
         else if (hasIntersection)
         {
-            this->recSearch(current->left, trackBox);
+            this->recSearch(current->left, trackBox, recHits);
         }
 
         //if region( v->right ) is fully contained in the rectangle
@@ -319,11 +352,11 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM>
 
         if (isFullyContained)
         {
-            this->addSubtree(current->right);
+            this->addSubtree(current->right, recHits);
         }
         else if (hasIntersection)
         {
-            this->recSearch(current->right, trackBox);
+            this->recSearch(current->right, trackBox, recHits);
         }
     }
 }
@@ -418,7 +451,8 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recNearestNeighbour(unsigned int depth,
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::addSubtree(const KDTreeNodeT<DATA, DIM> *current)
+inline void KDTreeLinkerAlgo<DATA, DIM>::addSubtree(
+    const KDTreeNodeT<DATA, DIM> *current, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
 {
     // By construction, current can't be null
     //assert(current != 0);
@@ -426,13 +460,13 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::addSubtree(const KDTreeNodeT<DATA, DIM>
     if ((current->left == nullptr) && (current->right == nullptr))
     {
         // Leaf case
-        closestNeighbour->push_back(current->info);
+        recHits.push_back(current->info);
     }
     else
     {
         // Node case
-        this->addSubtree(current->left);
-        this->addSubtree(current->right);
+        this->addSubtree(current->left, recHits);
+        this->addSubtree(current->right, recHits);
     }
 }
 
@@ -457,7 +491,16 @@ inline float KDTreeLinkerAlgo<DATA, DIM>::dist2(const KDTreeNodeInfoT<DATA, DIM>
 template <typename DATA, unsigned DIM>
 inline void KDTreeLinkerAlgo<DATA, DIM>::clearTree()
 {
-    delete[] nodePool_;
+    if (pMemoryResource_)
+    {
+        std::destroy_n(nodePool_, nodePoolSize_);
+        pMemoryResource_->deallocate(nodePool_, nodePoolSize_ * sizeof(KDTreeNodeT<DATA, DIM>), alignof(KDTreeNodeT<DATA, DIM>));
+    }
+    else
+    {
+        delete[] nodePool_;
+    }
+
     nodePool_ = nullptr;
     root_ = nullptr;
     nodePoolSize_ = -1;
@@ -10,9 +10,13 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArProcessingBudgetHelper.h"
 
 #include "larpandoracontent/LArVertex/CandidateVertexCreationAlgorithm.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <utility>
 
 using namespace pandora;
@@ -172,16 +176,68 @@ void CandidateVertexCreationAlgorithm::SelectClusters(ClusterVector &clusterVect
 
 void CandidateVertexCreationAlgorithm::CreateEndpointCandidates(const ClusterVector &clusterVector1, const ClusterVector &clusterVector2) const
 {
+    // ATTN A cluster pair yields no candidates if the endpoint x ranges are separated by more than the endpoint x discrepancy, so bucket
+    // the view 2 clusters by the lower edge of their endpoint x range and visit the remaining pairs in the original order
+    const float maxDiscrepancy(std::max(m_maxEndpointXDiscrepancy, 0.f));
+    FloatVector minX2, maxX2;
+    IndexVector sortedIndices2;
+
+    for (const Cluster *const pCluster2 : clusterVector2)
+    {
+        const TwoDSlidingFitResult &fitResult2(this->GetCachedSlidingFitResult(pCluster2));
+        const float endpointX1(fitResult2.GetGlobalMinLayerPosition().GetX()), endpointX2(fitResult2.GetGlobalMaxLayerPosition().GetX());
+        minX2.push_back(std::min(endpointX1, endpointX2));
+        maxX2.push_back(std::max(endpointX1, endpointX2));
+        sortedIndices2.push_back(sortedIndices2.size());
+    }
+
+    std::stable_sort(sortedIndices2.begin(), sortedIndices2.end(), [&minX2](const unsigned int lhs, const unsigned int rhs) {
+        return minX2.at(lhs) < minX2.at(rhs);
+    });
+
+    FloatVector runningMaxX2;
+
+    for (const unsigned int index2 : sortedIndices2)
+        runningMaxX2.push_back(runningMaxX2.empty() ? maxX2.at(index2) : std::max(runningMaxX2.back(), maxX2.at(index2)));
+
+    LArProcessingBudgetHelper::Checkpoint budgetCheckpoint(this->GetPandora());
+
     for (const Cluster *const pCluster1 : clusterVector1)
     {
+        // ATTN Once the processing budget is exhausted, no further cluster pairs are considered; the candidates created are kept
+        if (budgetCheckpoint.IsExhausted(clusterVector2.size()))
+            return;
+
         const HitType hitType1(LArClusterHelper::GetClusterHitType(pCluster1));
 
         const TwoDSlidingFitResult &fitResult1(this->GetCachedSlidingFitResult(pCluster1));
         const CartesianVector minLayerPosition1(fitResult1.GetGlobalMinLayerPosition());
         const CartesianVector maxLayerPosition1(fitResult1.GetGlobalMaxLayerPosition());
 
-        for (const Cluster *const pCluster2 : clusterVector2)
+        const float minX1(std::min(minLayerPosition1.GetX(), maxLayerPosition1.GetX()));
+        const float maxX1(std::max(minLayerPosition1.GetX(), maxLayerPosition1.GetX()));
+
+        const IndexVector::const_iterator endIter(std::partition_point(sortedIndices2.begin(), sortedIndices2.end(),
+            [&](const unsigned int index2) { return !(minX2.at(index2) - maxX1 > maxDiscrepancy); }));
+
+        IndexVector candidateIndices2;
+
+        for (unsigned int iSorted = endIter - sortedIndices2.begin(); iSorted > 0; --iSorted)
         {
+            if (minX1 - runningMaxX2.at(iSorted - 1) > maxDiscrepancy)
+                break;
+
+            const unsigned int index2(sortedIndices2.at(iSorted - 1));
+
+            if (!(minX1 - maxX2.at(index2) > maxDiscrepancy))
+                candidateIndices2.push_back(index2);
+        }
+
+        std::sort(candidateIndices2.begin(), candidateIndices2.end());
+
+        for (const unsigned int index2 : candidateIndices2)
+        {
+            const Cluster *const pCluster2(clusterVector2.at(index2));
             const HitType hitType2(LArClusterHelper::GetClusterHitType(pCluster2));
 
             const TwoDSlidingFitResult &fitResult2(this->GetCachedSlidingFitResult(pCluster2));
@@ -254,22 +310,44 @@ void CandidateVertexCreationAlgorithm::CreateCrossingCandidates(
 
 void CandidateVertexCreationAlgorithm::FindCrossingPoints(const ClusterVector &clusterVector, CartesianPointVector &crossingPoints) const
 {
-    ClusterToSpacepointsMap clusterToSpacepointsMap;
+    // ATTN Crossings require a spacepoint separation below the max crossing separation, so no candidates are missed by using grid cells
+    // slightly larger than this separation
+    if (m_maxCrossingSeparationSquared <= 0.f)
+        return;
+
+    // ATTN Where no crossings can be near one another, any cell size will do for the crossing point grid
+    const float spacepointCellSize(1.01f * std::sqrt(m_maxCrossingSeparationSquared));
+    const float minNearbyCrossingDistance(std::sqrt(std::max(m_minNearbyCrossingDistanceSquared, 0.f)));
+    const float crossingCellSize((minNearbyCrossingDistance > 0.f) ? 1.01f * minNearbyCrossingDistance : spacepointCellSize);
 
-    for (const Cluster *const pCluster : clusterVector)
+    std::vector<CartesianPointVector> spacepointsVector(clusterVector.size());
+    std::vector<TwoDPointGrid> spacepointGridVector(clusterVector.size(), TwoDPointGrid(spacepointCellSize));
+
+    for (unsigned int iCluster = 0; iCluster < clusterVector.size(); ++iCluster)
     {
-        ClusterToSpacepointsMap::iterator mapIter(clusterToSpacepointsMap.emplace(pCluster, CartesianPointVector()).first);
-        this->GetSpacepoints(pCluster, mapIter->second);
+        this->GetSpacepoints(clusterVector.at(iCluster), spacepointsVector.at(iCluster));
+
+        for (unsigned int iPoint = 0; iPoint < spacepointsVector.at(iCluster).size(); ++iPoint)
+            spacepointGridVector.at(iCluster).AddPoint(spacepointsVector.at(iCluster).at(iPoint), iPoint);
     }
 
-    for (const Cluster *const pCluster1 : clusterVector)
+    TwoDPointGrid crossingPointGrid(crossingCellSize);
+
+    for (unsigned int iPoint = 0; iPoint < crossingPoints.size(); ++iPoint)
+        crossingPointGrid.AddPoint(crossingPoints.at(iPoint), iPoint);
+
+    for (unsigned int iCluster1 = 0; iCluster1 < clusterVector.size(); ++iCluster1)
     {
-        for (const Cluster *const pCluster2 : clusterVector)
+        for (unsigned int iCluster2 = 0; iCluster2 < clusterVector.size(); ++iCluster2)
         {
-            if (pCluster1 == pCluster2)
+            if (clusterVector.at(iCluster1) == clusterVector.at(iCluster2))
+                continue;
+
+            if (spacepointGridVector.at(iCluster1).IsSeparatedFrom(spacepointGridVector.at(iCluster2)))
                 continue;
 
-            this->FindCrossingPoints(clusterToSpacepointsMap.at(pCluster1), clusterToSpacepointsMap.at(pCluster2), crossingPoints);
+            this->FindCrossingPoints(spacepointsVector.at(iCluster1), spacepointsVector.at(iCluster2), spacepointGridVector.at(iCluster2),
+                crossingPointGrid, crossingPoints);
         }
     }
 }
@@ -301,46 +379,56 @@ void CandidateVertexCreationAlgorithm::GetSpacepoints(const Cluster *const pClus
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CandidateVertexCreationAlgorithm::FindCrossingPoints(
-    const CartesianPointVector &spacepoints1, const CartesianPointVector &spacepoints2, CartesianPointVector &crossingPoints) const
+void CandidateVertexCreationAlgorithm::FindCrossingPoints(const CartesianPointVector &spacepoints1,
+    const CartesianPointVector &spacepoints2, const TwoDPointGrid &spacepointGrid2, TwoDPointGrid &crossingPointGrid,
+    CartesianPointVector &crossingPoints) const
 {
+    // ATTN Select the closest spacepoint pair, resolving ties in favour of the first pair in spacepoint order, as for a full scan
     bool bestCrossingFound(false);
     float bestSeparationSquared(m_maxCrossingSeparationSquared);
     CartesianVector bestPosition1(0.f, 0.f, 0.f), bestPosition2(0.f, 0.f, 0.f);
+    IndexVector neighbourIndices;
 
     for (const CartesianVector &position1 : spacepoints1)
     {
-        for (const CartesianVector &position2 : spacepoints2)
+        neighbourIndices.clear();
+        spacepointGrid2.GetNeighbourIndices(position1, neighbourIndices);
+
+        bool bestIndexFound(false);
+        unsigned int bestIndex2(std::numeric_limits<unsigned int>::max());
+
+        for (const unsigned int index2 : neighbourIndices)
         {
-            const float separationSquared((position1 - position2).GetMagnitudeSquared());
+            const float separationSquared((position1 - spacepoints2.at(index2)).GetMagnitudeSquared());
+
+            const bool isTiedEarlierIndex(bestIndexFound && (separationSquared == bestSeparationSquared) && (index2 < bestIndex2));
 
-            if (separationSquared < bestSeparationSquared)
+            if ((separationSquared < bestSeparationSquared) || isTiedEarlierIndex)
             {
-                bestCrossingFound = true;
+                bestIndexFound = true;
                 bestSeparationSquared = separationSquared;
-                bestPosition1 = position1;
-                bestPosition2 = position2;
+                bestIndex2 = index2;
             }
         }
+
+        if (bestIndexFound)
+        {
+            bestCrossingFound = true;
+            bestPosition1 = position1;
+            bestPosition2 = spacepoints2.at(bestIndex2);
+        }
     }
 
     if (bestCrossingFound)
     {
-        bool alreadyPopulated(false);
-
-        for (const CartesianVector &existingPosition : crossingPoints)
-        {
-            if (((existingPosition - bestPosition1).GetMagnitudeSquared() < m_minNearbyCrossingDistanceSquared) ||
-                ((existingPosition - bestPosition2).GetMagnitudeSquared() < m_minNearbyCrossingDistanceSquared))
-            {
-                alreadyPopulated = true;
-                break;
-            }
-        }
+        const bool alreadyPopulated(this->IsNearExistingCrossing(bestPosition1, crossingPointGrid, crossingPoints) ||
+            this->IsNearExistingCrossing(bestPosition2, crossingPointGrid, crossingPoints));
 
         if (!alreadyPopulated)
         {
+            crossingPointGrid.AddPoint(bestPosition1, crossingPoints.size());
             crossingPoints.push_back(bestPosition1);
+            crossingPointGrid.AddPoint(bestPosition2, crossingPoints.size());
             crossingPoints.push_back(bestPosition2);
         }
     }
@@ -348,14 +436,51 @@ void CandidateVertexCreationAlgorithm::FindCrossingPoints(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool CandidateVertexCreationAlgorithm::IsNearExistingCrossing(
+    const CartesianVector &position, const TwoDPointGrid &crossingPointGrid, const CartesianPointVector &crossingPoints) const
+{
+    IndexVector neighbourIndices;
+    crossingPointGrid.GetNeighbourIndices(position, neighbourIndices);
+
+    for (const unsigned int index : neighbourIndices)
+    {
+        if ((crossingPoints.at(index) - position).GetMagnitudeSquared() < m_minNearbyCrossingDistanceSquared)
+            return true;
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void CandidateVertexCreationAlgorithm::CreateCrossingVertices(const CartesianPointVector &crossingPoints1,
     const CartesianPointVector &crossingPoints2, const HitType hitType1, const HitType hitType2, unsigned int &nCrossingCandidates) const
 {
+    // ATTN Only crossing points within the max x discrepancy can be matched, so bucket the view 2 points by x and visit the remaining
+    // pairs in the original order
+    IndexVector sortedIndices2;
+    this->GetIndicesSortedByX(crossingPoints2, sortedIndices2);
+
+    LArProcessingBudgetHelper::Checkpoint budgetCheckpoint(this->GetPandora());
 
     for (const CartesianVector &position1 : crossingPoints1)
     {
-        for (const CartesianVector &position2 : crossingPoints2)
+        if ((nCrossingCandidates > m_nMaxCrossingCandidates) || budgetCheckpoint.IsExhausted(crossingPoints2.size()))
+            return;
+
+        const float x1(position1.GetX());
+        const IndexVector::const_iterator beginIter(std::partition_point(sortedIndices2.cbegin(), sortedIndices2.cend(),
+            [&](const unsigned int index2) { return (x1 - crossingPoints2.at(index2).GetX() > m_maxCrossingXDiscrepancy); }));
+        const IndexVector::const_iterator endIter(std::partition_point(beginIter, sortedIndices2.cend(),
+            [&](const unsigned int index2) { return !(crossingPoints2.at(index2).GetX() - x1 > m_maxCrossingXDiscrepancy); }));
+
+        IndexVector candidateIndices2(beginIter, endIter);
+        std::sort(candidateIndices2.begin(), candidateIndices2.end());
+
+        for (const unsigned int index2 : candidateIndices2)
         {
+            const CartesianVector &position2(crossingPoints2.at(index2));
+
             if (nCrossingCandidates > m_nMaxCrossingCandidates)
                 return;
 
@@ -383,6 +508,17 @@ void CandidateVertexCreationAlgorithm::CreateCrossingVertices(const CartesianPoi
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void CandidateVertexCreationAlgorithm::GetIndicesSortedByX(const CartesianPointVector &points, IndexVector &sortedIndices) const
+{
+    for (unsigned int index = 0; index < points.size(); ++index)
+        sortedIndices.push_back(index);
+
+    std::stable_sort(sortedIndices.begin(), sortedIndices.end(),
+        [&points](const unsigned int lhs, const unsigned int rhs) { return points.at(lhs).GetX() < points.at(rhs).GetX(); });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void CandidateVertexCreationAlgorithm::AddInputVertices() const
 {
     const VertexList *pInputVertexList{nullptr};
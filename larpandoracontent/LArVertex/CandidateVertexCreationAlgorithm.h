@@ -8,6 +8,7 @@
 #ifndef LAR_CANDIDATE_VERTEX_CREATION_ALGORITHM_H
 #define LAR_CANDIDATE_VERTEX_CREATION_ALGORITHM_H 1
 
+#include "larpandoracontent/LArObjects/LArTwoDPointGrid.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
 #include "Pandora/Algorithm.h"
@@ -29,6 +30,8 @@ public:
     CandidateVertexCreationAlgorithm();
 
 private:
+    typedef TwoDPointGrid::IndexVector IndexVector;
+
     pandora::StatusCode Run();
 
     /**
@@ -88,10 +91,32 @@ private:
      *
      *  @param  spacepoints1 space points for cluster 1
      *  @param  spacepoints2 space points for cluster 2
+     *  @param  spacepointGrid2 the grid of space points for cluster 2
+     *  @param  crossingPointGrid the grid of crossing points identified so far, to be updated
      *  @param  crossingPoints to receive the list of plausible 2D crossing points
      */
     void FindCrossingPoints(const pandora::CartesianPointVector &spacepoints1, const pandora::CartesianPointVector &spacepoints2,
-        pandora::CartesianPointVector &crossingPoints) const;
+        const TwoDPointGrid &spacepointGrid2, TwoDPointGrid &crossingPointGrid, pandora::CartesianPointVector &crossingPoints) const;
+
+    /**
+     *  @brief  Whether a position lies within the minimum nearby crossing distance of any crossing point identified so far
+     *
+     *  @param  position the position
+     *  @param  crossingPointGrid the grid of crossing points identified so far
+     *  @param  crossingPoints the crossing points identified so far
+     *
+     *  @return boolean
+     */
+    bool IsNearExistingCrossing(const pandora::CartesianVector &position, const TwoDPointGrid &crossingPointGrid,
+        const pandora::CartesianPointVector &crossingPoints) const;
+
+    /**
+     *  @brief  Get the indices of a vector of points, sorted by point x coordinate
+     *
+     *  @param  points the points
+     *  @param  sortedIndices to receive the sorted indices
+     */
+    void GetIndicesSortedByX(const pandora::CartesianPointVector &points, IndexVector &sortedIndices) const;
 
     /**
      *  @brief  Attempt to create candidate vertex positions, using 2D crossing points in 2 views
@@ -131,8 +156,6 @@ private:
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
-    typedef std::unordered_map<const pandora::Cluster *, pandora::CartesianPointVector> ClusterToSpacepointsMap;
-
     pandora::StringVector m_inputClusterListNames; ///< The list of cluster list names
     std::string m_inputVertexListName;             ///< The list name for existing candidate vertices
     std::string m_outputVertexListName;            ///< The name under which to save the output vertex list
@@ -75,11 +75,8 @@ void MvaVertexSelectionAlgorithm<T>::GetVertexScoreList(const VertexVector &vert
     this->AddEventFeaturesToVector(eventFeatureInfo, eventFeatureList);
 
     VertexFeatureInfoMap vertexFeatureInfoMap;
-    for (const Vertex *const pVertex : vertexVector)
-    {
-        this->PopulateVertexFeatureInfoMap(
-            beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, pVertex, vertexFeatureInfoMap);
-    }
+    this->PopulateVertexFeatureInfoMap(
+        beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, vertexVector, vertexFeatureInfoMap);
 
     // Use a simple score to get the list of vertices representing good regions.
     VertexScoreList initialScoreList;
@@ -130,6 +127,9 @@ const pandora::Vertex *MvaVertexSelectionAlgorithm<T>::CompareVertices(const Ver
     const Vertex *pBestVertex(vertexVector.front());
     LArMvaHelper::MvaFeatureVector chosenFeatureList;
 
+    // ATTN The per-comparison feature vectors are reused, to avoid reallocating them for every candidate vertex
+    LArMvaHelper::MvaFeatureVector featureList, sharedFeatureList, concatenatedFeatureList;
+
     VertexFeatureInfo chosenVertexFeatureInfo(vertexFeatureInfoMap.at(pBestVertex));
     this->AddVertexFeaturesToVector(chosenVertexFeatureInfo, chosenFeatureList, useRPhi);
 
@@ -138,19 +138,21 @@ const pandora::Vertex *MvaVertexSelectionAlgorithm<T>::CompareVertices(const Ver
         if (pVertex == pBestVertex)
             continue;
 
-        LArMvaHelper::MvaFeatureVector featureList;
+        featureList.clear();
         VertexFeatureInfo vertexFeatureInfo(vertexFeatureInfoMap.at(pVertex));
         this->AddVertexFeaturesToVector(vertexFeatureInfo, featureList, useRPhi);
 
         if (!m_legacyVariables)
         {
-            LArMvaHelper::MvaFeatureVector sharedFeatureList;
+            sharedFeatureList.clear();
             float separation(0.f), axisHits(0.f);
             this->GetSharedFeatures(pVertex, pBestVertex, kdTreeMap, separation, axisHits);
             VertexSharedFeatureInfo sharedFeatureInfo(separation, axisHits);
             this->AddSharedFeaturesToVector(sharedFeatureInfo, sharedFeatureList);
 
-            if (LArMvaHelper::Classify(t, LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, featureList, chosenFeatureList, sharedFeatureList)))
+            LArMvaHelper::FillConcatenatedFeatureVector(concatenatedFeatureList, eventFeatureList, featureList, chosenFeatureList, sharedFeatureList);
+
+            if (LArMvaHelper::Classify(t, concatenatedFeatureList))
             {
                 pBestVertex = pVertex;
                 chosenFeatureList = featureList;
@@ -158,7 +160,9 @@ const pandora::Vertex *MvaVertexSelectionAlgorithm<T>::CompareVertices(const Ver
         }
         else
         {
-            if (LArMvaHelper::Classify(t, LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, featureList, chosenFeatureList)))
+            LArMvaHelper::FillConcatenatedFeatureVector(concatenatedFeatureList, eventFeatureList, featureList, chosenFeatureList);
+
+            if (LArMvaHelper::Classify(t, concatenatedFeatureList))
             {
                 pBestVertex = pVertex;
                 chosenFeatureList = featureList;
@@ -10,6 +10,8 @@
 #include "Pandora/AlgorithmHeaders.h"
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArInstrumentationHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
@@ -29,7 +31,10 @@ RPhiFeatureTool::RPhiFeatureTool() :
     m_fastHistogramNPhiBins(200),
     m_fastHistogramPhiMin(-1.1f * M_PI),
     m_fastHistogramPhiMax(+1.1f * M_PI),
-    m_enableFolding(true)
+    m_enableFolding(true),
+    m_shareHitSearches(true),
+    m_candidateGroupSize(10.f),
+    m_searchRegionMargin(0.1f)
 {
 }
 
@@ -79,6 +84,117 @@ void RPhiFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const V
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void RPhiFeatureTool::CalculateFeatures(const VertexSelectionBaseAlgorithm *const pAlgorithm, const VertexVector &vertexVector,
+    const VertexSelectionBaseAlgorithm::KDTreeMap &kdTreeMap, const FloatVector &beamDeweightingScores, const unsigned int nThreads,
+    float &bestFastScore, FloatVector &features) const
+{
+    if (beamDeweightingScores.size() != vertexVector.size())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
+        std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
+
+    const unsigned int nVertices(vertexVector.size());
+    const bool useFastScore(m_fastScoreCheck || m_fastScoreOnly);
+
+    const HitTypeVector hitTypeVector({TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W});
+
+    std::vector<KernelEstimate> kernelEstimates(3 * nVertices, KernelEstimate(m_kernelEstimateSigma));
+    FloatVector fastScores(nVertices, 0.f);
+
+    // Nearby candidates share most of their hits, so each group of nearby candidates is served by a single kd tree search per view
+    std::vector<CartesianPointVector> vertexPositions(hitTypeVector.size());
+    std::vector<std::vector<unsigned int>> groupIndices(hitTypeVector.size());
+    std::vector<std::vector<VertexSelectionBaseAlgorithm::HitKDNode2DList>> groupHitLists(hitTypeVector.size());
+
+    if (m_shareHitSearches)
+    {
+        for (unsigned int iView = 0; iView < hitTypeVector.size(); ++iView)
+        {
+            const HitType hitType(hitTypeVector.at(iView));
+            this->SearchCandidateGroups(vertexVector, hitType, kdTreeMap.at(hitType), nThreads, vertexPositions.at(iView),
+                groupIndices.at(iView), groupHitLists.at(iView));
+        }
+
+        const unsigned int nGroupSearches(groupHitLists.at(0).size() + groupHitLists.at(1).size() + groupHitLists.at(2).size());
+        LArInstrumentationHelper::AddToCounter(*this, "nHitSearches", static_cast<double>(nGroupSearches));
+        LArInstrumentationHelper::AddToCounter(
+            *this, "nHitSearchesSaved", static_cast<double>(hitTypeVector.size() * nVertices - nGroupSearches));
+
+        if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
+        {
+            std::cout << "RPhiFeatureTool: " << nVertices << " candidate vertices, kd tree searches per view (u, v, w): "
+                      << groupHitLists.at(0).size() << ", " << groupHitLists.at(1).size() << ", " << groupHitLists.at(2).size()
+                      << std::endl;
+        }
+    }
+
+    LArParallelHelper::ParallelFor(nVertices, nThreads, [&](const unsigned int index) {
+        for (unsigned int iView = 0; iView < hitTypeVector.size(); ++iView)
+        {
+            const HitType hitType(hitTypeVector.at(iView));
+            KernelEstimate &kernelEstimate(kernelEstimates.at(3 * index + iView));
+
+            if (m_shareHitSearches)
+            {
+                const VertexSelectionBaseAlgorithm::HitKDNode2DList &hitList(groupHitLists.at(iView).at(groupIndices.at(iView).at(index)));
+                this->FillKernelEstimate(vertexPositions.at(iView).at(index), hitList, kernelEstimate);
+            }
+            else
+            {
+                this->FillKernelEstimate(vertexVector.at(index), hitType, kdTreeMap.at(hitType), kernelEstimate);
+            }
+        }
+
+        const KernelEstimate &kernelEstimateU(kernelEstimates.at(3 * index));
+        const KernelEstimate &kernelEstimateV(kernelEstimates.at(3 * index + 1));
+        const KernelEstimate &kernelEstimateW(kernelEstimates.at(3 * index + 2));
+
+        if (useFastScore)
+            fastScores.at(index) = this->GetFastScore(kernelEstimateU, kernelEstimateV, kernelEstimateW);
+    });
+
+    // Replay the fast score check in vertex order, identifying the vertices that require the midway or full score
+    features.assign(nVertices, 0.f);
+    std::vector<unsigned int> scoredIndices;
+
+    for (unsigned int index = 0; index < nVertices; ++index)
+    {
+        if (useFastScore)
+        {
+            const float fastScore(fastScores.at(index));
+
+            if (m_fastScoreOnly)
+            {
+                features.at(index) = fastScore;
+                continue;
+            }
+
+            const float expBeamDeweightingScore = std::exp(beamDeweightingScores.at(index));
+
+            if (expBeamDeweightingScore * fastScore < m_minFastScoreFraction * bestFastScore)
+                continue;
+
+            if (expBeamDeweightingScore * fastScore > bestFastScore)
+                bestFastScore = expBeamDeweightingScore * fastScore;
+        }
+
+        scoredIndices.push_back(index);
+    }
+
+    LArParallelHelper::ParallelFor(scoredIndices.size(), nThreads, [&](const unsigned int iScored) {
+        const unsigned int index(scoredIndices.at(iScored));
+        const KernelEstimate &kernelEstimateU(kernelEstimates.at(3 * index));
+        const KernelEstimate &kernelEstimateV(kernelEstimates.at(3 * index + 1));
+        const KernelEstimate &kernelEstimateW(kernelEstimates.at(3 * index + 2));
+
+        features.at(index) = m_fullScore ? this->GetFullScore(kernelEstimateU, kernelEstimateV, kernelEstimateW)
+                                         : this->GetMidwayScore(kernelEstimateU, kernelEstimateV, kernelEstimateW);
+    });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float RPhiFeatureTool::GetFastScore(const KernelEstimate &kernelEstimateU, const KernelEstimate &kernelEstimateV, const KernelEstimate &kernelEstimateW) const
 {
     Histogram histogramU(m_fastHistogramNPhiBins, m_fastHistogramPhiMin, m_fastHistogramPhiMax);
@@ -167,13 +283,34 @@ void RPhiFeatureTool::FillKernelEstimate(const Vertex *const pVertex, const HitT
     VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree, KernelEstimate &kernelEstimate) const
 {
     const CartesianVector vertexPosition2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), hitType));
-    KDTreeBox searchRegionHits = build_2d_kd_search_region(vertexPosition2D, m_maxHitVertexDisplacement1D, m_maxHitVertexDisplacement1D);
+    const float searchSpan(m_maxHitVertexDisplacement1D + m_searchRegionMargin);
+    const KDTreeBox searchRegionHits(build_2d_kd_search_region(vertexPosition2D, searchSpan, searchSpan));
 
     VertexSelectionBaseAlgorithm::HitKDNode2DList found;
     kdTree.search(searchRegionHits, found);
 
-    for (const auto &hit : found)
+    this->FillKernelEstimate(vertexPosition2D, found, kernelEstimate);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RPhiFeatureTool::FillKernelEstimate(
+    const CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::HitKDNode2DList &hitList, KernelEstimate &kernelEstimate) const
+{
+    const KDTreeBox searchRegionHits(
+        build_2d_kd_search_region(vertexPosition2D, m_maxHitVertexDisplacement1D, m_maxHitVertexDisplacement1D));
+
+    for (const auto &hit : hitList)
     {
+        // ATTN The kd tree search region is padded and may drop hits on its edge, so the search region of the vertex is applied here
+        bool isInside(true);
+
+        for (unsigned int i = 0; i < 2; ++i)
+            isInside = isInside && (hit.dims[i] >= searchRegionHits.dimmin[i]) && (hit.dims[i] <= searchRegionHits.dimmax[i]);
+
+        if (!isInside)
+            continue;
+
         const CartesianVector displacement(hit.data->GetPositionVector() - vertexPosition2D);
         const float magnitude(displacement.GetMagnitude());
 
@@ -195,6 +332,62 @@ void RPhiFeatureTool::FillKernelEstimate(const Vertex *const pVertex, const HitT
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void RPhiFeatureTool::SearchCandidateGroups(const VertexVector &vertexVector, const HitType hitType,
+    VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree, const unsigned int nThreads, CartesianPointVector &vertexPositions,
+    std::vector<unsigned int> &groupIndices, std::vector<VertexSelectionBaseAlgorithm::HitKDNode2DList> &groupHitLists) const
+{
+    typedef std::pair<int, int> CellKey;
+    std::map<CellKey, unsigned int> cellToGroupMap;
+    std::vector<KDTreeBox> groupSearchRegions;
+
+    for (const Vertex *const pVertex : vertexVector)
+    {
+        const CartesianVector vertexPosition2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), hitType));
+        const KDTreeBox searchRegion(
+            build_2d_kd_search_region(vertexPosition2D, m_maxHitVertexDisplacement1D, m_maxHitVertexDisplacement1D));
+        const CellKey cellKey(static_cast<int>(std::floor(vertexPosition2D.GetX() / m_candidateGroupSize)),
+            static_cast<int>(std::floor(vertexPosition2D.GetZ() / m_candidateGroupSize)));
+
+        // Groups are numbered in order of first appearance, and each group search region bounds the search regions of its members
+        const auto insertResult(cellToGroupMap.emplace(cellKey, groupSearchRegions.size()));
+
+        if (insertResult.second)
+        {
+            groupSearchRegions.push_back(searchRegion);
+        }
+        else
+        {
+            KDTreeBox &groupSearchRegion(groupSearchRegions.at(insertResult.first->second));
+
+            for (unsigned int i = 0; i < 2; ++i)
+            {
+                groupSearchRegion.dimmin[i] = std::min(groupSearchRegion.dimmin[i], searchRegion.dimmin[i]);
+                groupSearchRegion.dimmax[i] = std::max(groupSearchRegion.dimmax[i], searchRegion.dimmax[i]);
+            }
+        }
+
+        vertexPositions.push_back(vertexPosition2D);
+        groupIndices.push_back(insertResult.first->second);
+    }
+
+    // ATTN Pad as for a dedicated search, so that no hit within the search region of any member can be dropped at the group region edge
+    for (KDTreeBox &groupSearchRegion : groupSearchRegions)
+    {
+        for (unsigned int i = 0; i < 2; ++i)
+        {
+            groupSearchRegion.dimmin[i] -= m_searchRegionMargin;
+            groupSearchRegion.dimmax[i] += m_searchRegionMargin;
+        }
+    }
+
+    groupHitLists.assign(groupSearchRegions.size(), VertexSelectionBaseAlgorithm::HitKDNode2DList());
+
+    LArParallelHelper::ParallelFor(groupSearchRegions.size(), nThreads,
+        [&](const unsigned int iGroup) { kdTree.search(groupSearchRegions.at(iGroup), groupHitLists.at(iGroup)); });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float RPhiFeatureTool::atan2Fast(const float y, const float x) const
 {
     const float ONE_QTR_PI(0.25f * M_PI);
@@ -270,6 +463,27 @@ StatusCode RPhiFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "EnableFolding", m_enableFolding));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ShareHitSearches", m_shareHitSearches));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "CandidateGroupSize", m_candidateGroupSize));
+
+    if (m_candidateGroupSize < std::numeric_limits<float>::epsilon())
+    {
+        std::cout << "RPhiFeatureTool: CandidateGroupSize must be positive" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SearchRegionMargin", m_searchRegionMargin));
+
+    if (m_searchRegionMargin < std::numeric_limits<float>::epsilon())
+    {
+        std::cout << "RPhiFeatureTool: SearchRegionMargin must be positive" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -42,6 +42,23 @@ public:
         const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &kdTreeMap,
         const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const float beamDeweightingScore, float &bestFastScore);
 
+    /**
+     *  @brief  Calculate the r/phi features of a vector of vertices, with the same result as running the tool for each vertex in turn.
+     *          The kernel estimates and scores are evaluated concurrently; only the fast score check, which depends on the best fast
+     *          score of the preceding vertices, is applied serially.
+     *
+     *  @param  pAlgorithm address of the calling algorithm
+     *  @param  vertexVector the vector of vertices
+     *  @param  kdTreeMap map of the hit kd trees
+     *  @param  beamDeweightingScores the beam deweighting score for each vertex
+     *  @param  nThreads the max number of threads to use
+     *  @param  bestFastScore the best fast score
+     *  @param  features to receive the r/phi feature for each vertex
+     */
+    void CalculateFeatures(const VertexSelectionBaseAlgorithm *const pAlgorithm, const pandora::VertexVector &vertexVector,
+        const VertexSelectionBaseAlgorithm::KDTreeMap &kdTreeMap, const pandora::FloatVector &beamDeweightingScores,
+        const unsigned int nThreads, float &bestFastScore, pandora::FloatVector &features) const;
+
 private:
     /**
      *  @brief Kernel estimate class
@@ -142,6 +159,33 @@ private:
     void FillKernelEstimate(const pandora::Vertex *const pVertex, const pandora::HitType hitType,
         VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree, KernelEstimate &kernelEstimate) const;
 
+    /**
+     *  @brief  Use hits found by an earlier kd tree search to fill a provided kernel estimate with hit-vertex relationship information.
+     *          Only hits within the search region of the vertex contribute, so the search may have covered a larger region.
+     *
+     *  @param  vertexPosition2D the vertex position, projected into the relevant view
+     *  @param  hitList the hits found by a kd tree search covering the search region of the vertex
+     *  @param  kernelEstimate to receive the populated kernel estimate
+     */
+    void FillKernelEstimate(const pandora::CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::HitKDNode2DList &hitList,
+        KernelEstimate &kernelEstimate) const;
+
+    /**
+     *  @brief  Group candidate vertices that are close together in a given view and search the kd tree once per group, for a padded region
+     *          containing the search regions of all vertices in the group
+     *
+     *  @param  vertexVector the vector of vertices
+     *  @param  hitType the relevant hit type
+     *  @param  kdTree the relevant kd tree
+     *  @param  nThreads the max number of threads to use
+     *  @param  vertexPositions to receive the projected position of each vertex
+     *  @param  groupIndices to receive the index of the group of each vertex
+     *  @param  groupHitLists to receive the hits found for each group
+     */
+    void SearchCandidateGroups(const pandora::VertexVector &vertexVector, const pandora::HitType hitType,
+        VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree, const unsigned int nThreads, pandora::CartesianPointVector &vertexPositions,
+        std::vector<unsigned int> &groupIndices, std::vector<VertexSelectionBaseAlgorithm::HitKDNode2DList> &groupHitLists) const;
+
     /**
      *  @brief  Whether to accept a candidate vertex, based on its spatial position in relation to other selected candidates
      *
@@ -176,6 +220,10 @@ private:
     float m_fastHistogramPhiMax;          ///< Max value for fast score histograms
 
     bool m_enableFolding; ///< Whether to enable folding of -pi -> +pi phi distribution into 0 -> +pi region only
+
+    bool m_shareHitSearches;    ///< Whether to search for the hits of nearby candidate vertices together, when evaluating many vertices
+    float m_candidateGroupSize; ///< The size of the 2D cells used to group nearby candidate vertices for a shared hit search
+    float m_searchRegionMargin; ///< The padding added to each kd tree search region, so that hits on a vertex search region edge are kept
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -14,6 +14,7 @@
 #include "larpandoracontent/LArHelpers/LArInteractionTypeHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 
 #include "larpandoracontent/LArVertex/EnergyDepositionAsymmetryFeatureTool.h"
 #include "larpandoracontent/LArVertex/EnergyKickFeatureTool.h"
@@ -38,6 +39,7 @@ TrainedVertexSelectionAlgorithm::TrainedVertexSelectionAlgorithm() :
     m_trainingSetMode(false),
     m_allowClassifyDuringTraining(false),
     m_mcVertexXCorrection(0.f),
+    m_trainingOutputFormat("csv"),
     m_minClusterCaloHits(12),
     m_slidingFitWindow(100),
     m_minShowerSpineLength(15.f),
@@ -56,7 +58,8 @@ TrainedVertexSelectionAlgorithm::TrainedVertexSelectionAlgorithm() :
     m_dropFailedRPhiFastScoreCandidates(true),
     m_testBeamMode(false),
     m_legacyEventShapes(true),
-    m_legacyVariables(true)
+    m_legacyVariables(true),
+    m_nThreads(1)
 {
 }
 
@@ -130,7 +133,8 @@ void TrainedVertexSelectionAlgorithm::GetShowerLikeClusterEndPoints(
         CaloHitList clusterCaloHitList;
         pCluster->GetOrderedCaloHitList().FillCaloHitList(clusterCaloHitList);
 
-        CaloHitVector clusterCaloHitVector(clusterCaloHitList.begin(), clusterCaloHitList.end());
+        std::pmr::vector<const CaloHit *> clusterCaloHitVector(
+            clusterCaloHitList.begin(), clusterCaloHitList.end(), this->GetTransientMemoryResource());
         std::sort(clusterCaloHitVector.begin(), clusterCaloHitVector.end(), LArClusterHelper::SortHitsByPosition);
 
         if (clusterCaloHitVector.empty())
@@ -428,6 +432,34 @@ void TrainedVertexSelectionAlgorithm::AddEventFeaturesToVector(const EventFeatur
 void TrainedVertexSelectionAlgorithm::PopulateVertexFeatureInfoMap(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
     const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
     const Vertex *const pVertex, VertexFeatureInfoMap &vertexFeatureInfoMap) const
+{
+    vertexFeatureInfoMap.emplace(
+        pVertex, this->CalculateVertexFeatureInfo(beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, pVertex));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrainedVertexSelectionAlgorithm::PopulateVertexFeatureInfoMap(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
+    const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+    const VertexVector &vertexVector, VertexFeatureInfoMap &vertexFeatureInfoMap) const
+{
+    std::vector<VertexFeatureInfo> vertexFeatureInfoVector(vertexVector.size(), VertexFeatureInfo(0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f));
+
+    LArParallelHelper::ParallelFor(vertexVector.size(), m_nThreads, [&](const unsigned int index) {
+        vertexFeatureInfoVector.at(index) = this->CalculateVertexFeatureInfo(
+            beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, vertexVector.at(index));
+    });
+
+    // ATTN Merge in vertex order, so that the map is populated exactly as by the serial, vertex by vertex, method
+    for (unsigned int index = 0; index < vertexVector.size(); ++index)
+        vertexFeatureInfoMap.emplace(vertexVector.at(index), vertexFeatureInfoVector.at(index));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TrainedVertexSelectionAlgorithm::VertexFeatureInfo TrainedVertexSelectionAlgorithm::CalculateVertexFeatureInfo(const BeamConstants &beamConstants,
+    const ClusterListMap &clusterListMap, const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap,
+    const KDTreeMap &kdTreeMap, const Vertex *const pVertex) const
 {
     float bestFastScore(-std::numeric_limits<float>::max()); // not actually used - artefact of toolizing RPhi score and still using performance trick
 
@@ -473,8 +505,7 @@ void TrainedVertexSelectionAlgorithm::PopulateVertexFeatureInfoMap(const BeamCon
         vertexEnergy = this->GetVertexEnergy(pVertex, kdTreeMap);
     }
 
-    VertexFeatureInfo vertexFeatureInfo(beamDeweighting, 0.f, energyKick, localAsymmetry, globalAsymmetry, showerAsymmetry, dEdxAsymmetry, vertexEnergy);
-    vertexFeatureInfoMap.emplace(pVertex, vertexFeatureInfo);
+    return VertexFeatureInfo(beamDeweighting, 0.f, energyKick, localAsymmetry, globalAsymmetry, showerAsymmetry, dEdxAsymmetry, vertexEnergy);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -573,6 +604,43 @@ void TrainedVertexSelectionAlgorithm::CalculateRPhiScores(
 {
     float bestFastScore(-std::numeric_limits<float>::max());
 
+    const RPhiFeatureTool *pRPhiFeatureTool(nullptr);
+    unsigned int nRPhiFeatureTools(0);
+
+    for (const VertexFeatureTool *const pFeatureTool : m_featureToolVector)
+    {
+        if (const RPhiFeatureTool *const pCastFeatureTool = dynamic_cast<const RPhiFeatureTool *>(pFeatureTool))
+        {
+            pRPhiFeatureTool = pCastFeatureTool;
+            ++nRPhiFeatureTools;
+        }
+    }
+
+    // ATTN The concurrent evaluation reproduces a single r/phi tool; other configurations are evaluated vertex by vertex below
+    if (1 == nRPhiFeatureTools)
+    {
+        FloatVector beamDeweightingScores, rPhiFeatures;
+
+        for (const Vertex *const pVertex : vertexVector)
+            beamDeweightingScores.push_back(vertexFeatureInfoMap.at(pVertex).m_beamDeweighting);
+
+        pRPhiFeatureTool->CalculateFeatures(this, vertexVector, kdTreeMap, beamDeweightingScores, m_nThreads, bestFastScore, rPhiFeatures);
+
+        VertexVector selectedVertices;
+
+        for (unsigned int index = 0; index < vertexVector.size(); ++index)
+        {
+            VertexFeatureInfo &vertexFeatureInfo = vertexFeatureInfoMap.at(vertexVector.at(index));
+            vertexFeatureInfo.m_rPhiFeature = rPhiFeatures.at(index);
+
+            if (!(m_dropFailedRPhiFastScoreCandidates && (vertexFeatureInfo.m_rPhiFeature <= std::numeric_limits<float>::epsilon())))
+                selectedVertices.push_back(vertexVector.at(index));
+        }
+
+        vertexVector = selectedVertices;
+        return;
+    }
+
     for (auto iter = vertexVector.begin(); iter != vertexVector.end(); /* no increment */)
     {
         VertexFeatureInfo &vertexFeatureInfo = vertexFeatureInfoMap.at(*iter);
@@ -639,8 +707,25 @@ const pandora::Vertex *TrainedVertexSelectionAlgorithm::ProduceTrainingExamples(
     VertexFeatureInfo bestVertexFeatureInfo(vertexFeatureInfoMap.at(pBestVertex));
     this->AddVertexFeaturesToVector(bestVertexFeatureInfo, bestVertexFeatureList, useRPhi);
 
-    for (const Vertex *const pVertex : vertexVector)
+    // Calculate the shared features with the best vertex concurrently, then produce the examples in vertex order
+    std::vector<VertexSharedFeatureInfo> sharedFeatureInfoVector(vertexVector.size(), VertexSharedFeatureInfo(0.f, 0.f));
+
+    if (!m_legacyVariables)
+    {
+        LArParallelHelper::ParallelFor(vertexVector.size(), m_nThreads, [&](const unsigned int index) {
+            if (vertexVector.at(index) == pBestVertex)
+                return;
+
+            float separation(0.f), axisHits(0.f);
+            this->GetSharedFeatures(vertexVector.at(index), pBestVertex, kdTreeMap, separation, axisHits);
+            sharedFeatureInfoVector.at(index) = VertexSharedFeatureInfo(separation, axisHits);
+        });
+    }
+
+    for (unsigned int index = 0; index < vertexVector.size(); ++index)
     {
+        const Vertex *const pVertex(vertexVector.at(index));
+
         if (pVertex == pBestVertex)
             continue;
 
@@ -651,18 +736,15 @@ const pandora::Vertex *TrainedVertexSelectionAlgorithm::ProduceTrainingExamples(
         if (!m_legacyVariables)
         {
             LArMvaHelper::MvaFeatureVector sharedFeatureList;
-            float separation(0.f), axisHits(0.f);
-            this->GetSharedFeatures(pVertex, pBestVertex, kdTreeMap, separation, axisHits);
-            VertexSharedFeatureInfo sharedFeatureInfo(separation, axisHits);
-            this->AddSharedFeaturesToVector(sharedFeatureInfo, sharedFeatureList);
+            this->AddSharedFeaturesToVector(sharedFeatureInfoVector.at(index), sharedFeatureList);
 
             if (pBestVertex && (bestVertexDr < maxRadius))
             {
                 if (coinFlip(generator))
-                    LArMvaHelper::ProduceTrainingExample(trainingOutputFile + "_" + interactionType + ".txt", true,
+                    LArMvaHelper::ProduceTrainingExample(m_trainingSink, trainingOutputFile + "_" + interactionType + ".txt", true,
                         LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, bestVertexFeatureList, featureList, sharedFeatureList));
                 else
-                    LArMvaHelper::ProduceTrainingExample(trainingOutputFile + "_" + interactionType + ".txt", false,
+                    LArMvaHelper::ProduceTrainingExample(m_trainingSink, trainingOutputFile + "_" + interactionType + ".txt", false,
                         LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, featureList, bestVertexFeatureList, sharedFeatureList));
             }
         }
@@ -671,10 +753,10 @@ const pandora::Vertex *TrainedVertexSelectionAlgorithm::ProduceTrainingExamples(
             if (pBestVertex && (bestVertexDr < maxRadius))
             {
                 if (coinFlip(generator))
-                    LArMvaHelper::ProduceTrainingExample(trainingOutputFile + "_" + interactionType + ".txt", true,
+                    LArMvaHelper::ProduceTrainingExample(m_trainingSink, trainingOutputFile + "_" + interactionType + ".txt", true,
                         LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, bestVertexFeatureList, featureList));
                 else
-                    LArMvaHelper::ProduceTrainingExample(trainingOutputFile + "_" + interactionType + ".txt", false,
+                    LArMvaHelper::ProduceTrainingExample(m_trainingSink, trainingOutputFile + "_" + interactionType + ".txt", false,
                         LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, featureList, bestVertexFeatureList));
             }
         }
@@ -878,6 +960,10 @@ StatusCode TrainedVertexSelectionAlgorithm::ReadSettings(const TiXmlHandle xmlHa
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "TrainingOutputFileVertex", m_trainingOutputFileVertex));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFormat", m_trainingOutputFormat));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_trainingSink.SetFormat(m_trainingOutputFormat));
+
     if (m_trainingSetMode && (m_trainingOutputFileRegion.empty() || m_trainingOutputFileVertex.empty()))
     {
         std::cout << "TrainedVertexSelectionAlgorithm: TrainingOutputFileRegion and TrainingOutputFileVertex are required for training set "
@@ -952,6 +1038,10 @@ StatusCode TrainedVertexSelectionAlgorithm::ReadSettings(const TiXmlHandle xmlHa
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "LegacyVariables", m_legacyVariables));
 
+    // ATTN Zero threads requests one per hardware thread
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NThreads", m_nThreads));
+    m_nThreads = LArParallelHelper::GetNThreads(m_nThreads);
+
     if (m_trainingSetMode && m_legacyEventShapes)
         std::cout << "TrainedVertexSelectionAlgorithm: WARNING -- Producing training sample using incorrect legacy event shapes, consider turning LegacyEventShapes off"
                   << std::endl;
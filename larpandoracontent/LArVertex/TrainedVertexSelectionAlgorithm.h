@@ -11,6 +11,7 @@
 #include "Api/PandoraContentApi.h"
 
 #include "larpandoracontent/LArObjects/LArAdaBoostDecisionTree.h"
+#include "larpandoracontent/LArObjects/LArMvaTrainingSink.h"
 #include "larpandoracontent/LArObjects/LArSupportVectorMachine.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
@@ -309,6 +310,37 @@ protected:
         const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
         const pandora::Vertex *const pVertex, VertexFeatureInfoMap &vertexFeatureInfoMap) const;
 
+    /**
+     *  @brief  Populate the vertex feature info map for a vector of vertices, calculating the features of the vertices concurrently
+     *
+     *  @param  beamConstants the beam constants
+     *  @param  clusterListMap the cluster list map
+     *  @param  slidingFitDataListMap the sliding fit data list map
+     *  @param  showerClusterListMap the shower cluster list map
+     *  @param  kdTreeMap the kd tree map
+     *  @param  vertexVector the vector of vertices
+     *  @param  vertexFeatureInfoMap the map to populate
+     */
+    void PopulateVertexFeatureInfoMap(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
+        const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+        const pandora::VertexVector &vertexVector, VertexFeatureInfoMap &vertexFeatureInfoMap) const;
+
+    /**
+     *  @brief  Calculate the features of a given vertex
+     *
+     *  @param  beamConstants the beam constants
+     *  @param  clusterListMap the cluster list map
+     *  @param  slidingFitDataListMap the sliding fit data list map
+     *  @param  showerClusterListMap the shower cluster list map
+     *  @param  kdTreeMap the kd tree map
+     *  @param  pVertex the vertex
+     *
+     *  @return the vertex feature info
+     */
+    VertexFeatureInfo CalculateVertexFeatureInfo(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
+        const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+        const pandora::Vertex *const pVertex) const;
+
     /**
      *  @brief  Populate the initial vertex score list for a given vertex
      *
@@ -455,6 +487,8 @@ protected:
     float m_mcVertexXCorrection;                              ///< The correction to the x-coordinate of the MC vertex position
     std::string m_trainingOutputFileRegion;                   ///< The training output file for the region mva
     std::string m_trainingOutputFileVertex;                   ///< The training output file for the vertex mva
+    std::string m_trainingOutputFormat;                       ///< The training output format, csv or binary
+    mutable MvaTrainingSink m_trainingSink;                   ///< The sink buffering the training examples
     std::string m_mcParticleListName;                         ///< The MC particle list for creating training examples
     std::string m_caloHitListName;                            ///< The 2D CaloHit list name
 
@@ -480,6 +514,7 @@ protected:
     bool m_testBeamMode;                      ///< Test beam mode
     bool m_legacyEventShapes;                 ///< Whether to use the old event shapes calculation
     bool m_legacyVariables;                   ///< Whether to only use the old variables
+    unsigned int m_nThreads;                  ///< The number of threads used to evaluate the vertex features concurrently
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
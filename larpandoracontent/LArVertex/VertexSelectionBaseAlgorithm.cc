@@ -9,6 +9,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArInstrumentationHelper.h"
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
@@ -31,7 +32,8 @@ VertexSelectionBaseAlgorithm::VertexSelectionBaseAlgorithm() :
     m_useDetectorGaps(true),
     m_gapTolerance(0.f),
     m_isEmptyViewAcceptable(true),
-    m_minVertexAcceptableViews(3)
+    m_minVertexAcceptableViews(3),
+    m_useEventArena(false)
 {
 }
 
@@ -122,7 +124,7 @@ void VertexSelectionBaseAlgorithm::CalculateClusterSlidingFits(const ClusterList
 {
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
-    ClusterVector sortedClusters(inputClusterList.begin(), inputClusterList.end());
+    std::pmr::vector<const Cluster *> sortedClusters(inputClusterList.begin(), inputClusterList.end(), this->GetTransientMemoryResource());
     std::sort(sortedClusters.begin(), sortedClusters.end(), LArClusterHelper::SortByNHits);
 
     for (const Cluster *const pCluster : sortedClusters)
@@ -139,8 +141,33 @@ void VertexSelectionBaseAlgorithm::CalculateClusterSlidingFits(const ClusterList
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+std::pmr::memory_resource *VertexSelectionBaseAlgorithm::GetTransientMemoryResource() const
+{
+    return (m_useEventArena ? m_eventArena.GetMemoryResource() : std::pmr::get_default_resource());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode VertexSelectionBaseAlgorithm::Reset()
+{
+    if (m_useEventArena)
+    {
+        const EventArena::Statistics &statistics(m_eventArena.GetStatistics());
+        LArInstrumentationHelper::AddToCounter(*this, "nArenaAllocations", static_cast<double>(statistics.m_nAllocations));
+        LArInstrumentationHelper::AddToCounter(*this, "nArenaBytes", static_cast<double>(statistics.m_nBytes));
+
+        m_eventArena.Reset();
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode VertexSelectionBaseAlgorithm::Run()
 {
+    const LArInstrumentationHelper::ScopedTimer timer(*this, "Run");
+
     const VertexList *pInputVertexList(NULL);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pInputVertexList));
 
@@ -152,12 +179,17 @@ StatusCode VertexSelectionBaseAlgorithm::Run()
         return STATUS_CODE_SUCCESS;
     }
 
-    HitKDTree2D kdTreeU, kdTreeV, kdTreeW;
+    // ATTN The node pools are released in bulk when the arena is reset, at the end of the event
+    std::pmr::memory_resource *const pMemoryResource(m_useEventArena ? m_eventArena.GetMemoryResource() : nullptr);
+    HitKDTree2D kdTreeU(pMemoryResource), kdTreeV(pMemoryResource), kdTreeW(pMemoryResource);
     this->InitializeKDTrees(kdTreeU, kdTreeV, kdTreeW);
 
     VertexVector filteredVertices;
     this->FilterVertexList(pInputVertexList, kdTreeU, kdTreeV, kdTreeW, filteredVertices);
 
+    LArInstrumentationHelper::AddToCounter(*this, "nInputVertices", static_cast<double>(pInputVertexList->size()));
+    LArInstrumentationHelper::AddToCounter(*this, "nFilteredVertices", static_cast<double>(filteredVertices.size()));
+
     if (filteredVertices.empty())
         return STATUS_CODE_SUCCESS;
 
@@ -165,7 +197,10 @@ StatusCode VertexSelectionBaseAlgorithm::Run()
     this->GetBeamConstants(filteredVertices, beamConstants);
 
     VertexScoreList vertexScoreList;
-    this->GetVertexScoreList(filteredVertices, beamConstants, kdTreeU, kdTreeV, kdTreeW, vertexScoreList);
+    {
+        const LArInstrumentationHelper::ScopedTimer scoringTimer(*this, "GetVertexScoreList");
+        this->GetVertexScoreList(filteredVertices, beamConstants, kdTreeU, kdTreeV, kdTreeW, vertexScoreList);
+    }
 
     VertexList selectedVertexList;
     this->SelectTopScoreVertices(vertexScoreList, selectedVertexList);
@@ -429,6 +464,9 @@ StatusCode VertexSelectionBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandl
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "MinVertexAcceptableViews", m_minVertexAcceptableViews));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseEventArena", m_useEventArena));
+
     return STATUS_CODE_SUCCESS;
 }
 
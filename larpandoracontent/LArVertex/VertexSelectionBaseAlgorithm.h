@@ -13,6 +13,7 @@
 
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
 
+#include "larpandoracontent/LArObjects/LArEventArena.h"
 #include "larpandoracontent/LArObjects/LArSupportVectorMachine.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
@@ -289,6 +290,14 @@ protected:
     void CalculateClusterSlidingFits(const pandora::ClusterList &inputClusterList, const unsigned int minClusterCaloHits,
         const unsigned int slidingFitWindow, SlidingFitDataList &slidingFitDataList) const;
 
+    /**
+     *  @brief  Get the memory resource for short-lived containers: the per-event arena, if in use, else the default resource. Containers
+     *          using it must not outlive the event and must only be filled from the algorithm thread, as the arena is not thread safe
+     *
+     *  @return address of the memory resource
+     */
+    std::pmr::memory_resource *GetTransientMemoryResource() const;
+
     /**
      *  @brief  Get the beam deweighting score for a vertex
      *
@@ -330,6 +339,7 @@ protected:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
 private:
+    pandora::StatusCode Reset();
     pandora::StatusCode Run();
 
     /**
@@ -412,6 +422,9 @@ private:
 
     bool m_isEmptyViewAcceptable; ///< Whether views entirely empty of hits are classed as 'acceptable' for candidate filtration
     unsigned int m_minVertexAcceptableViews; ///< The minimum number of views in which a candidate must sit on/near a hit or in a gap (or view can be empty)
+
+    bool m_useEventArena;            ///< Whether to allocate the kd tree node pools and transient containers from a per-event arena
+    mutable EventArena m_eventArena; ///< The per-event arena, reset at the end of each event
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------